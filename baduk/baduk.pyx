@@ -2,12 +2,14 @@
 
 import collections
 import enum
+import os
 import sys
 
 import numpy as np
 
 from cython.operator cimport dereference as deref
 from cython.operator cimport preincrement as inc
+from libc.stdint cimport uint64_t
 from libcpp cimport bool
 from libcpp.memory cimport shared_ptr, unique_ptr
 
@@ -65,6 +67,9 @@ cdef extern from "baduk/baduk.h" namespace "baduk":
         CStringIter stringsBegin() const
         CStringIter stringsEnd() const
 
+    cdef cppclass CBitboard "baduk::Bitboard":
+        bool get(CPoint) const
+
     cdef cppclass CPass "baduk::Pass":
         CPass()
 
@@ -84,11 +89,21 @@ cdef extern from "baduk/baduk.h" namespace "baduk":
     bool isResign(CMove)
     CPoint getPoint(CMove)
 
+    cdef cppclass CKoRule "baduk::KoRule":
+        bool operator==(CKoRule) const
+
+    cdef cppclass CRules "baduk::Rules":
+        CRules()
+
+        CKoRule ko
+        bool allow_suicide
+
     cdef cppclass CGameState "baduk::GameState":
         CBoard board() const
         CStone nextPlayer() const
         bool isMoveLegal(CMove) const
         bool doesMoveViolateKo(CMove) const
+        CBitboard legalMoves() const
         bool isOver() const
         bool hasLastMove() const
         CMove lastMove() const
@@ -97,15 +112,20 @@ cdef extern from "baduk/baduk.h" namespace "baduk":
 
         shared_ptr[const CGameState] applyMove(CMove) const
 
-    shared_ptr[const CGameState] newGame(unsigned int, float)
-    shared_ptr[const CGameState] gameFromBoard(CBoard, CStone, float)
+    shared_ptr[const CGameState] newGame(unsigned int, float, CRules)
+    shared_ptr[const CGameState] gameFromBoard(CBoard, CStone, float, CRules)
 
-    CBoard removeDeadStones(shared_ptr[const CGameState])
+    CBoard removeDeadStones(shared_ptr[const CGameState], uint64_t)
 
 cdef extern from "baduk/baduk.h" namespace "baduk::Stone":
     cdef CStone CBlackStone "baduk::Stone::black"
     cdef CStone CWhiteStone "baduk::Stone::white"
 
+cdef extern from "baduk/baduk.h" namespace "baduk::KoRule":
+    cdef CKoRule CSimpleKo "baduk::KoRule::simple"
+    cdef CKoRule CPositionalSuperko "baduk::KoRule::positional"
+    cdef CKoRule CSituationalSuperko "baduk::KoRule::situational"
+
 cdef class Point:
     cdef public unsigned int row
     cdef public unsigned int col
@@ -209,6 +229,24 @@ cdef py_player(CStone c_player):
         return Player.white
     raise ValueError()
 
+class KoRule(enum.Enum):
+    simple = 1
+    positional = 2
+    situational = 3
+
+cdef CRules c_rules(ko_rule, allow_suicide):
+    cdef CRules rules = CRules()
+    if ko_rule == KoRule.simple:
+        rules.ko = CSimpleKo
+    elif ko_rule == KoRule.positional:
+        rules.ko = CPositionalSuperko
+    elif ko_rule == KoRule.situational:
+        rules.ko = CSituationalSuperko
+    else:
+        raise ValueError(ko_rule)
+    rules.allow_suicide = allow_suicide
+    return rules
+
 cdef CPoint c_point(Point point):
     return CPoint(point.row - 1, point.col - 1)
 
@@ -366,17 +404,19 @@ cdef copy_and_wrap_board(CBoard board):
     pyboard.c_board.reset(new CBoard(board))
     return pyboard
 
-cdef create_game(unsigned int board_size, float komi):
+cdef create_game(unsigned int board_size, float komi, CRules rules):
     new_gs = GameState()
-    new_gs.c_gamestate = newGame(board_size, komi)
+    new_gs.c_gamestate = newGame(board_size, komi, rules)
     return new_gs
 
-cdef create_game_from_board(Board board, next_player, float komi):
+cdef create_game_from_board(
+        Board board, next_player, float komi, CRules rules):
     new_gs = GameState()
     new_gs.c_gamestate = gameFromBoard(
         deref(board.c_board),
         c_player(next_player),
-        komi)
+        komi,
+        rules)
     return new_gs
 
 cdef wrap_gamestate(shared_ptr[const CGameState] gamestate):
@@ -404,12 +444,16 @@ cdef class GameState:
         return py_player(deref(self.c_gamestate).nextPlayer())
 
     @classmethod
-    def new_game(cls, board_size, komi=7.5):
-        return create_game(board_size, komi)
+    def new_game(cls, board_size, komi=7.5,
+                 ko_rule=KoRule.situational, allow_suicide=False):
+        return create_game(
+            board_size, komi, c_rules(ko_rule, allow_suicide))
 
     @classmethod
-    def from_board(cls, board, next_player, komi=7.5):
-        return create_game_from_board(board, next_player, komi)
+    def from_board(cls, board, next_player, komi=7.5,
+                   ko_rule=KoRule.situational, allow_suicide=False):
+        return create_game_from_board(
+            board, next_player, komi, c_rules(ko_rule, allow_suicide))
 
     @property
     def board(self):
@@ -435,21 +479,23 @@ cdef class GameState:
         return deref(self.c_gamestate).doesMoveViolateKo(c_move(move))
 
     cpdef legal_plays(self):
+        cdef unsigned int num_rows = deref(self.c_gamestate).board().numRows()
+        cdef unsigned int num_cols = deref(self.c_gamestate).board().numCols()
+        cdef CBitboard legal = deref(self.c_gamestate).legalMoves()
+        cdef unsigned int r = 0
+        cdef unsigned int c = 0
         moves = []
-        for row in range(1, self.board.num_rows + 1):
-            for col in range(1, self.board.num_cols + 1):
-                move = Move.play(Point(row, col))
-                if self.is_valid_move(move):
-                    moves.append(move)
+        while r < num_rows:
+            c = 0
+            while c < num_cols:
+                if legal.get(CPoint(r, c)):
+                    moves.append(Move.play(Point(r + 1, c + 1)))
+                c += 1
+            r += 1
         return moves
 
     cpdef legal_moves(self):
-        moves = []
-        for row in range(1, self.board.num_rows + 1):
-            for col in range(1, self.board.num_cols + 1):
-                move = Move.play(Point(row, col))
-                if self.is_valid_move(move):
-                    moves.append(move)
+        moves = self.legal_plays()
         # These two moves are always legal.
         moves.append(Move.pass_turn())
         moves.append(Move.resign())
@@ -483,16 +529,13 @@ cdef class GameState:
         cdef unsigned int num_cols = deref(self.c_gamestate).board().numCols()
         cdef unsigned int size = num_rows * num_cols + 1
         cdef np.ndarray[DTYPE_t, ndim=1] x = np.zeros((size,), dtype=DTYPE)
+        cdef CBitboard legal = deref(self.c_gamestate).legalMoves()
         cdef unsigned int r = 0
         cdef unsigned int c = 0
-        cdef CPoint p = CPoint(0, 0)
-        cdef CMove move = CMove(CPlay(p))
         while r < num_rows:
             c = 0
             while c < num_cols:
-                p = CPoint(r, c)
-                move = CMove(CPlay(p))
-                if deref(self.c_gamestate).isMoveLegal(move):
+                if legal.get(CPoint(r, c)):
                     x[num_cols * r + c] = 1
                 c += 1
             r += 1
@@ -501,8 +544,16 @@ cdef class GameState:
         return x
 
 
-def remove_dead_stones(GameState game):
-    return copy_and_wrap_board(removeDeadStones(game.c_gamestate))
+def remove_dead_stones(GameState game, seed=None):
+    """Return the board with the stones estimated to be dead removed.
+
+    The estimate comes from random playouts. The same seed always gives
+    the same answer. If seed is None, a fresh one is drawn from
+    os.urandom, so separate calls make independent estimates.
+    """
+    if seed is None:
+        seed = int.from_bytes(os.urandom(8), 'little')
+    return copy_and_wrap_board(removeDeadStones(game.c_gamestate, seed))
 
 
 def print_board(Board board, outf=None):
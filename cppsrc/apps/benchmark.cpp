@@ -1,12 +1,29 @@
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <thread>
 
 #include "../baduk/baduk.h"
 
-int main() {
-    for (int i = 0; i < 10000; ++i) {
-        auto game = baduk::newGame(9, 7.5);
-        baduk::RandomBot black_bot;
-        baduk::RandomBot white_bot;
+using Clock = std::chrono::steady_clock;
+
+double gamesPerSecond(int num_games, Clock::time_point start) {
+    const std::chrono::duration<double> elapsed = Clock::now() - start;
+    return num_games / elapsed.count();
+}
+
+// Random games stepped through the full GameState machinery.
+void benchmarkGameStates(
+        unsigned int board_size, int num_games, baduk::KoRule ko) {
+    baduk::Rules rules;
+    rules.ko = ko;
+
+    const auto start = Clock::now();
+    baduk::GameArena arena;
+    for (int i = 0; i < num_games; ++i) {
+        auto game = baduk::newGame(board_size, 7.5, rules, &arena);
+        baduk::RandomBot black_bot(baduk::Rng(i, 0));
+        baduk::RandomBot white_bot(baduk::Rng(i, 1));
 
         while (!game->isOver()) {
             auto next_agent =
@@ -17,6 +34,79 @@ int main() {
 
             game = game->applyMove(next_move);
         }
+        game.reset();
+        arena.reset();
+    }
+    std::cout << board_size << "x" << board_size << " game states ("
+        << (ko == baduk::KoRule::simple ? "simple ko" : "superko") << "): "
+        << gamesPerSecond(num_games, start) << " games/s\n";
+}
+
+// The same games on the light playout engine.
+void benchmarkPlayouts(unsigned int board_size, int num_games) {
+    const auto start = Clock::now();
+    baduk::Playout playout;
+    baduk::Rng rng(0);
+    const baduk::Board empty_board(board_size, board_size);
+    for (int i = 0; i < num_games; ++i) {
+        auto board = empty_board;
+        playout.run(board, baduk::Stone::black, rng);
+    }
+    std::cout << board_size << "x" << board_size << " playouts: "
+        << gamesPerSecond(num_games, start) << " games/s\n";
+}
+
+// Heavy playouts, weighted by the default patterns.
+void benchmarkHeavyPlayouts(unsigned int board_size, int num_games) {
+    const auto& weights = baduk::PatternWeights::defaults();
+    const auto start = Clock::now();
+    baduk::Playout playout;
+    baduk::Rng rng(0);
+    const baduk::Board empty_board(board_size, board_size);
+    for (int i = 0; i < num_games; ++i) {
+        auto board = empty_board;
+        playout.run(board, baduk::Stone::black, rng, weights);
+    }
+    std::cout << board_size << "x" << board_size << " heavy playouts: "
+        << gamesPerSecond(num_games, start) << " games/s\n";
+}
+
+// Playouts spread over a number of threads.
+void benchmarkRunner(
+        unsigned int board_size, int num_games, unsigned int num_threads) {
+    const auto game = baduk::newGame(board_size, 7.5);
+    const auto start = Clock::now();
+    baduk::runPlayouts(*game, num_games, num_threads, 0);
+    std::cout << board_size << "x" << board_size << " playouts on "
+        << num_threads << " threads: "
+        << gamesPerSecond(num_games, start) << " games/s\n";
+}
+
+int main() {
+    // A Board is as big as its largest alternative, but copying one
+    // only copies the FixedBoard it holds.
+    std::cout << "Board: " << sizeof(baduk::Board) << " bytes\n";
+    std::cout << "FixedBoard<9>: " << sizeof(baduk::FixedBoard<9>)
+        << " bytes\n";
+    std::cout << "FixedBoard<13>: " << sizeof(baduk::FixedBoard<13>)
+        << " bytes\n";
+    std::cout << "FixedBoard<19>: " << sizeof(baduk::FixedBoard<19>)
+        << " bytes\n";
+    std::cout << "Game state: " << baduk::gameStateSize() << " bytes\n";
+
+    // Playouts only need simple ko, but games are played under superko
+    // by default, which also exercises the shared history.
+    benchmarkGameStates(9, 10000, baduk::KoRule::simple);
+    benchmarkGameStates(9, 10000, baduk::KoRule::situational);
+    benchmarkGameStates(19, 1000, baduk::KoRule::simple);
+    benchmarkGameStates(19, 1000, baduk::KoRule::situational);
+    benchmarkPlayouts(9, 50000);
+    benchmarkPlayouts(19, 5000);
+    benchmarkHeavyPlayouts(9, 10000);
+    benchmarkHeavyPlayouts(19, 1000);
+    const auto num_cores = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned int threads = 1; threads <= num_cores; threads *= 2) {
+        benchmarkRunner(9, 50000, threads);
     }
 
     return 0;
@@ -1,11 +1,14 @@
+#include <cstdlib>
 #include <iostream>
 
 #include "../baduk/baduk.h"
 
-int main() {
+int main(int argc, char* argv[]) {
+    // Pass a seed to play a different game.
+    const auto seed = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 0;
     auto game = baduk::newGame(19, 7.5);
-    baduk::RandomBot black_bot;
-    baduk::RandomBot white_bot;
+    baduk::RandomBot black_bot(baduk::Rng(seed, 0));
+    baduk::RandomBot white_bot(baduk::Rng(seed, 1));
 
     while (!game->isOver()) {
         std::cout << game->board() << "\n";
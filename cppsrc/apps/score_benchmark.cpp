@@ -6,6 +6,9 @@ using baduk::Board;
 using baduk::Stone;
 
 int main() {
+    std::cout << "Board: " << sizeof(baduk::Board) << " bytes\n";
+    std::cout << "Game state: " << baduk::gameStateSize() << " bytes\n";
+
 	// oxx...xoo...oox....
 	// ooxx..xxo.o.oxx..x.
 	// .oox..xoooxxooxx..x
@@ -285,7 +288,7 @@ int main() {
     board.place("T1", Stone::white);
 
     auto game = baduk::gameFromBoard(board, Stone::white, 7.5);
-    baduk::removeDeadStones(game);
+    baduk::removeDeadStones(game, 0);
 
     return 0;
 }
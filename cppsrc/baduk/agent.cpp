@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cassert>
 #include <vector>
 
@@ -5,83 +6,58 @@
 
 namespace baduk {
 
-bool isPointAnEye(Board const& board, Point const& point, Stone stone) {
-    // An eye is an empty point.
-    if (!board.isEmpty(point)) {
-        return false;
-    }
+Move RandomBot::selectMove(GameState const& game_state) {
+    thread_local static std::vector<Point> candidates;
+    Board const& board = game_state.board();
 
-    // All adjacent points must contain friendly stones.
-    for (auto neighbor : board.neighbors(point)) {
-        if (board.isEmpty(neighbor)) {
-            return false;
-        }
-        if (board.at(neighbor) != stone) {
-            return false;
-        }
-    }
+    candidates.reserve(board.numRows() * board.numCols());
+    candidates.clear();
 
-    // We must control 3 out of 4 corners in the middle. On the edge we must
-    // control all corners.
-    unsigned int friendly_corners = 0;
-    unsigned int off_board_corners = 0;
-    std::vector<Point> corners;
-    if (point.row() > 0 && point.col() > 0) {
-        corners.push_back(Point(point.row() - 1, point.col() - 1));
-    } else {
-        ++off_board_corners;
-    }
-    if (point.row() > 0 && point.col() < board.numCols() - 1) {
-        corners.push_back(Point(point.row() - 1, point.col() + 1));
-    } else {
-        ++off_board_corners;
-    }
-    if (point.row() < board.numRows() - 1 && point.col() > 0) {
-        corners.push_back(Point(point.row() + 1, point.col() - 1));
-    } else {
-        ++off_board_corners;
-    }
-    if (point.row() < board.numRows() - 1 &&
-            point.col() < board.numCols() - 1) {
-        corners.push_back(Point(point.row() + 1, point.col() + 1));
-    } else {
-        ++off_board_corners;
-    }
-    for (auto corner : corners) {
-        if (!board.isEmpty(corner) && board.at(corner) == stone) {
-            ++friendly_corners;
+    const auto player = game_state.nextPlayer();
+    // Even where the rules allow suicide, it's never worth playing at
+    // random.
+    const auto legal = game_state.legalMoves() & board.candidates(player);
+    legal.forEach([&](Point candidate) {
+        assert(board.isEmpty(candidate));
+        if (board.isEye(candidate, player)) {
+            return;
         }
+        candidates.push_back(candidate);
+    });
+
+    if (candidates.empty()) {
+        return Pass();
     }
-    if (off_board_corners > 0) {
-        return off_board_corners + friendly_corners == 4;
-    }
-    return friendly_corners >= 3;
+    return candidates[rng_.below(
+        static_cast<std::uint32_t>(candidates.size()))];
 }
 
-Move RandomBot::selectMove(GameState const& game_state) {
+Move PatternBot::selectMove(GameState const& game_state) {
     thread_local static std::vector<Point> candidates;
+    thread_local static std::vector<std::uint32_t> cumulative;
     Board const& board = game_state.board();
 
-    candidates.reserve(board.numRows() * board.numCols());
     candidates.clear();
-
-    for (unsigned int r = 0; r < board.numRows(); ++r) {
-        for (unsigned int c = 0; c < board.numCols(); ++c) {
-            const Point candidate(r, c);
-            if (game_state.isMoveLegal(Play(candidate)) &&
-                    !isPointAnEye(
-                        board, candidate, game_state.nextPlayer())) {
-                assert(board.isEmpty(candidate));
-                candidates.push_back(candidate);
-            }
+    cumulative.clear();
+
+    const auto player = game_state.nextPlayer();
+    const auto legal = game_state.legalMoves() & board.candidates(player);
+    std::uint32_t total = 0;
+    legal.forEach([&](Point candidate) {
+        if (board.isEye(candidate, player)) {
+            return;
         }
-    }
+        total += weights_->weight(forPlayer(board.pattern(candidate), player));
+        candidates.push_back(candidate);
+        cumulative.push_back(total);
+    });
 
     if (candidates.empty()) {
         return Pass();
     }
-    std::uniform_int_distribution<unsigned int> dist(0, candidates.size() - 1);
-    return candidates[dist(rng_)];
+    const auto pick = std::upper_bound(
+        cumulative.begin(), cumulative.end(), rng_.below(total));
+    return candidates[pick - cumulative.begin()];
 }
 
 }
@@ -1,10 +1,9 @@
 #ifndef incl_BADUK_AGENT_H__
 #define incl_BADUK_AGENT_H__
 
-#include <chrono>
-#include <random>
-
 #include "game.h"
+#include "pattern.h"
+#include "rng.h"
 
 namespace baduk {
 
@@ -15,15 +14,28 @@ public:
 
 class RandomBot : public Agent {
 public:
-    RandomBot() :
-        rng_(
-            std::chrono::duration_cast<std::chrono::microseconds>(
-                std::chrono::system_clock::now().time_since_epoch()
-            ).count()) {}
+    explicit RandomBot(Rng const& rng) : rng_(rng) {}
+    Move selectMove(GameState const& game_state) override;
+
+private:
+    Rng rng_;
+};
+
+// Like RandomBot, but picks each move with probability proportional to
+// the weight of the pattern around it.
+class PatternBot : public Agent {
+public:
+    /** weights is not copied, and must outlive the bot. */
+    explicit PatternBot(
+            Rng const& rng,
+            PatternWeights const& weights = PatternWeights::defaults()) :
+        rng_(rng), weights_(&weights) {}
+    PatternBot(Rng const& rng, PatternWeights&& weights) = delete;
     Move selectMove(GameState const& game_state) override;
 
 private:
-    std::default_random_engine rng_;
+    Rng rng_;
+    PatternWeights const* weights_;
 };
 
 }
@@ -0,0 +1,15 @@
+#include "arena.h"
+
+namespace baduk {
+
+GameArena::GameArena(std::size_t size) :
+    buffer_(new std::byte[size]),
+    resource_(buffer_.get(), size) {}
+
+void GameArena::reset() {
+    // Anything that overflowed the buffer goes back to the heap; the
+    // buffer itself is kept for next time.
+    resource_.release();
+}
+
+}
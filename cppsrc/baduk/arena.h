@@ -0,0 +1,42 @@
+#ifndef incl_BADUK_ARENA_H__
+#define incl_BADUK_ARENA_H__
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace baduk {
+
+// Memory for short-lived game states, like the chain of states in a
+// random game. Pass one to newGame() or gameFromBoard(), and that state
+// and every state that follows from it are allocated here, along with
+// the superko history they share. Allocating just bumps a pointer into
+// a buffer that is reused from one reset() to the next, so once the
+// buffer is big enough a game makes no calls to malloc at all, and
+// consecutive states sit next to each other in memory.
+//
+// The caller must destroy every state created from the arena before
+// calling reset() or destroying the arena. An arena is not thread-safe,
+// so only one thread may apply moves to its states.
+class GameArena {
+public:
+    static const std::size_t DEFAULT_SIZE = 4 << 20;
+
+    explicit GameArena(std::size_t size = DEFAULT_SIZE);
+    GameArena(GameArena const&) = delete;
+    GameArena& operator=(GameArena const&) = delete;
+
+    /** Free everything allocated from the arena. Every game state
+     * created from it must already have been destroyed. */
+    void reset();
+
+    std::pmr::memory_resource* resource() { return &resource_; }
+
+private:
+    std::unique_ptr<std::byte[]> buffer_;
+    std::pmr::monotonic_buffer_resource resource_;
+};
+
+}
+
+#endif
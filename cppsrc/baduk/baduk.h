@@ -2,8 +2,16 @@
 #define incl_BADUK_BADUK_H__
 
 #include "agent.h"
+#include "arena.h"
 #include "board.h"
 #include "game.h"
+#include "gamerecord.h"
+#include "mutablegame.h"
+#include "pattern.h"
+#include "playout.h"
+#include "position.h"
+#include "runner.h"
 #include "scoring.h"
+#include "transposition.h"
 
 #endif
@@ -0,0 +1,120 @@
+#include <cassert>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "bitboard.h"
+
+namespace baduk {
+
+Bitboard Bitboard::full(unsigned int num_rows, unsigned int num_cols) {
+    assert(num_rows <= MAX_BOARD_SIZE && num_cols <= MAX_BOARD_SIZE);
+    Bitboard b;
+    const Row row = (Row(1) << num_cols) - 1;
+    for (unsigned int r = 1; r <= num_rows; ++r) {
+        b.rows_[r] = row;
+    }
+    return b;
+}
+
+bool Bitboard::any() const {
+    Row acc = 0;
+    for (auto row : rows_) {
+        acc |= row;
+    }
+    return acc != 0;
+}
+
+unsigned int Bitboard::count() const {
+    unsigned int n = 0;
+    for (auto row : rows_) {
+        n += static_cast<unsigned int>(__builtin_popcount(row));
+    }
+    return n;
+}
+
+Point Bitboard::first() const {
+    unsigned int r = 1;
+    while (rows_[r] == 0) {
+        ++r;
+    }
+    return Point(r - 1, static_cast<unsigned int>(__builtin_ctz(rows_[r])));
+}
+
+Bitboard Bitboard::operator&(Bitboard const& b) const {
+    Bitboard rv;
+    for (unsigned int r = 0; r < NUM_ROWS; ++r) {
+        rv.rows_[r] = rows_[r] & b.rows_[r];
+    }
+    return rv;
+}
+
+Bitboard Bitboard::operator|(Bitboard const& b) const {
+    Bitboard rv;
+    for (unsigned int r = 0; r < NUM_ROWS; ++r) {
+        rv.rows_[r] = rows_[r] | b.rows_[r];
+    }
+    return rv;
+}
+
+Bitboard Bitboard::without(Bitboard const& b) const {
+    Bitboard rv;
+    for (unsigned int r = 0; r < NUM_ROWS; ++r) {
+        rv.rows_[r] = rows_[r] & ~b.rows_[r];
+    }
+    return rv;
+}
+
+#ifdef __AVX2__
+
+Bitboard Bitboard::dilate(Bitboard const& within) const {
+    // Eight rows per vector; the loads one row above and below pick up
+    // the north and south neighbors.
+    Bitboard rv;
+    for (unsigned int r = 1; r <= MAX_BOARD_SIZE; r += 8) {
+        const auto mid = _mm256_loadu_si256(
+            reinterpret_cast<__m256i const*>(&rows_[r]));
+        const auto below = _mm256_loadu_si256(
+            reinterpret_cast<__m256i const*>(&rows_[r - 1]));
+        const auto above = _mm256_loadu_si256(
+            reinterpret_cast<__m256i const*>(&rows_[r + 1]));
+        const auto mask = _mm256_loadu_si256(
+            reinterpret_cast<__m256i const*>(&within.rows_[r]));
+        auto grown = _mm256_or_si256(
+            _mm256_or_si256(mid, _mm256_slli_epi32(mid, 1)),
+            _mm256_or_si256(_mm256_srli_epi32(mid, 1),
+                _mm256_or_si256(below, above)));
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(&rv.rows_[r]),
+            _mm256_and_si256(grown, mask));
+    }
+    return rv;
+}
+
+#else
+
+Bitboard Bitboard::dilate(Bitboard const& within) const {
+    Bitboard rv;
+    for (unsigned int r = 1; r <= MAX_BOARD_SIZE; ++r) {
+        const auto row = rows_[r];
+        rv.rows_[r] = (row | (row << 1) | (row >> 1) |
+            rows_[r - 1] | rows_[r + 1]) & within.rows_[r];
+    }
+    return rv;
+}
+
+#endif
+
+Bitboard Bitboard::floodFill(Bitboard const& within) const {
+    auto current = *this & within;
+    while (true) {
+        const auto next = current.dilate(within);
+        if (next == current) {
+            return current;
+        }
+        current = next;
+    }
+}
+
+}
@@ -0,0 +1,87 @@
+#ifndef incl_BADUK_BITBOARD_H__
+#define incl_BADUK_BITBOARD_H__
+
+#include <array>
+#include <cstdint>
+
+#include "dim.h"
+#include "point.h"
+
+namespace baduk {
+
+// A whole-board mask with one 32-bit word per row; point (r, c) is bit
+// c of row r + 1. Rows 0 and everything past the last board row are
+// always zero, so shifting a row word north or south is just reading
+// the word next to it, and a point's four neighbors can be found for
+// the whole board at once with shifts and ORs.
+//
+// This is for bulk work on a position, like flood fills and
+// recomputing liberties; the board itself still updates incrementally.
+class Bitboard {
+public:
+    using Row = std::uint32_t;
+    // Enough padding for whole 8-row blocks plus a guard row at each
+    // end.
+    static constexpr unsigned int NUM_ROWS = 32;
+    static_assert(MAX_BOARD_SIZE <= 32, "a row must fit in one word");
+    static_assert(
+        (MAX_BOARD_SIZE + 7) / 8 * 8 + 2 <= NUM_ROWS,
+        "not enough padding rows");
+
+    Bitboard() : rows_{} {}
+
+    /** Every point on a board of this size. */
+    static Bitboard full(unsigned int num_rows, unsigned int num_cols);
+
+    bool get(Point p) const {
+        return (rows_[p.row() + 1] >> p.col()) & 1;
+    }
+    void set(Point p) {
+        rows_[p.row() + 1] |= Row(1) << p.col();
+    }
+    void reset(Point p) {
+        rows_[p.row() + 1] &= ~(Row(1) << p.col());
+    }
+
+    bool any() const;
+    unsigned int count() const;
+    /** The lowest point in the set. The set must not be empty. */
+    Point first() const;
+
+    Bitboard operator&(Bitboard const& b) const;
+    Bitboard operator|(Bitboard const& b) const;
+    /** Points in this set but not in b. */
+    Bitboard without(Bitboard const& b) const;
+    bool operator==(Bitboard const& b) const { return rows_ == b.rows_; }
+    bool operator!=(Bitboard const& b) const { return rows_ != b.rows_; }
+
+    /** This set plus all its neighbors, restricted to within. */
+    Bitboard dilate(Bitboard const& within) const;
+    /** Grow this set through within until it stops changing. Starting
+     * from one stone, with within the stones of its color, this gives
+     * the whole string. */
+    Bitboard floodFill(Bitboard const& within) const;
+
+    template<typename F>
+    void forEach(F&& f) const {
+        for (unsigned int r = 1; r <= MAX_BOARD_SIZE; ++r) {
+            auto bits = rows_[r];
+            while (bits != 0) {
+                f(Point(r - 1, static_cast<unsigned int>(__builtin_ctz(bits))));
+                bits &= bits - 1;
+            }
+        }
+    }
+
+private:
+    std::array<Row, NUM_ROWS> rows_;
+};
+
+/** The empty points next to a string. */
+inline Bitboard liberties(Bitboard const& string, Bitboard const& empty) {
+    return string.dilate(empty);
+}
+
+}
+
+#endif
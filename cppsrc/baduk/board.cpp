@@ -1,5 +1,4 @@
 #include <algorithm>
-#include <cassert>
 #include <iostream>
 
 #include "board.h"
@@ -9,185 +8,169 @@ namespace baduk {
 // I is excluded on purpose
 const std::string COLS = "ABCDEFGHJKLMNOPQRSTUVWXYZ";
 
-class StringPoolEmpty : public std::exception {};
+namespace {
 
-Board::Board() :
-        zobrist_(zobrist::ZobristCodes::get()),
-        num_rows_(19),
-        num_cols_(19),
-        neighbors_(getNeighborTable(19, 19)),
-        hashcode_(zobrist_.emptyBoard()) {
-    grid_.fill(EMPTY);
+std::variant<FixedBoard<9>, FixedBoard<13>, FixedBoard<19>> makeFixedBoard(
+        unsigned int num_rows, unsigned int num_cols) {
+    const auto size = std::max(num_rows, num_cols);
+    if (size <= 9) {
+        return FixedBoard<9>(num_rows, num_cols);
+    }
+    if (size <= 13) {
+        return FixedBoard<13>(num_rows, num_cols);
+    }
+    if (size <= 19) {
+        return FixedBoard<19>(num_rows, num_cols);
+    }
+    throw BoardTooLarge();
 }
 
+}
+
+Board::Board() : Board(19, 19) {}
+
 Board::Board(unsigned int num_rows, unsigned int num_cols) :
-        zobrist_(zobrist::ZobristCodes::get()),
-        num_rows_(num_rows),
-        num_cols_(num_cols),
-        neighbors_(getNeighborTable(num_rows, num_cols)),
-        hashcode_(zobrist_.emptyBoard()) {
-    grid_.fill(EMPTY);
-}
-
-bool Board::isEmpty(Point p) const {
-    return grid_[index(p)] == EMPTY;
-}
-
-template<typename Container, typename T>
-bool contains(Container container, T elem) {
-    return std::find(container.begin(), container.end(), elem) !=
-        container.end();
-}
-
-void Board::place(Point point, Stone player) {
-    assert(isEmpty(point));
-    std::vector<StringIdx> adjacent_other_color;
-
-    const auto new_string_idx = getUnusedString();
-    auto& new_string = strings_[new_string_idx];
-    new_string.setColor(player);
-    new_string.addPoint(point);
-    for (Point neighbor : neighbors_->get(point)) {
-        auto neighbor_string = grid_[index(neighbor)];
-        if (neighbor_string == EMPTY) {
-            new_string.addLiberty(neighbor);
-        } else if (strings_[neighbor_string].color() == player) {
-            new_string.merge(strings_[neighbor_string]);
-        } else {
-            if (!contains(adjacent_other_color, neighbor_string)) {
-                adjacent_other_color.push_back(neighbor_string);
-            }
-        }
+    impl_(makeFixedBoard(num_rows, num_cols)) {}
+
+// Every FixedBoard is trivially copyable, and so is the variant, whose
+// own copy would take the full size of FixedBoard<19> whatever the
+// board size. Copy just the alternative in use.
+Board::Board(Board const& other) :
+    impl_(other.visit([](auto const& board) {
+        return Impl(std::in_place_type<std::decay_t<decltype(board)>>, board);
+    })) {}
+
+Board& Board::operator=(Board const& other) {
+    if (this != &other) {
+        other.visit([this](auto const& board) {
+            impl_.emplace<std::decay_t<decltype(board)>>(board);
+        });
     }
-    replace(new_string_idx);
+    return *this;
+}
 
-    // Update hash code.
-    hashcode_ ^= zobrist_.getEmpty(point);
-    hashcode_ ^= zobrist_.getStone(player, point);
+unsigned int Board::numRows() const {
+    return visit([](auto const& board) { return board.numRows(); });
+}
 
-    for (auto const& other_color_string : adjacent_other_color) {
-        auto& enemy_string = strings_[other_color_string];
-        enemy_string.removeLiberty(point);
-        if (enemy_string.numLiberties() == 0) {
-            remove(other_color_string);
-        }
-    }
+unsigned int Board::numCols() const {
+    return visit([](auto const& board) { return board.numCols(); });
 }
 
-bool Board::willCapture(Point point, Stone player) const {
-    for (Point neighbor : neighbors_->get(point)) {
-        const auto neighbor_string_idx = grid_[index(neighbor)];
-        if (neighbor_string_idx == EMPTY) {
-            continue;
-        }
-        const auto& neighbor_string = strings_[neighbor_string_idx];
-        if (neighbor_string.color() == player) {
-            continue;
-        }
-        if (neighbor_string.numLiberties() == 1) {
-            return true;
-        }
-    }
-    return false;
-}
-
-bool Board::willHaveNoLiberties(Point point, Stone player) const {
-    // Does NOT check if it is a capture! Call willCapture first.
-    for (Point neighbor : neighbors_->get(point)) {
-        const auto neighbor_string_idx = grid_[index(neighbor)];
-        if (neighbor_string_idx == EMPTY) {
-            // This point will be a liberty.
-            return false;
-        } else {
-            const auto& neighbor_string = strings_[neighbor_string_idx];
-            if (neighbor_string.color() == player) {
-                if (neighbor_string.numLiberties() > 1) {
-                    // This string will still have a liberty after placing the
-                    // stone.
-                    return false;
-                }
-            }
-        }
-    }
-    return true;
+MoveAnalysis Board::analyzeMove(Point point, Stone stone) const {
+    return visit([&](auto const& board) {
+        return board.analyzeMove(point, stone);
+    });
 }
 
-void Board::replace(StringIdx new_string_idx) {
-    const GoString& new_string = strings_[new_string_idx];
-    for (auto point : new_string.stones()) {
-        if (grid_[index(point)] != EMPTY) {
-            recycle(grid_[index(point)]);
-        }
-        grid_[index(point)] = new_string_idx;
-    }
+void Board::place(MoveAnalysis const& move) {
+    visit([&](auto& board) { board.place(move); });
 }
 
-Stone Board::at(Point p) const {
-    return strings_[grid_[index(p)]].color();
+void Board::place(MoveAnalysis const& move, PlaceUndo& undo) {
+    visit([&](auto& board) { board.place(move, undo); });
 }
 
-GoString Board::stringAt(Point p) const {
-    return strings_[grid_[index(p)]];
+void Board::place(Point point, Stone stone) {
+    visit([&](auto& board) { board.place(point, stone); });
 }
 
-std::vector<Point> const& Board::neighbors(Point p) const {
-    return neighbors_->get(p);
+void Board::place(Point point, Stone stone, PlaceUndo& undo) {
+    visit([&](auto& board) { board.place(point, stone, undo); });
 }
 
-unsigned int Board::index(Point p) const {
-    return num_cols_ * p.row() + p.col();
+void Board::undo(PlaceUndo const& undo) {
+    visit([&](auto& board) { board.undo(undo); });
 }
 
-void Board::remove(StringIdx old_string_idx) {
-    const GoString& old_string = strings_[old_string_idx];
-    for (auto const& point : old_string.stones()) {
-        std::vector<StringIdx> strings_to_update;
-        for (Point neighbor : neighbors_->get(point)) {
-            auto neighbor_string_idx = grid_[index(neighbor)];
-            if (neighbor_string_idx == EMPTY) {
-                continue;
-            }
-            if (contains(strings_to_update, neighbor_string_idx)) {
-                continue;
-            }
-            if (neighbor_string_idx != old_string_idx) {
-                strings_to_update.push_back(neighbor_string_idx);
-            }
-        }
-        for (auto string_to_update : strings_to_update) {
-            strings_[string_to_update].addLiberty(point);
-        }
+bool Board::willCapture(Point point, Stone stone) const {
+    return visit([&](auto const& board) {
+        return board.willCapture(point, stone);
+    });
+}
+
+bool Board::willHaveNoLiberties(Point point, Stone stone) const {
+    return visit([&](auto const& board) {
+        return board.willHaveNoLiberties(point, stone);
+    });
+}
 
-        hashcode_ ^= zobrist_.getStone(old_string.color(), point);
-        hashcode_ ^= zobrist_.getEmpty(point);
+bool Board::isEye(Point point, Stone stone) const {
+    return visit([&](auto const& board) { return board.isEye(point, stone); });
+}
 
-        grid_[index(point)] = EMPTY;
-    }
-    recycle(old_string_idx);
+PatternCode Board::pattern(Point point) const {
+    return visit([&](auto const& board) { return board.pattern(point); });
 }
 
-void Board::validate() const {
-    for (const auto& go_string_idx : grid_) {
-        if (go_string_idx == EMPTY) {
-            continue;
-        }
-        const GoString& go_string = strings_[go_string_idx];
-        for (const auto point : go_string.stones()) {
-            assert(!isEmpty(point));
-            assert(at(point) == go_string.color());
-        }
-        for (const auto point : go_string.liberties()) {
-            assert(isEmpty(point));
+bool Board::isEmpty(Point point) const {
+    return visit([&](auto const& board) { return board.isEmpty(point); });
+}
+
+Stone Board::at(Point point) const {
+    return visit([&](auto const& board) { return board.at(point); });
+}
+
+GoString Board::stringAt(Point point) const {
+    return visit([&](auto const& board) { return board.stringAt(point); });
+}
+
+std::optional<Point> koPointAfter(
+        Board const& board, Point point, MoveAnalysis const& analysis) {
+    if (!analysis.isKoCapture()) {
+        return std::nullopt;
+    }
+    // The captured stone was the new stone's only empty neighbor.
+    for (auto neighbor : board.neighbors(point)) {
+        if (board.isEmpty(neighbor)) {
+            return neighbor;
         }
     }
+    return std::nullopt;
+}
+
+std::vector<Point> const& Board::neighbors(Point p) const {
+    return visit([&](auto const& board) -> std::vector<Point> const& {
+        return board.neighbors(p);
+    });
+}
+
+zobrist::hashcode Board::hash() const {
+    return visit([](auto const& board) { return board.hash(); });
+}
+
+zobrist::hashcode Board::hashAfter(Point point, Stone stone) const {
+    return visit([&](auto const& board) {
+        return board.hashAfter(point, stone);
+    });
+}
+
+Bitboard Board::stones(Stone stone) const {
+    return visit([&](auto const& board) { return board.stones(stone); });
+}
+
+Bitboard const& Board::emptyPoints() const {
+    return visit([](auto const& board) -> Bitboard const& {
+        return board.emptyPoints();
+    });
+}
+
+Bitboard const& Board::candidates(Stone stone) const {
+    return visit([&](auto const& board) -> Bitboard const& {
+        return board.candidates(stone);
+    });
+}
+
+Bitboard Board::captures(Stone stone) const {
+    return visit([&](auto const& board) { return board.captures(stone); });
 }
 
 bool Board::operator==(Board const& b) const {
-    if (num_rows_ != b.num_rows_ || num_cols_ != b.num_cols_) {
+    if (numRows() != b.numRows() || numCols() != b.numCols()) {
         return false;
     }
-    for (unsigned int r = 0; r < num_rows_; ++r) {
-        for (unsigned int c = 0; c < num_cols_; ++c) {
+    for (unsigned int r = 0; r < numRows(); ++r) {
+        for (unsigned int c = 0; c < numCols(); ++c) {
             Point p(r, c);
             if (isEmpty(p) != b.isEmpty(p)) {
                 return false;
@@ -202,38 +185,6 @@ bool Board::operator==(Board const& b) const {
     return true;
 }
 
-zobrist::hashcode Board::hash() const {
-    return hashcode_;
-}
-
-zobrist::hashcode Board::hashAfter(Point point, Stone stone) const {
-    auto hashcode = hash();
-    const auto opponent = other(stone);
-
-    // Place the new stone.
-    hashcode ^= zobrist_.getEmpty(point);
-    hashcode ^= zobrist_.getStone(stone, point);
-
-    for (Point neighbor : neighbors_->get(point)) {
-        const auto neighbor_string_idx = grid_[index(neighbor)];
-        if (neighbor_string_idx == EMPTY) {
-            continue;
-        }
-        const GoString& neighbor_string = strings_[neighbor_string_idx];
-        if (neighbor_string.color() == stone) {
-            continue;
-        }
-        if (neighbor_string.numLiberties() == 1) {
-            for (const auto& p : neighbor_string.stones()) {
-                hashcode ^= zobrist_.getStone(opponent, p);
-                hashcode ^= zobrist_.getEmpty(p);
-            }
-        }
-    }
-
-    return hashcode;
-}
-
 std::ostream& operator<<(std::ostream& out, Board const& board) {
     for (int r = board.numRows() - 1; r >= 0; --r) {
         if (r + 1 < 10) {
@@ -260,54 +211,43 @@ std::ostream& operator<<(std::ostream& out, Board const& board) {
     return out;
 }
 
-StringIdx Board::getUnusedString() {
-    for (unsigned int i = 0; i < strings_.size(); ++i) {
-        if (!used_[i]) {
-            used_.set(i);
-            strings_[i].clear();
-            return static_cast<StringIdx>(i);
-        }
-    }
-    throw StringPoolEmpty();
-}
-
-void Board::recycle(StringIdx string_idx) {
-    used_.reset(string_idx);
-}
-
 StringIter Board::stringsBegin() const {
-    // Find the first used string.
-    unsigned int first = 0;
-    for (; first < strings_.size(); ++first) {
-        if (used_[first]) {
-            break;
-        }
-    }
-    return StringIter(this, first);
+    return StringIter(this, 0);
 }
 
 StringIter Board::stringsEnd() const {
-    return StringIter(this, strings_.size());
+    return StringIter(this, visit([](auto const& board) {
+        return board.numStrings();
+    }));
 }
 
 StringIter::StringIter(Board const* board, unsigned int i) :
     board_(board),
-    i_(i) {}
+    i_(i),
+    has_current_(false) {}
 
 StringIter& StringIter::operator++() {
+    has_current_ = false;
     ++i_;
-    while (i_ < board_->strings_.size() && !board_->used_[i_]) {
-        ++i_;
-    }
     return *this;
 }
 
+GoString const& StringIter::current() const {
+    if (!has_current_) {
+        current_ = board_->visit([this](auto const& board) {
+            return board.liveString(i_);
+        });
+        has_current_ = true;
+    }
+    return current_;
+}
+
 GoString StringIter::operator*() const {
-    return board_->strings_[i_];
+    return current();
 }
 
 GoString const* StringIter::operator->() const {
-    return &board_->strings_[i_];
+    return &current();
 }
 
 bool StringIter::operator!=(StringIter const& it) const {
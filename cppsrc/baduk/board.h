@@ -1,38 +1,62 @@
 #ifndef incl_BADUK_BOARD_H__
 #define incl_BADUK_BOARD_H__
 
-#include <array>
-#include <memory>
+#include <optional>
 #include <ostream>
 #include <string>
+#include <variant>
 #include <vector>
 
+#include "bitboard.h"
+#include "fixedboard.h"
 #include "gostring.h"
-#include "neighbor.h"
 #include "point.h"
 #include "zobrist/zobrist.h"
 
 namespace baduk {
 
-using StringIdx = int;
-const StringIdx EMPTY = -1;
+class BoardTooLarge : public std::exception {};
 
 class StringIter;
 
+// A board of any size up to MAX_BOARD_SIZE. The real work is done by a
+// FixedBoard of the smallest specialised size that fits; each method
+// here just forwards to it. Hot loops that know their board size can
+// use visit() to reach the FixedBoard directly.
 class Board {
 public:
     Board();
     Board(unsigned int num_rows, unsigned int num_cols);
+    /** Copies only the FixedBoard in use, not the whole variant. */
+    Board(Board const& other);
+    Board& operator=(Board const& other);
 
-    unsigned int numRows() const { return num_rows_; }
-    unsigned int numCols() const { return num_cols_; }
+    unsigned int numRows() const;
+    unsigned int numCols() const;
+
+    /** Work out what placing a stone would do, in one pass. */
+    MoveAnalysis analyzeMove(Point point, Stone stone) const;
 
     void place(Point point, Stone stone);
+    /** Place a stone, recording how to take it back in undo. */
+    void place(Point point, Stone stone, PlaceUndo& undo);
+    /** Play a move analyzed on this board as it is now. A suicide
+     * removes the player's own string. */
+    void place(MoveAnalysis const& move);
+    void place(MoveAnalysis const& move, PlaceUndo& undo);
+    /** Take back the place() call that filled in undo. Calls must be
+     * undone in the reverse of the order they were made. */
+    void undo(PlaceUndo const& undo);
     bool willCapture(Point point, Stone stone) const;
     bool willHaveNoLiberties(Point point, Stone stone) const;
     bool isEmpty(Point point) const;
     Stone at(Point point) const;
     GoString stringAt(Point point) const;
+    /** Whether point is an eye for stone, so that filling it in could
+     * only hurt. */
+    bool isEye(Point point, Stone stone) const;
+    /** The 3x3 neighborhood of point; see PatternCode. */
+    PatternCode pattern(Point point) const;
 
     std::vector<Point> const& neighbors(Point p) const;
 
@@ -42,41 +66,46 @@ public:
     /** Compute what the hash would be, after placing this stone. */
     zobrist::hashcode hashAfter(Point point, Stone stone) const;
 
+    /** Masks of the stones of one color, and of the empty points. */
+    Bitboard stones(Stone stone) const;
+    Bitboard const& emptyPoints() const;
+    /** Empty points where a stone of this color would not be suicide,
+     * maintained incrementally. Ko is not considered. */
+    Bitboard const& candidates(Stone stone) const;
+    /** Points where a stone of this color would capture something. */
+    Bitboard captures(Stone stone) const;
+
     /** Iterate over all the strings on the board. */
     StringIter stringsBegin() const;
     StringIter stringsEnd() const;
 
-private:
-    zobrist::ZobristCodes const& zobrist_;
-
-    unsigned int num_rows_;
-    unsigned int num_cols_;
-
-    NeighborTable const* neighbors_;
-
-    zobrist::hashcode hashcode_;
+    /** Call f with the underlying FixedBoard. */
+    template<typename F>
+    decltype(auto) visit(F&& f) const {
+        return std::visit(std::forward<F>(f), impl_);
+    }
+    template<typename F>
+    decltype(auto) visit(F&& f) {
+        return std::visit(std::forward<F>(f), impl_);
+    }
 
-    std::array<StringIdx, MAX_POINTS> grid_;
-    std::array<GoString, MAX_STRINGS> strings_;
-    std::bitset<MAX_STRINGS> used_;
-
-    unsigned int index(Point p) const;
-    void replace(StringIdx new_string);
-    void remove(StringIdx old_string);
-
-    StringIdx getUnusedString();
-    void recycle(StringIdx);
-
-    void validate() const;
+private:
+    using Impl = std::variant<FixedBoard<9>, FixedBoard<13>, FixedBoard<19>>;
 
-    friend class StringIter;
+    Impl impl_;
 };
 
 std::ostream& operator<<(std::ostream&, Board const&);
 
+/** Where the opponent may not immediately play back under simple ko,
+ * if anywhere, once the stone at point has been placed on board.
+ * analysis is that move, as analyzed before it was placed. */
+std::optional<Point> koPointAfter(
+    Board const& board, Point point, MoveAnalysis const& analysis);
+
 class StringIter {
 public:
-    StringIter() : board_(nullptr), i_(0) {}
+    StringIter() : board_(nullptr), i_(0), has_current_(false) {}
     StringIter(Board const* board, unsigned int i);
 
     GoString operator*() const;
@@ -87,6 +116,11 @@ public:
 private:
     Board const* board_;
     unsigned int i_;
+    // Snapshot of the current string, built on demand.
+    mutable GoString current_;
+    mutable bool has_current_;
+
+    GoString const& current() const;
 };
 
 }
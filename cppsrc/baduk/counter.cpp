@@ -2,24 +2,30 @@
 
 namespace baduk {
 
+namespace {
+
+unsigned int countIndex(Point p) {
+    return p.col() + MAX_BOARD_SIZE * p.row();
+}
+
+}
+
 BoardCounter::BoardCounter(unsigned int, unsigned int) {
+    counts_.fill(0);
 }
 
 void BoardCounter::increment(Point p) {
-    const auto ptr = map_.find(p);
-    if (ptr == map_.end()) {
-        map_[p] = 1;
-    } else {
-        ptr->second += 1;
-    }
+    ++counts_[countIndex(p)];
 }
 
 unsigned int BoardCounter::get(Point p) const {
-    const auto ptr = map_.find(p);
-    if (ptr == map_.end()) {
-        return 0;
+    return counts_[countIndex(p)];
+}
+
+void BoardCounter::merge(BoardCounter const& other) {
+    for (unsigned int i = 0; i < MAX_POINTS; ++i) {
+        counts_[i] += other.counts_[i];
     }
-    return ptr->second;
 }
 
 }
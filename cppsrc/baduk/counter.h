@@ -1,8 +1,9 @@
 #ifndef incl_BADUK_COUNTER_H__
 #define incl_BADUK_COUNTER_H__
 
-#include <map>
+#include <array>
 
+#include "dim.h"
 #include "point.h"
 
 namespace baduk {
@@ -13,9 +14,11 @@ public:
 
     void increment(Point p);
     unsigned int get(Point p) const;
+    /** Add in all of other's counts. */
+    void merge(BoardCounter const& other);
 
 private:
-    std::map<Point, unsigned int> map_;
+    std::array<unsigned int, MAX_POINTS> counts_;
 };
 
 }
@@ -7,8 +7,6 @@ namespace baduk {
 // arrays.
 const unsigned int MAX_BOARD_SIZE = 19;
 const auto MAX_POINTS = MAX_BOARD_SIZE * MAX_BOARD_SIZE;
-// Maximum number of distinct strings of stones on the board.
-const auto MAX_STRINGS = MAX_POINTS / 2 + 2;
 
 struct Dim {
     unsigned int width;
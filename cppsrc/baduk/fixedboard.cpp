@@ -0,0 +1,621 @@
+#include <algorithm>
+#include <cassert>
+
+#include "fixedboard.h"
+
+namespace baduk {
+
+class StringPoolEmpty : public std::exception {};
+
+template <unsigned int SIZE>
+FixedBoard<SIZE>::FixedBoard(unsigned int num_rows, unsigned int num_cols) :
+        num_rows_(num_rows),
+        num_cols_(num_cols),
+        neighbors_(getNeighborTable(num_rows, num_cols)),
+        hashcode_(zobrist::emptyBoard()) {
+    initGrid();
+    initStrings();
+    for (unsigned int r = 0; r < num_rows_; ++r) {
+        for (unsigned int c = 0; c < num_cols_; ++c) {
+            refreshCandidate(index(Point(r, c)));
+        }
+    }
+}
+
+template <unsigned int SIZE>
+constexpr typename FixedBoard<SIZE>::ToggleTable
+FixedBoard<SIZE>::makeToggleTable() {
+    ToggleTable t{};
+    for (unsigned int r = 0; r < SIZE; ++r) {
+        for (unsigned int c = 0; c < SIZE; ++c) {
+            const Point p(r, c);
+            for (auto stone : {Stone::black, Stone::white}) {
+                t[static_cast<int>(stone)][index(p)] =
+                    zobrist::emptyCode(p) ^ zobrist::stoneCode(stone, p);
+            }
+        }
+    }
+    return t;
+}
+
+template <unsigned int SIZE>
+constexpr typename FixedBoard<SIZE>::ToggleTable FixedBoard<SIZE>::TOGGLES =
+    FixedBoard<SIZE>::makeToggleTable();
+
+template <unsigned int SIZE>
+void FixedBoard<SIZE>::initGrid() {
+    grid_.fill(OFF_BOARD);
+    colors_.fill(OFF_BOARD_BITS);
+    patterns_.fill(0);
+    for (unsigned int r = 0; r < num_rows_; ++r) {
+        for (unsigned int c = 0; c < num_cols_; ++c) {
+            grid_[index(Point(r, c))] = EMPTY;
+            setColor(index(Point(r, c)), EMPTY_BITS);
+            empty_.set(Point(r, c));
+        }
+    }
+    // setColor only adjusts the patterns; start them off right.
+    for (unsigned int r = 0; r < num_rows_; ++r) {
+        for (unsigned int c = 0; c < num_cols_; ++c) {
+            const auto idx = index(Point(r, c));
+            patterns_[idx + 1] = colorPattern(idx);
+        }
+    }
+}
+
+template <unsigned int SIZE>
+std::uint16_t FixedBoard<SIZE>::colorPattern(int idx) const {
+    unsigned int code = 0;
+    for (unsigned int k = 0; k < PATTERN_OFFSETS.size(); ++k) {
+        code |= static_cast<unsigned int>(colorAt(idx + PATTERN_OFFSETS[k]))
+            << (2 * k);
+    }
+    return static_cast<std::uint16_t>(code);
+}
+
+template <unsigned int SIZE>
+void FixedBoard<SIZE>::initStrings() {
+    for (unsigned int i = 0; i < strings_.size(); ++i) {
+        strings_[i].head = static_cast<PointIdx>(i + 1);
+    }
+    strings_.back().head = EMPTY;
+    free_head_ = 0;
+    num_live_ = 0;
+}
+
+template <unsigned int SIZE>
+MoveAnalysis FixedBoard<SIZE>::analyzeMove(Point point, Stone player) const {
+    MoveAnalysis move;
+    move.point = index(point);
+    move.stone = player;
+    move.occupied = grid_[move.point] != EMPTY;
+    move.has_liberty = false;
+    move.num_adjacent = 0;
+    move.num_merges = 0;
+    move.num_captures = 0;
+    move.num_captured_stones = 0;
+    move.hash = hashcode_ ^ toggle(player, move.point);
+    if (move.occupied) {
+        return move;
+    }
+
+    for (auto offset : NEIGHBOR_OFFSETS) {
+        const auto neighbor_string_idx = grid_[move.point + offset];
+        if (neighbor_string_idx == EMPTY) {
+            move.has_liberty = true;
+            continue;
+        }
+        if (neighbor_string_idx == OFF_BOARD) {
+            continue;
+        }
+        // The same string may touch this point from several sides.
+        const auto end = move.adjacent.begin() + move.num_adjacent;
+        if (std::find(move.adjacent.begin(), end, neighbor_string_idx) !=
+                end) {
+            continue;
+        }
+        const auto pos = move.num_adjacent++;
+        move.adjacent[pos] = neighbor_string_idx;
+
+        const auto& neighbor_string = strings_[neighbor_string_idx];
+        if (neighbor_string.color == player) {
+            move.merges[move.num_merges++] = pos;
+            if (!neighbor_string.isInAtari()) {
+                // This string will still have a liberty after placing
+                // the stone.
+                move.has_liberty = true;
+            }
+        } else if (neighbor_string.isInAtari()) {
+            move.captures[move.num_captures++] = pos;
+            auto p = neighbor_string.head;
+            do {
+                move.hash ^= toggle(neighbor_string.color, p);
+                p = next_[p];
+            } while (p != neighbor_string.head);
+            move.num_captured_stones += neighbor_string.size;
+        }
+    }
+    if (move.isSuicide()) {
+        // Only reached when the rules allow suicide; none of the
+        // player's stones stay on the board.
+        move.hash ^= toggle(player, move.point);
+        for (std::uint8_t i = 0; i < move.num_merges; ++i) {
+            const auto& own_string = strings_[move.adjacent[move.merges[i]]];
+            auto p = own_string.head;
+            do {
+                move.hash ^= toggle(player, p);
+                p = next_[p];
+            } while (p != own_string.head);
+        }
+    }
+    return move;
+}
+
+template <unsigned int SIZE>
+void FixedBoard<SIZE>::place(Point point, Stone player) {
+    placeImpl<false>(analyzeMove(point, player), nullptr);
+}
+
+template <unsigned int SIZE>
+void FixedBoard<SIZE>::place(Point point, Stone player, PlaceUndo& undo) {
+    placeImpl<true>(analyzeMove(point, player), &undo);
+}
+
+template <unsigned int SIZE>
+void FixedBoard<SIZE>::place(MoveAnalysis const& move) {
+    placeImpl<false>(move, nullptr);
+}
+
+template <unsigned int SIZE>
+void FixedBoard<SIZE>::place(MoveAnalysis const& move, PlaceUndo& undo) {
+    placeImpl<true>(move, &undo);
+}
+
+template <unsigned int SIZE>
+template <bool RECORD>
+void FixedBoard<SIZE>::placeImpl(MoveAnalysis const& move, PlaceUndo* undo) {
+    assert(!move.occupied);
+    const auto point_idx = move.point;
+    if constexpr (RECORD) {
+        undo->point = point_idx;
+        undo->stone = move.stone;
+        undo->old_next = next_[point_idx];
+        undo->hash = hashcode_;
+        undo->num_adjacent = move.num_adjacent;
+        undo->num_merges = 0;
+        undo->num_captures = 0;
+        undo->suicide_string = EMPTY;
+        undo->candidates = candidates_;
+        // Remember the neighboring strings before we touch them.
+        for (std::uint8_t i = 0; i < move.num_adjacent; ++i) {
+            undo->adjacent[i] = move.adjacent[i];
+            undo->adjacent_records[i] = strings_[move.adjacent[i]];
+        }
+    }
+    // Points whose candidate status may change: the new stone and its
+    // neighbors, the captured stones, and the lone liberty of any
+    // string that goes into or out of atari.
+    Bitboard changed;
+    changed.set(toPoint(point_idx));
+
+    const auto new_string_idx = getUnusedString();
+    if constexpr (RECORD) {
+        undo->new_string = new_string_idx;
+    }
+    strings_[new_string_idx] =
+        StringRecord{move.stone, point_idx, 1, 0, 0, 0};
+    grid_[point_idx] = new_string_idx;
+    setColor(point_idx, stoneBit(move.stone));
+    next_[point_idx] = point_idx;
+    empty_.reset(toPoint(point_idx));
+
+    // Every (stone, neighbor) pair is a pseudo-liberty, so this goes
+    // through all four sides, not just the distinct strings.
+    for (auto offset : NEIGHBOR_OFFSETS) {
+        const auto neighbor = point_idx + offset;
+        const auto neighbor_string_idx = grid_[neighbor];
+        if (neighbor_string_idx == EMPTY) {
+            addLiberty(new_string_idx, neighbor);
+            changed.set(toPoint(static_cast<PointIdx>(neighbor)));
+        } else if (neighbor_string_idx != OFF_BOARD) {
+            removeLiberty(neighbor_string_idx, point_idx);
+        }
+    }
+
+    auto string_idx = new_string_idx;
+    for (std::uint8_t i = 0; i < move.num_merges; ++i) {
+        string_idx = merge(string_idx, move.adjacent[move.merges[i]], undo);
+    }
+
+    for (std::uint8_t i = 0; i < move.num_captures; ++i) {
+        const auto pos = move.captures[i];
+        assert(strings_[move.adjacent[pos]].hasNoLiberties());
+        remove(move.adjacent[pos], changed);
+        if constexpr (RECORD) {
+            undo->captured[undo->num_captures++] = pos;
+        }
+    }
+
+    if (move.isSuicide()) {
+        if constexpr (RECORD) {
+            undo->suicide_string = string_idx;
+            undo->suicide_head = strings_[string_idx].head;
+        }
+        remove(string_idx, changed);
+    } else {
+        // The new string may now be in atari.
+        markLoneLiberty(strings_[string_idx], changed);
+    }
+    // So may enemy strings that lost a liberty but survived.
+    for (std::uint8_t i = 0; i < move.num_adjacent; ++i) {
+        const auto& adjacent = strings_[move.adjacent[i]];
+        if (adjacent.color != move.stone && !adjacent.hasNoLiberties()) {
+            markLoneLiberty(adjacent, changed);
+        }
+    }
+    changed.forEach([this](Point p) { refreshCandidate(index(p)); });
+
+    // The analysis already counted the captured stones in the hash.
+    hashcode_ = move.hash;
+}
+
+template <unsigned int SIZE>
+void FixedBoard<SIZE>::undo(PlaceUndo const& undo) {
+    if (undo.suicide_string != EMPTY) {
+        // The removed string was the last one recycled; apart from its
+        // head, the record is as it was.
+        const auto string_idx = undo.suicide_string;
+        reclaim(string_idx);
+        strings_[string_idx].head = undo.suicide_head;
+        restoreStones(string_idx, undo.stone);
+    }
+
+    // Put back the captured stones.
+    for (int i = undo.num_captures - 1; i >= 0; --i) {
+        const auto pos = undo.captured[i];
+        const auto string_idx = undo.adjacent[pos];
+        reclaim(string_idx);
+        strings_[string_idx].head = undo.adjacent_records[pos].head;
+        restoreStones(string_idx, undo.adjacent_records[pos].color);
+    }
+
+    // Split the merged strings apart again, newest merge first.
+    for (int i = undo.num_merges - 1; i >= 0; --i) {
+        const auto& merge = undo.merges[i];
+        std::swap(next_[merge.kept_head], next_[merge.absorbed_head]);
+        auto p = merge.absorbed_head;
+        do {
+            grid_[p] = merge.absorbed;
+            p = next_[p];
+        } while (p != merge.absorbed_head);
+        reclaim(merge.absorbed);
+    }
+
+    // Every string whose counters changed, other than the ones that
+    // gained liberties from a capture, was next to the new stone.
+    for (std::uint8_t i = 0; i < undo.num_adjacent; ++i) {
+        strings_[undo.adjacent[i]] = undo.adjacent_records[i];
+    }
+
+    grid_[undo.point] = EMPTY;
+    setColor(undo.point, EMPTY_BITS);
+    empty_.set(toPoint(undo.point));
+    candidates_ = undo.candidates;
+    next_[undo.point] = undo.old_next;
+    recycle(undo.new_string);
+    hashcode_ = undo.hash;
+}
+
+template <unsigned int SIZE>
+void FixedBoard<SIZE>::restoreStones(StringIdx string_idx, Stone color) {
+    // The stone ring is untouched by remove(), so only the grid and the
+    // liberties of the surrounding strings need restoring.
+    const auto head = strings_[string_idx].head;
+    const auto bit = stoneBit(color);
+    auto p = head;
+    do {
+        grid_[p] = string_idx;
+        setColor(p, bit);
+        empty_.reset(toPoint(p));
+        p = next_[p];
+    } while (p != head);
+    do {
+        for (auto offset : NEIGHBOR_OFFSETS) {
+            const auto neighbor_string_idx = grid_[p + offset];
+            if (neighbor_string_idx >= 0 &&
+                    neighbor_string_idx != string_idx) {
+                removeLiberty(neighbor_string_idx, p);
+            }
+        }
+        p = next_[p];
+    } while (p != head);
+}
+
+template <unsigned int SIZE>
+bool FixedBoard<SIZE>::isEye(Point point, Stone stone) const {
+    const auto idx = index(point);
+    const auto bit = stoneBit(stone);
+    // All four neighbors must be friendly stones or off the board.
+    const auto sides =
+        colorAt(idx - STRIDE) & colorAt(idx - 1) &
+        colorAt(idx + 1) & colorAt(idx + STRIDE);
+    if (colorAt(idx) != EMPTY_BITS || !(sides & bit)) {
+        return false;
+    }
+    // We must control 3 out of 4 corners in the middle. On the edge we
+    // must control all the corners that are on the board, which is the
+    // same as counting off-board corners as ours and needing all 4.
+    int held = 0;
+    bool on_edge = false;
+    for (auto offset : DIAGONAL_OFFSETS) {
+        const auto corner = colorAt(idx + offset);
+        held += (corner & bit) != 0;
+        on_edge |= corner == OFF_BOARD_BITS;
+    }
+    return held + !on_edge >= 4;
+}
+
+template <unsigned int SIZE>
+bool FixedBoard<SIZE>::willCapture(Point point, Stone player) const {
+    return analyzeMove(point, player).isCapture();
+}
+
+template <unsigned int SIZE>
+bool FixedBoard<SIZE>::willHaveNoLiberties(Point point, Stone player) const {
+    // Does NOT check if it is a capture! Call willCapture first.
+    return !analyzeMove(point, player).has_liberty;
+}
+
+template <unsigned int SIZE>
+void FixedBoard<SIZE>::addLiberty(StringIdx string_idx, PointIdx liberty) {
+    auto& record = strings_[string_idx];
+    ++record.num_pseudo_libs;
+    record.lib_sum += liberty;
+    record.lib_sum_sq += liberty * liberty;
+}
+
+template <unsigned int SIZE>
+void FixedBoard<SIZE>::removeLiberty(StringIdx string_idx, PointIdx liberty) {
+    auto& record = strings_[string_idx];
+    --record.num_pseudo_libs;
+    record.lib_sum -= liberty;
+    record.lib_sum_sq -= liberty * liberty;
+}
+
+template <unsigned int SIZE>
+StringIdx FixedBoard<SIZE>::merge(StringIdx a, StringIdx b, PlaceUndo* undo) {
+    // Relabel the smaller string, so the cost is proportional to its
+    // size and not to the size of the merged string.
+    if (strings_[a].size < strings_[b].size) {
+        std::swap(a, b);
+    }
+    auto& keep = strings_[a];
+    auto const& absorb = strings_[b];
+    if (undo) {
+        undo->merges[undo->num_merges++] =
+            PlaceUndo::Merge{a, b, keep.head, absorb.head};
+    }
+    auto p = absorb.head;
+    do {
+        grid_[p] = a;
+        p = next_[p];
+    } while (p != absorb.head);
+    // Splice the two rings together.
+    std::swap(next_[keep.head], next_[absorb.head]);
+
+    keep.size += absorb.size;
+    keep.num_pseudo_libs += absorb.num_pseudo_libs;
+    keep.lib_sum += absorb.lib_sum;
+    keep.lib_sum_sq += absorb.lib_sum_sq;
+    recycle(b);
+    return a;
+}
+
+template <unsigned int SIZE>
+Bitboard FixedBoard<SIZE>::stones(Stone stone) const {
+    Bitboard rv;
+    for (unsigned int r = 0; r < num_rows_; ++r) {
+        for (unsigned int c = 0; c < num_cols_; ++c) {
+            const auto string_idx = grid_[index(Point(r, c))];
+            if (string_idx >= 0 && strings_[string_idx].color == stone) {
+                rv.set(Point(r, c));
+            }
+        }
+    }
+    return rv;
+}
+
+template <unsigned int SIZE>
+Bitboard FixedBoard<SIZE>::captures(Stone stone) const {
+    Bitboard rv;
+    for (StringIdx i = 0; i < num_live_; ++i) {
+        const auto& record = strings_[live_[i]];
+        if (record.color != stone && record.isInAtari()) {
+            rv.set(toPoint(record.loneLiberty()));
+        }
+    }
+    return rv;
+}
+
+template <unsigned int SIZE>
+GoString FixedBoard<SIZE>::stringAt(Point p) const {
+    return makeGoString(grid_[index(p)]);
+}
+
+template <unsigned int SIZE>
+GoString FixedBoard<SIZE>::makeGoString(StringIdx string_idx) const {
+    PointSet stones;
+    PointSet liberties;
+    const auto& record = strings_[string_idx];
+    auto p = record.head;
+    do {
+        stones.add(toPoint(p));
+        for (auto offset : NEIGHBOR_OFFSETS) {
+            if (grid_[p + offset] == EMPTY) {
+                liberties.add(toPoint(p + offset));
+            }
+        }
+        p = next_[p];
+    } while (p != record.head);
+    return GoString(record.color, stones, liberties);
+}
+
+template <unsigned int SIZE>
+void FixedBoard<SIZE>::remove(StringIdx old_string_idx, Bitboard& changed) {
+    const auto& old_string = strings_[old_string_idx];
+    auto point_idx = old_string.head;
+    do {
+        // Every neighboring stone from another string gains this point
+        // as a pseudo-liberty, which takes it out of atari.
+        for (auto offset : NEIGHBOR_OFFSETS) {
+            const auto neighbor_string_idx = grid_[point_idx + offset];
+            if (neighbor_string_idx >= 0 &&
+                    neighbor_string_idx != old_string_idx) {
+                markLoneLiberty(strings_[neighbor_string_idx], changed);
+                addLiberty(neighbor_string_idx, point_idx);
+            }
+        }
+
+        grid_[point_idx] = EMPTY;
+        setColor(point_idx, EMPTY_BITS);
+        empty_.set(toPoint(point_idx));
+        changed.set(toPoint(point_idx));
+        point_idx = next_[point_idx];
+    } while (point_idx != old_string.head);
+    recycle(old_string_idx);
+}
+
+template <unsigned int SIZE>
+void FixedBoard<SIZE>::markLoneLiberty(
+        StringRecord const& record, Bitboard& changed) const {
+    if (record.isInAtari()) {
+        changed.set(toPoint(record.loneLiberty()));
+    }
+}
+
+template <unsigned int SIZE>
+void FixedBoard<SIZE>::refreshCandidate(PointIdx idx) {
+    const auto p = toPoint(idx);
+    auto& black = candidates_[static_cast<int>(Stone::black)];
+    auto& white = candidates_[static_cast<int>(Stone::white)];
+    black.reset(p);
+    white.reset(p);
+    if (grid_[idx] != EMPTY) {
+        return;
+    }
+    // A stone here has a liberty if there is an empty neighbor, or a
+    // friendly string that is not in atari; it captures if an enemy
+    // string is in atari.
+    bool black_ok = false;
+    bool white_ok = false;
+    for (auto offset : NEIGHBOR_OFFSETS) {
+        const auto neighbor_string_idx = grid_[idx + offset];
+        if (neighbor_string_idx == EMPTY) {
+            black_ok = white_ok = true;
+            break;
+        }
+        if (neighbor_string_idx == OFF_BOARD) {
+            continue;
+        }
+        const auto& neighbor_string = strings_[neighbor_string_idx];
+        const bool owner_ok = !neighbor_string.isInAtari();
+        if (neighbor_string.color == Stone::black) {
+            black_ok = black_ok || owner_ok;
+            white_ok = white_ok || !owner_ok;
+        } else {
+            white_ok = white_ok || owner_ok;
+            black_ok = black_ok || !owner_ok;
+        }
+    }
+    if (black_ok) {
+        black.set(p);
+    }
+    if (white_ok) {
+        white.set(p);
+    }
+}
+
+template <unsigned int SIZE>
+void FixedBoard<SIZE>::validate() const {
+    for (PointIdx p = 0; p < GRID_SIZE; ++p) {
+        const auto string_idx = grid_[p];
+        if (string_idx < 0) {
+            continue;
+        }
+        assert(live_[live_pos_[string_idx]] == string_idx);
+        const auto& record = strings_[string_idx];
+        // Walk the ring, recounting stones and pseudo-liberties.
+        int size = 0;
+        int num_pseudo_libs = 0;
+        auto q = record.head;
+        do {
+            assert(grid_[q] == string_idx);
+            ++size;
+            for (auto offset : NEIGHBOR_OFFSETS) {
+                if (grid_[q + offset] == EMPTY) {
+                    ++num_pseudo_libs;
+                }
+            }
+            q = next_[q];
+        } while (q != record.head);
+        assert(size == record.size);
+        assert(num_pseudo_libs == record.num_pseudo_libs);
+    }
+    for (unsigned int r = 0; r < num_rows_; ++r) {
+        for (unsigned int c = 0; c < num_cols_; ++c) {
+            const Point p(r, c);
+            assert(empty_.get(p) == isEmpty(p));
+            assert(colorAt(index(p)) ==
+                (isEmpty(p) ? EMPTY_BITS : stoneBit(at(p))));
+            assert(patterns_[index(p) + 1] == colorPattern(index(p)));
+            // Only read by the assert.
+            for ([[maybe_unused]] auto stone : {Stone::black, Stone::white}) {
+                assert(candidates(stone).get(p) ==
+                    analyzeMove(p, stone).isLegal());
+            }
+        }
+    }
+}
+
+template <unsigned int SIZE>
+zobrist::hashcode FixedBoard<SIZE>::hashAfter(Point point, Stone stone) const {
+    return analyzeMove(point, stone).hash;
+}
+
+template <unsigned int SIZE>
+StringIdx FixedBoard<SIZE>::getUnusedString() {
+    if (free_head_ == EMPTY) {
+        throw StringPoolEmpty();
+    }
+    const auto string_idx = free_head_;
+    free_head_ = strings_[string_idx].head;
+    live_pos_[string_idx] = static_cast<LivePos>(num_live_);
+    live_[num_live_++] = string_idx;
+    return string_idx;
+}
+
+template <unsigned int SIZE>
+void FixedBoard<SIZE>::recycle(StringIdx string_idx) {
+    // Fill the gap in live_ with the last entry.
+    const auto pos = live_pos_[string_idx];
+    const auto last = live_[--num_live_];
+    live_[pos] = last;
+    live_pos_[last] = pos;
+
+    strings_[string_idx].head = free_head_;
+    free_head_ = string_idx;
+}
+
+template <unsigned int SIZE>
+void FixedBoard<SIZE>::reclaim([[maybe_unused]] StringIdx string_idx) {
+    // Undo replays recycle() calls in reverse, so the slot we want back
+    // is always on top of the stack.
+    assert(free_head_ == string_idx);
+    getUnusedString();
+}
+
+template class FixedBoard<9>;
+template class FixedBoard<13>;
+template class FixedBoard<19>;
+
+}
@@ -0,0 +1,338 @@
+#ifndef incl_BADUK_FIXEDBOARD_H__
+#define incl_BADUK_FIXEDBOARD_H__
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "bitboard.h"
+#include "dim.h"
+#include "gostring.h"
+#include "neighbor.h"
+#include "pattern.h"
+#include "point.h"
+#include "zobrist/zobrist.h"
+
+namespace baduk {
+
+using StringIdx = std::int16_t;
+const StringIdx EMPTY = -1;
+const StringIdx OFF_BOARD = -2;
+
+// Index of a point in the padded grid.
+using PointIdx = std::int16_t;
+
+// What's at a point, as bits. Each color has its own bit, and off-board
+// points have both, so the edge of the board counts as friendly to
+// either color.
+using ColorBits = std::uint8_t;
+const ColorBits EMPTY_BITS = 0;
+const ColorBits OFF_BOARD_BITS = 3;
+
+inline ColorBits stoneBit(Stone stone) {
+    return static_cast<ColorBits>(1 << static_cast<int>(stone));
+}
+
+// Bookkeeping for one string of stones. The stones themselves form a
+// circular linked list through FixedBoard::next_, starting at head.
+//
+// Liberties are counted as pseudo-liberties: every (stone, empty
+// neighbor) pair counts once, so a liberty touching three stones of the
+// string is counted three times. Alongside the count we keep the sum and
+// sum of squares of the liberty indices; the string is in atari exactly
+// when all of its pseudo-liberties are the same point, which is when
+// count * sum_sq == sum * sum.
+//
+// The record is kept to 16 bytes so that copying a board stays cheap.
+struct StringRecord {
+    Stone color;
+    PointIdx head;
+    std::int16_t size;
+    std::int16_t num_pseudo_libs;
+    std::int32_t lib_sum;
+    std::int32_t lib_sum_sq;
+
+    bool hasNoLiberties() const { return num_pseudo_libs == 0; }
+    bool isInAtari() const {
+        return num_pseudo_libs > 0 &&
+            static_cast<long long>(num_pseudo_libs) * lib_sum_sq ==
+            static_cast<long long>(lib_sum) * lib_sum;
+    }
+    /** The only liberty of a string in atari. */
+    PointIdx loneLiberty() const {
+        return static_cast<PointIdx>(lib_sum / num_pseudo_libs);
+    }
+};
+
+// Everything FixedBoard::undo needs to take back one call to
+// FixedBoard::place.
+struct PlaceUndo {
+    struct Merge {
+        StringIdx kept;
+        StringIdx absorbed;
+        PointIdx kept_head;
+        PointIdx absorbed_head;
+    };
+
+    PointIdx point;
+    Stone stone;
+    // Ring pointer at point before the stone was placed.
+    PointIdx old_next;
+    StringIdx new_string;
+    zobrist::hashcode hash;
+    // The strings next to point, as they were before the move.
+    std::uint8_t num_adjacent;
+    std::array<StringIdx, 4> adjacent;
+    std::array<StringRecord, 4> adjacent_records;
+    std::uint8_t num_merges;
+    std::array<Merge, 4> merges;
+    // Positions in adjacent of the strings that were captured.
+    std::uint8_t num_captures;
+    std::array<std::uint8_t, 4> captured;
+    // The string that was removed, if the move was suicide.
+    StringIdx suicide_string;
+    PointIdx suicide_head;
+    std::array<Bitboard, 2> candidates;
+};
+
+// What placing one stone would do, worked out in a single pass over its
+// neighbors without changing the board. Legality checks read it, and
+// FixedBoard::place can consume it instead of repeating the work. It is
+// only valid until the board changes.
+struct MoveAnalysis {
+    PointIdx point;
+    Stone stone;
+    bool occupied;
+    // The new stone has an empty neighbor, or joins a string that has
+    // a liberty other than point.
+    bool has_liberty;
+    // The distinct strings next to point.
+    std::uint8_t num_adjacent;
+    std::array<StringIdx, 4> adjacent;
+    // Positions in adjacent of the strings the stone joins, and of the
+    // strings it captures.
+    std::uint8_t num_merges;
+    std::array<std::uint8_t, 4> merges;
+    std::uint8_t num_captures;
+    std::array<std::uint8_t, 4> captures;
+    std::int16_t num_captured_stones;
+    // Board hash after the move. For a suicide, that's with the
+    // player's own string removed.
+    zobrist::hashcode hash;
+
+    bool isCapture() const { return num_captures > 0; }
+    bool isSuicide() const { return !has_liberty && num_captures == 0; }
+    /** Ignores ko, which depends on the game history. */
+    bool isLegal() const { return !occupied && !isSuicide(); }
+    /** Takes a single stone and leaves the new stone alone in atari,
+     * so the opponent can't immediately take back under simple ko. */
+    bool isKoCapture() const {
+        return num_captured_stones == 1 && num_merges == 0 && !has_liberty;
+    }
+};
+
+// A board whose storage and neighbor offsets are fixed at compile time.
+// SIZE is the largest board it can hold; the actual number of rows and
+// columns may be smaller; everything outside them is off-board padding.
+// Board picks the smallest instantiation that fits, so 9x9 games never
+// touch 19x19-sized arrays.
+template <unsigned int SIZE>
+class FixedBoard {
+public:
+    static_assert(SIZE <= MAX_BOARD_SIZE, "board too large");
+
+    // The grid is stored as a one-dimensional array with a border of
+    // off-board sentinels. Each row is followed by one padding cell,
+    // which doubles as the left border of the next row, plus a full
+    // padding row above and below the board.
+    static constexpr int STRIDE = SIZE + 1;
+    static constexpr int GRID_SIZE = (SIZE + 2) * STRIDE;
+    // Maximum number of distinct strings of stones on the board. Every
+    // string needs a liberty and an empty point can be the liberty of
+    // at most four strings, so at most 4/5 of the points are strings.
+    // One more slot is needed while a move is being placed, before its
+    // captures are removed.
+    static constexpr unsigned int NUM_STRINGS = SIZE * SIZE * 4 / 5 + 2;
+    static constexpr std::array<int, 4> NEIGHBOR_OFFSETS = {
+        -STRIDE, -1, 1, STRIDE};
+    static constexpr std::array<int, 4> DIAGONAL_OFFSETS = {
+        -STRIDE - 1, -STRIDE + 1, STRIDE - 1, STRIDE + 1};
+    // The neighbors that make up a PatternCode, in order.
+    static constexpr std::array<int, 8> PATTERN_OFFSETS = {
+        -STRIDE, -1, 1, STRIDE,
+        -STRIDE - 1, -STRIDE + 1, STRIDE - 1, STRIDE + 1};
+
+    FixedBoard(unsigned int num_rows, unsigned int num_cols);
+
+    unsigned int numRows() const { return num_rows_; }
+    unsigned int numCols() const { return num_cols_; }
+
+    MoveAnalysis analyzeMove(Point point, Stone stone) const;
+
+    void place(Point point, Stone stone);
+    /** Place a stone, recording how to take it back in undo. */
+    void place(Point point, Stone stone, PlaceUndo& undo);
+    /** Play a move analyzed on this board as it is now. A suicide
+     * removes the player's own string. */
+    void place(MoveAnalysis const& move);
+    void place(MoveAnalysis const& move, PlaceUndo& undo);
+    /** Take back the place() call that filled in undo. Calls must be
+     * undone in the reverse of the order they were made. */
+    void undo(PlaceUndo const& undo);
+    bool willCapture(Point point, Stone stone) const;
+    bool willHaveNoLiberties(Point point, Stone stone) const;
+    bool isEmpty(Point point) const { return grid_[index(point)] == EMPTY; }
+    Stone at(Point point) const {
+        return strings_[grid_[index(point)]].color;
+    }
+    GoString stringAt(Point point) const;
+    /** Whether point is an eye for stone, so that filling it in could
+     * only hurt: an empty point whose neighbors are all stone, with
+     * enough of its diagonals held too. */
+    bool isEye(Point point, Stone stone) const;
+    /** The 3x3 neighborhood of point. The colors are kept up to date
+     * as stones come and go; only the atari flags are read off the
+     * neighboring strings. */
+    PatternCode pattern(Point point) const {
+        const auto idx = index(point);
+        PatternCode code = patterns_[idx + 1];
+        for (unsigned int k = 0; k < NEIGHBOR_OFFSETS.size(); ++k) {
+            const auto string_idx = grid_[idx + NEIGHBOR_OFFSETS[k]];
+            if (string_idx >= 0 && strings_[string_idx].isInAtari()) {
+                code |= PatternCode(1) << (16 + k);
+            }
+        }
+        return code;
+    }
+
+    std::vector<Point> const& neighbors(Point p) const {
+        return neighbors_->get(p);
+    }
+
+    zobrist::hashcode hash() const { return hashcode_; }
+    /** Compute what the hash would be, after placing this stone. */
+    zobrist::hashcode hashAfter(Point point, Stone stone) const;
+
+    /** Masks of the stones of one color, and of the empty points. */
+    Bitboard stones(Stone stone) const;
+    Bitboard const& emptyPoints() const { return empty_; }
+    /** Empty points where a stone of this color would not be suicide.
+     * Kept up to date as stones are placed and captured; ko is left to
+     * the caller. */
+    Bitboard const& candidates(Stone stone) const {
+        return candidates_[static_cast<int>(stone)];
+    }
+    /** Points where a stone of this color would capture: the lone
+     * liberties of the enemy strings in atari. */
+    Bitboard captures(Stone stone) const;
+
+    unsigned int numStrings() const { return num_live_; }
+    /** Snapshot of the i'th string on the board, in no particular
+     * order. */
+    GoString liveString(unsigned int i) const {
+        return makeGoString(live_[i]);
+    }
+
+    /** Assert that the incrementally maintained state (string records,
+     * colors, patterns and candidate sets) matches a recount from the
+     * grid. Slow, and does nothing under NDEBUG; for tests. */
+    void validate() const;
+
+    static constexpr PointIdx index(Point p) {
+        return static_cast<PointIdx>(
+            STRIDE * static_cast<int>(p.row() + 1) +
+            static_cast<int>(p.col()));
+    }
+    static constexpr Point toPoint(PointIdx idx) {
+        return Point(idx / STRIDE - 1, idx % STRIDE);
+    }
+
+private:
+    // Hash codes for flipping each point between empty and a stone of
+    // each color, laid out like the grid. Worked out at compile time.
+    using ToggleTable = std::array<std::array<zobrist::hashcode, GRID_SIZE>, 2>;
+    using LivePos = std::conditional_t<
+        NUM_STRINGS <= 256, std::uint8_t, std::uint16_t>;
+
+    unsigned int num_rows_;
+    unsigned int num_cols_;
+
+    NeighborTable const* neighbors_;
+
+    zobrist::hashcode hashcode_;
+
+    std::array<StringIdx, GRID_SIZE> grid_;
+    // The color of every point in grid_, for reading neighborhoods
+    // without going through the string records. Shifted along by one,
+    // so the top-left point's diagonal, at index -1, is in range.
+    std::array<ColorBits, GRID_SIZE + 1> colors_;
+    // The colors around every point, packed as in PatternCode and
+    // shifted like colors_. Only on-board entries are meaningful.
+    std::array<std::uint16_t, GRID_SIZE + 1> patterns_;
+    // Next stone in the same string, for every occupied point.
+    std::array<PointIdx, GRID_SIZE> next_;
+    std::array<StringRecord, NUM_STRINGS> strings_;
+    // Unused slots in strings_ form a stack, linked through their head
+    // fields.
+    StringIdx free_head_;
+    // Slots in use, densely packed, and each slot's position in live_.
+    std::array<StringIdx, NUM_STRINGS> live_;
+    std::array<LivePos, NUM_STRINGS> live_pos_;
+    StringIdx num_live_;
+
+    Bitboard empty_;
+    std::array<Bitboard, 2> candidates_;
+
+    static constexpr ToggleTable makeToggleTable();
+    static const ToggleTable TOGGLES;
+
+    static zobrist::hashcode toggle(Stone stone, PointIdx idx) {
+        return TOGGLES[static_cast<int>(stone)][idx];
+    }
+
+    ColorBits colorAt(int idx) const { return colors_[idx + 1]; }
+    void setColor(int idx, ColorBits bits) {
+        const int change = colors_[idx + 1] ^ bits;
+        colors_[idx + 1] = bits;
+        // idx is neighbor k of idx - PATTERN_OFFSETS[k].
+        for (unsigned int k = 0; k < PATTERN_OFFSETS.size(); ++k) {
+            patterns_[idx - PATTERN_OFFSETS[k] + 1] ^=
+                static_cast<std::uint16_t>(change << (2 * k));
+        }
+    }
+    // Works out the colors around idx from colors_.
+    std::uint16_t colorPattern(int idx) const;
+
+    void initGrid();
+    void initStrings();
+    // The work of place(). Only fills in undo when RECORD is set, so
+    // moves that will never be taken back skip the bookkeeping.
+    template <bool RECORD>
+    void placeImpl(MoveAnalysis const& move, PlaceUndo* undo);
+    void addLiberty(StringIdx string_idx, PointIdx liberty);
+    void removeLiberty(StringIdx string_idx, PointIdx liberty);
+    // Records the merge in undo, unless it's null.
+    StringIdx merge(StringIdx a, StringIdx b, PlaceUndo* undo);
+    // Marks in changed the points whose candidate status may change.
+    void remove(StringIdx old_string, Bitboard& changed);
+    // Puts a removed string's stones back on the board. The string's
+    // record may be out of date until undo() finishes, so the caller
+    // says what color they are.
+    void restoreStones(StringIdx string_idx, Stone color);
+    void refreshCandidate(PointIdx idx);
+    void markLoneLiberty(StringRecord const& record, Bitboard& changed) const;
+    GoString makeGoString(StringIdx string_idx) const;
+
+    StringIdx getUnusedString();
+    void recycle(StringIdx);
+    void reclaim(StringIdx);
+};
+
+extern template class FixedBoard<9>;
+extern template class FixedBoard<13>;
+extern template class FixedBoard<19>;
+
+}
+
+#endif
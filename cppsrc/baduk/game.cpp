@@ -3,12 +3,11 @@
 #include <unordered_set>
 
 #include "game.h"
-#include "statichash.h"
+#include "persistenthash.h"
+#include "referee.h"
 
 namespace baduk {
 
-const unsigned int HASH_SIZE = 1493;
-
 struct IsResignImpl {
     bool operator()(Play const&) { return false; }
     bool operator()(Pass const&) { return false; }
@@ -33,15 +32,39 @@ Point getPoint(Move const& move) {
     return std::get<Play>(move).point();
 }
 
+class GameStateImpl;
+
+// States go on the heap as usual unless the game was started in an
+// arena.
+template<typename... Args>
+std::shared_ptr<GameStateImpl> makeState(GameArena* arena, Args&&... args) {
+    if (arena == nullptr) {
+        return std::make_shared<GameStateImpl>(std::forward<Args>(args)...);
+    }
+    return std::allocate_shared<GameStateImpl>(
+        std::pmr::polymorphic_allocator<GameStateImpl>(arena->resource()),
+        std::forward<Args>(args)...);
+}
+
 class GameStateImpl :
     public GameState,
     public std::enable_shared_from_this<GameStateImpl> {
 public:
-    GameStateImpl(Board const& board, Stone next_player, float komi) :
+    GameStateImpl(
+            Board const& board, Stone next_player, float komi,
+            Rules const& rules, GameArena* arena) :
         board_(board),
         next_player_(next_player),
+        // Every later history is inserted from this one, so it decides
+        // where the trie nodes of the whole game go.
+        previous_states_(
+            arena == nullptr ?
+                std::pmr::new_delete_resource() :
+                arena->resource()),
         komi_(komi),
-        num_moves_(0) {}
+        num_moves_(0),
+        rules_(rules),
+        arena_(arena) {}
 
     GameStateImpl(
             Stone next_player,
@@ -52,16 +75,24 @@ public:
         last_move_(last_move),
         prev_state_(parent),
         komi_(parent->komi()),
-        num_moves_(parent->numMoves() + 1) {
+        num_moves_(parent->numMoves() + 1),
+        rules_(parent->rules_),
+        arena_(parent->arena_) {
 
         if (std::holds_alternative<Play>(last_move)) {
-            board_.place(
-                std::get<Play>(last_move).point(),
-                other(next_player_));
+            const auto point = std::get<Play>(last_move).point();
+            const auto move = board_.analyzeMove(point, other(next_player_));
+            board_.place(move);
+            if (rules_.ko == KoRule::simple) {
+                ko_point_ = koPointAfter(board_, point, move);
+            }
         }
 
-        previous_states_ = parent->previous_states_;
-        previous_states_.insert(prev_state_->hash());
+        // Simple ko needs no history at all.
+        if (rules_.ko != KoRule::simple) {
+            previous_states_ = parent->previous_states_.insert(
+                parent->referee().historyHash());
+        }
     }
 
     ~GameStateImpl() override {}
@@ -72,26 +103,21 @@ public:
     bool hasLastMove() const override { return bool(last_move_); }
     Move lastMove() const override { return last_move_.value(); }
     float komi() const override { return komi_; }
+    Rules const& rules() const override { return rules_; }
     int numMoves() const override { return num_moves_; }
 
     zobrist::hashcode hash() const override {
-        const auto player_hash = next_player_ == Stone::black ?
-            zobrist::BLACK_TO_PLAY :
-            zobrist::WHITE_TO_PLAY;
-        return board_.hash() ^ player_hash;
+        return stateHash(board_.hash(), next_player_);
     }
 
     bool operator==(GameState const& b) const override {
-        auto other = dynamic_cast<GameStateImpl const&>(b);
+        auto const& other = dynamic_cast<GameStateImpl const&>(b);
         return board_ == other.board_ && next_player_ == other.next_player_;
     }
 
     std::shared_ptr<GameState> applyMove(Move const& move) const override {
-        return std::make_shared<GameStateImpl>(
-            other(next_player_),
-            shared_from_this(),
-            move
-        );
+        return makeState(
+            arena_, other(next_player_), shared_from_this(), move);
     }
 
     bool isOver() const override {
@@ -118,74 +144,16 @@ public:
         return false;
     }
 
-    struct CheckLegal {
-        GameStateImpl const* game_state;
-
-        CheckLegal(GameStateImpl const* parent) : game_state(parent) {}
-
-        bool operator()(Play const& play) {
-            const auto point = play.point();
-            const auto player = game_state->next_player_;
-            if (!game_state->board_.isEmpty(point)) {
-                return false;
-            }
-
-            // Ko.
-            if (game_state->board_.willCapture(point, player)) {
-                if (game_state->willViolateKo(point)) {
-                    return false;
-                }
-            } else if (game_state->board_.willHaveNoLiberties(point, player)) {
-                return false;
-            }
-
-            return true;
-        }
-
-        bool operator()(Pass const&) {
-            // Always legal.
-            return true;
-        }
-
-        bool operator()(Resign const&) {
-            // Always legal.
-            return true;
-        }
-    };
-
     bool isMoveLegal(Move const& move) const override {
-        return std::visit(CheckLegal(this), move);
+        return referee().isMoveLegal(move);
     }
 
-    struct CheckViolatesKo {
-        GameStateImpl const* game_state;
-
-        CheckViolatesKo(GameStateImpl const* parent) : game_state(parent) {}
-
-        bool operator()(Play const& play) {
-            const auto point = play.point();
-            const auto player = game_state->next_player_;
-            if (!game_state->board_.isEmpty(point)) {
-                return false;
-            }
-
-            if (game_state->board_.willCapture(point, player)) {
-                return game_state->willViolateKo(point);
-            }
-            return false;
-        }
-
-        bool operator()(Pass const&) {
-            return false;
-        }
-
-        bool operator()(Resign const&) {
-            return false;
-        }
-    };
-
     bool doesMoveViolateKo(Move const& move) const override {
-        return std::visit(CheckViolatesKo(this), move);
+        return referee().doesMoveViolateKo(move);
+    }
+
+    Bitboard legalMoves() const override {
+        return referee().legalMoves();
     }
 
 private:
@@ -193,42 +161,47 @@ private:
     Stone next_player_;
     std::optional<Move> last_move_;
     std::shared_ptr<const GameStateImpl> prev_state_;
-    StaticHash<zobrist::hashcode, HASH_SIZE> previous_states_;
+    // Hashes of the earlier boards under positional superko, or of the
+    // earlier states under situational superko. Shared with the parent
+    // state, apart from the newest entry.
+    PersistentHashSet previous_states_;
     float komi_;
     int num_moves_;
-
-    bool willViolateKo(Point point) const {
-        // Find the hash of the next state, without actually computing
-        // the full board position.
-        const auto next_board_hash = board_.hashAfter(point, next_player_);
-        const auto next_player_hash =
-            next_player_ == Stone::black ?
-                zobrist::WHITE_TO_PLAY :
-                zobrist::BLACK_TO_PLAY;
-        const auto next_state_hash = next_board_hash ^ next_player_hash;
-
-        return previous_states_.contains(next_state_hash);
+    Rules rules_;
+    // Under simple ko, the point where the opponent just took a ko.
+    std::optional<Point> ko_point_;
+    // Where to allocate the states that follow this one, or null for
+    // the heap.
+    GameArena* arena_;
+
+    Referee<PersistentHashSet> referee() const {
+        return Referee<PersistentHashSet>(
+            board_, next_player_, rules_, ko_point_, previous_states_);
     }
 };
 
 
-std::shared_ptr<const GameState> newGame(unsigned int board_size, float komi) {
-    return std::shared_ptr<const GameState>(
-        std::make_shared<const GameStateImpl>(
-            Board(board_size, board_size),
-            Stone::black,
-            komi
-        )
+std::shared_ptr<const GameState> newGame(
+        unsigned int board_size, float komi, Rules const& rules,
+        GameArena* arena) {
+    return makeState(
+        arena,
+        Board(board_size, board_size),
+        Stone::black,
+        komi,
+        rules,
+        arena
     );
 }
 
 std::shared_ptr<const GameState> gameFromBoard(
-        Board board, Stone next_player, float komi) {
-    return std::shared_ptr<const GameState>(
-        std::make_shared<const GameStateImpl>(
-            board, next_player, komi
-        )
-    );
+        Board board, Stone next_player, float komi, Rules const& rules,
+        GameArena* arena) {
+    return makeState(arena, board, next_player, komi, rules, arena);
+}
+
+std::size_t gameStateSize() {
+    return sizeof(GameStateImpl);
 }
 
 }
@@ -4,6 +4,7 @@
 #include <memory>
 #include <variant>
 
+#include "arena.h"
 #include "board.h"
 #include "zobrist/zobrist.h"
 
@@ -30,6 +31,23 @@ bool isResign(Move const& move);
 // Throws an exception if the Move is not a Play
 Point getPoint(Move const& move);
 
+enum class KoRule {
+    // Only the immediate recapture of a single stone is forbidden.
+    simple,
+    // No move may recreate an earlier board position.
+    positional,
+    // No move may recreate an earlier board position with the same
+    // player to move.
+    situational
+};
+
+struct Rules {
+    KoRule ko = KoRule::situational;
+    // Whether a move may take the player's own last liberty, removing
+    // their string.
+    bool allow_suicide = false;
+};
+
 class GameState {
 public:
     virtual ~GameState() {}
@@ -40,10 +58,15 @@ public:
     virtual std::shared_ptr<GameState> applyMove(Move const& move) const = 0;
     virtual bool isMoveLegal(Move const& move) const = 0;
     virtual bool doesMoveViolateKo(Move const& move) const = 0;
+    /** Every point the next player can legally play, worked out for
+     * the whole board at once. Passing and resigning are always
+     * legal. */
+    virtual Bitboard legalMoves() const = 0;
     virtual bool isOver() const = 0;
     virtual bool hasLastMove() const = 0;
     virtual Move lastMove() const = 0;
     virtual float komi() const = 0;
+    virtual Rules const& rules() const = 0;
     virtual int numMoves() const = 0;
 
     virtual bool operator==(GameState const&) const = 0;
@@ -51,10 +74,20 @@ public:
     virtual zobrist::hashcode hash() const = 0;
 };
 
-std::shared_ptr<const GameState> newGame(unsigned int board_size, float komi);
+/** Start a game. Given an arena, the new state and every state that
+ * follows from it are allocated there instead of on the heap. */
+std::shared_ptr<const GameState> newGame(
+    unsigned int board_size, float komi,
+    Rules const& rules = Rules(),
+    GameArena* arena = nullptr);
 std::shared_ptr<const GameState> gameFromBoard(
     Board board, Stone next_player,
-    float komi);
+    float komi,
+    Rules const& rules = Rules(),
+    GameArena* arena = nullptr);
+
+// Number of bytes each new game state occupies, for benchmarking.
+std::size_t gameStateSize();
 
 }
 
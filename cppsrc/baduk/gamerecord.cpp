@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <cassert>
+
+#include "gamerecord.h"
+
+namespace baduk {
+
+namespace {
+
+const MoveCode PASS_CODE = MAX_POINTS;
+const MoveCode RESIGN_CODE = MAX_POINTS + 1;
+const MoveCode WHITE_BIT = 0x8000;
+
+MoveCode encodePoint(Point point) {
+    return static_cast<MoveCode>(point.row() * MAX_BOARD_SIZE + point.col());
+}
+
+Point decodePoint(MoveCode code) {
+    return Point(code / MAX_BOARD_SIZE, code % MAX_BOARD_SIZE);
+}
+
+}
+
+MoveCode encodeMove(Move const& move) {
+    if (isPass(move)) {
+        return PASS_CODE;
+    }
+    if (isResign(move)) {
+        return RESIGN_CODE;
+    }
+    return encodePoint(getPoint(move));
+}
+
+Move decodeMove(MoveCode code) {
+    if (code == PASS_CODE) {
+        return Pass();
+    }
+    if (code == RESIGN_CODE) {
+        return Resign();
+    }
+    return Play(decodePoint(code));
+}
+
+GameRecord::GameRecord(
+        unsigned int num_rows, unsigned int num_cols, float komi,
+        Rules const& rules) :
+    rules_(rules),
+    komi_(komi),
+    num_rows_(static_cast<std::uint8_t>(num_rows)),
+    num_cols_(static_cast<std::uint8_t>(num_cols)),
+    first_player_(Stone::black) {}
+
+GameRecord::GameRecord(GameState const& game_state) :
+    rules_(game_state.rules()),
+    komi_(game_state.komi()),
+    num_rows_(static_cast<std::uint8_t>(game_state.board().numRows())),
+    num_cols_(static_cast<std::uint8_t>(game_state.board().numCols())) {
+    // Walk back to the start of the game, collecting the moves.
+    auto start = &game_state;
+    while (start->prevState() != nullptr) {
+        moves_.push_back(encodeMove(start->lastMove()));
+        start = start->prevState();
+    }
+    std::reverse(moves_.begin(), moves_.end());
+
+    first_player_ = start->nextPlayer();
+    for (auto stone : {Stone::black, Stone::white}) {
+        start->board().stones(stone).forEach([this, stone](Point p) {
+            setup(p, stone);
+        });
+    }
+}
+
+void GameRecord::setup(Point point, Stone stone) {
+    auto code = encodePoint(point);
+    if (stone == Stone::white) {
+        code |= WHITE_BIT;
+    }
+    setup_.push_back(code);
+}
+
+Position GameRecord::replay(std::size_t num_moves) const {
+    Board board(num_rows_, num_cols_);
+    for (auto code : setup_) {
+        board.place(
+            decodePoint(code & ~WHITE_BIT),
+            (code & WHITE_BIT) ? Stone::white : Stone::black);
+    }
+    assert(num_moves <= moves_.size());
+    Position position(board, first_player_, komi_, rules_);
+    for (std::size_t i = 0; i < num_moves; ++i) {
+        position.play(decodeMove(moves_[i]));
+    }
+    return position;
+}
+
+}
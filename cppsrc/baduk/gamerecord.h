@@ -0,0 +1,65 @@
+#ifndef incl_BADUK_GAMERECORD_H__
+#define incl_BADUK_GAMERECORD_H__
+
+#include <cstdint>
+#include <vector>
+
+#include "board.h"
+#include "game.h"
+#include "position.h"
+
+namespace baduk {
+
+// A move packed into 16 bits: plays are numbered row by row, followed
+// by pass and resign.
+using MoveCode = std::uint16_t;
+
+MoveCode encodeMove(Move const& move);
+Move decodeMove(MoveCode code);
+
+// Everything needed to reconstruct a game, and nothing else: the
+// starting position, the rules and one MoveCode per move. A finished
+// 19x19 game takes well under a kilobyte, against a full board for every
+// move in a chain of game states.
+class GameRecord {
+public:
+    GameRecord(
+        unsigned int num_rows, unsigned int num_cols, float komi,
+        Rules const& rules = Rules());
+    /** Record the moves that led to game_state, along with the position
+     * its game started from. */
+    explicit GameRecord(GameState const& game_state);
+
+    unsigned int numRows() const { return num_rows_; }
+    unsigned int numCols() const { return num_cols_; }
+    float komi() const { return komi_; }
+    Rules const& rules() const { return rules_; }
+
+    std::size_t numMoves() const { return moves_.size(); }
+    Move move(std::size_t i) const { return decodeMove(moves_[i]); }
+    void push(Move const& move) { moves_.push_back(encodeMove(move)); }
+
+    /** Add a stone to the starting position. */
+    void setup(Point point, Stone stone);
+    void setFirstPlayer(Stone stone) { first_player_ = stone; }
+
+    /** The position after every move, or after only the first
+     * num_moves. The moves are played in place on a single Position. */
+    Position replay() const { return replay(moves_.size()); }
+    Position replay(std::size_t num_moves) const;
+
+private:
+    // Starting stones, as the MoveCode of their point with the color in
+    // the top bit.
+    std::vector<MoveCode> setup_;
+    std::vector<MoveCode> moves_;
+    Rules rules_;
+    float komi_;
+    std::uint8_t num_rows_;
+    std::uint8_t num_cols_;
+    Stone first_player_;
+};
+
+}
+
+#endif
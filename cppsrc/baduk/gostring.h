@@ -6,21 +6,13 @@
 
 namespace baduk {
 
+// A snapshot of one string of stones on a board. The board itself does
+// not store strings in this form; it builds one of these on request.
 class GoString {
 public:
     GoString() :
         color_(Stone::black) {}
 
-    GoString(
-            Stone c, Point p,
-            PointSet const& liberties,
-            std::vector<GoString const*> neighbors);
-
-    GoString(
-            GoString const& original,
-            Point const& liberty_to_change,
-            bool add_liberty);
-
     GoString(
         Stone c,
         PointSet const& points,
@@ -34,16 +26,7 @@ public:
     PointSet stones() const { return stones_; }
     PointSet liberties() const { return liberties_; }
 
-    void clear();
-    void setColor(Stone);
-    void addPoint(Point p);
-    void addLiberty(Point p);
-    void removeLiberty(Point p);
-    void merge(GoString const& other);
-
-    GoString mergedWith(GoString const& other) const;
-
-public:
+private:
     Stone color_;
     PointSet stones_;
     PointSet liberties_;
@@ -0,0 +1,62 @@
+#include <cassert>
+
+#include "hashhistory.h"
+
+namespace baduk {
+
+const std::size_t INITIAL_SLOTS = 64;
+
+HashHistory::HashHistory() :
+    slots_(INITIAL_SLOTS, 0) {}
+
+std::size_t HashHistory::findSlot(zobrist::hashcode hash) const {
+    // Zobrist codes are uniformly random, so the low bits make a fine
+    // slot number.
+    const auto mask = slots_.size() - 1;
+    auto slot = static_cast<std::size_t>(zobrist::lowBits(hash)) & mask;
+    while (slots_[slot] != 0 && hashes_[slots_[slot] - 1] != hash) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+bool HashHistory::contains(zobrist::hashcode hash) const {
+    return slots_[findSlot(hash)] != 0;
+}
+
+void HashHistory::push(zobrist::hashcode hash) {
+    if (2 * (hashes_.size() + 1) > slots_.size()) {
+        grow();
+    }
+    hashes_.push_back(hash);
+    const auto slot = findSlot(hash);
+    if (slots_[slot] == 0) {
+        slots_[slot] = static_cast<std::uint32_t>(hashes_.size());
+    }
+}
+
+void HashHistory::pop() {
+    assert(!hashes_.empty());
+    // Only the first occurrence of a hash has a slot. Everything pushed
+    // after it has already been popped, so no probe sequence runs
+    // through its slot and it is safe to clear.
+    const auto slot = findSlot(hashes_.back());
+    if (slots_[slot] == hashes_.size()) {
+        slots_[slot] = 0;
+    }
+    hashes_.pop_back();
+}
+
+void HashHistory::grow() {
+    // Reinsert in push order, so that probe sequences still respect the
+    // order pop() relies on.
+    slots_.assign(2 * slots_.size(), 0);
+    for (std::size_t i = 0; i < hashes_.size(); ++i) {
+        const auto slot = findSlot(hashes_[i]);
+        if (slots_[slot] == 0) {
+            slots_[slot] = static_cast<std::uint32_t>(i + 1);
+        }
+    }
+}
+
+}
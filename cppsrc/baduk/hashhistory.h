@@ -0,0 +1,36 @@
+#ifndef incl_BADUK_HASHHISTORY_H__
+#define incl_BADUK_HASHHISTORY_H__
+
+#include <cstdint>
+#include <vector>
+
+#include "zobrist/zobrist.h"
+
+namespace baduk {
+
+// The positions seen so far in a game, for superko checks. Positions
+// can only be removed in the reverse of the order they were added,
+// which is all that make/unmake needs.
+class HashHistory {
+public:
+    HashHistory();
+
+    void push(zobrist::hashcode hash);
+    void pop();
+    bool contains(zobrist::hashcode hash) const;
+    std::size_t size() const { return hashes_.size(); }
+
+private:
+    // Every hash, in the order it was pushed.
+    std::vector<zobrist::hashcode> hashes_;
+    // Open-addressed index over hashes_. Each slot holds 1 + the
+    // position of the first occurrence of a hash, or 0 if unused.
+    std::vector<std::uint32_t> slots_;
+
+    std::size_t findSlot(zobrist::hashcode hash) const;
+    void grow();
+};
+
+}
+
+#endif
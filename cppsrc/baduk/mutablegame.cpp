@@ -0,0 +1,43 @@
+#include <cassert>
+
+#include "mutablegame.h"
+
+namespace baduk {
+
+MutableGame::MutableGame(
+        Board const& board, Stone next_player, float komi,
+        Rules const& rules) :
+    position_(board, next_player, komi, rules) {}
+
+MutableGame::MutableGame(GameState const& game_state) :
+    position_(game_state) {}
+
+MutableGame::MutableGame(Position const& position) :
+    position_(position) {}
+
+UndoToken MutableGame::play(Move const& move) {
+    const UndoToken token{plies_.size()};
+    plies_.emplace_back();
+    auto& ply = plies_.back();
+    ply.move = move;
+    ply.dropped_move = position_.last_moves_[1];
+    ply.ko_point = position_.ko_point_;
+    position_.play(move, ply.board_undo);
+    return token;
+}
+
+void MutableGame::undo() {
+    assert(!plies_.empty());
+    const auto& ply = plies_.back();
+    position_.undo(ply.move, ply.board_undo, ply.dropped_move, ply.ko_point);
+    plies_.pop_back();
+}
+
+void MutableGame::undo(UndoToken token) {
+    assert(token.depth < plies_.size());
+    while (plies_.size() > token.depth) {
+        undo();
+    }
+}
+
+}
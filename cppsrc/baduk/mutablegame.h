@@ -0,0 +1,70 @@
+#ifndef incl_BADUK_MUTABLEGAME_H__
+#define incl_BADUK_MUTABLEGAME_H__
+
+#include <optional>
+#include <vector>
+
+#include "board.h"
+#include "game.h"
+#include "position.h"
+
+namespace baduk {
+
+// Returned by MutableGame::play. Passing it to MutableGame::undo takes
+// back that move and every move made after it.
+struct UndoToken {
+    std::size_t depth;
+};
+
+// A game that is updated in place. GameState creates a new state, with
+// its own copy of the board, for every move; a MutableGame applies moves
+// to a single Position and can take them back again, which is what tree
+// search needs.
+class MutableGame {
+public:
+    MutableGame(
+        Board const& board, Stone next_player, float komi,
+        Rules const& rules = Rules());
+    explicit MutableGame(GameState const& game_state);
+    explicit MutableGame(Position const& position);
+
+    Position const& position() const { return position_; }
+    Board const& board() const { return position_.board(); }
+    Stone nextPlayer() const { return position_.nextPlayer(); }
+    float komi() const { return position_.komi(); }
+    Rules const& rules() const { return position_.rules(); }
+    int numMoves() const { return position_.numMoves(); }
+    bool hasLastMove() const { return position_.hasLastMove(); }
+    Move lastMove() const { return position_.lastMove(); }
+    bool isOver() const { return position_.isOver(); }
+    bool isMoveLegal(Move const& move) const {
+        return position_.isMoveLegal(move);
+    }
+    bool doesMoveViolateKo(Move const& move) const {
+        return position_.doesMoveViolateKo(move);
+    }
+    Bitboard legalMoves() const { return position_.legalMoves(); }
+    zobrist::hashcode hash() const { return position_.hash(); }
+
+    UndoToken play(Move const& move);
+    /** Take back the last move. */
+    void undo();
+    /** Take back every move back to and including the one that returned
+     * token. */
+    void undo(UndoToken token);
+
+private:
+    struct Ply {
+        Move move;
+        PlaceUndo board_undo;
+        std::optional<Move> dropped_move;
+        std::optional<Point> ko_point;
+    };
+
+    Position position_;
+    std::vector<Ply> plies_;
+};
+
+}
+
+#endif
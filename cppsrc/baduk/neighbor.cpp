@@ -1,5 +1,6 @@
-#include <memory>
+#include <cassert>
 
+#include "dim.h"
 #include "neighbor.h"
 
 namespace baduk {
@@ -35,19 +36,44 @@ std::vector<Point> const& NeighborTable::get(Point const& p) const {
     return neighbors_.at(index);
 }
 
-NeighborTable const* getNeighborTable(
-        unsigned int num_rows, unsigned int num_cols) {
-    // Max supported board size is 25x25.
-    static std::vector<std::unique_ptr<NeighborTable>> tables(25 * 25 + 1);
-
-    const auto index = num_rows * 25 + num_cols;
-    NeighborTable const* rv = tables[index].get();
-    if (rv == nullptr) {
-        tables[index] = std::make_unique<NeighborTable>(num_rows, num_cols);
-        rv = tables[index].get();
+namespace {
+
+// A table for every board size up to MAX_BOARD_SIZE, built all at once
+// and never changed afterwards, so any number of threads can read them
+// without locking.
+class NeighborTables {
+public:
+    NeighborTables() {
+        tables_.reserve((MAX_BOARD_SIZE + 1) * (MAX_BOARD_SIZE + 1));
+        for (unsigned int r = 0; r <= MAX_BOARD_SIZE; ++r) {
+            for (unsigned int c = 0; c <= MAX_BOARD_SIZE; ++c) {
+                tables_.emplace_back(r, c);
+            }
+        }
+    }
+
+    NeighborTable const* get(
+            unsigned int num_rows, unsigned int num_cols) const {
+        return &tables_[num_rows * (MAX_BOARD_SIZE + 1) + num_cols];
     }
 
-    return rv;
+private:
+    std::vector<NeighborTable> tables_;
+};
+
+NeighborTables const& allTables() {
+    // Initialising a local static is thread-safe, and doesn't depend on
+    // the order other files are initialised in.
+    static const NeighborTables tables;
+    return tables;
+}
+
+}
+
+NeighborTable const* getNeighborTable(
+        unsigned int num_rows, unsigned int num_cols) {
+    assert(num_rows <= MAX_BOARD_SIZE && num_cols <= MAX_BOARD_SIZE);
+    return allTables().get(num_rows, num_cols);
 }
 
 }
@@ -19,10 +19,11 @@ private:
     std::vector<std::vector<Point>> neighbors_;
 };
 
+/** The shared, read-only table for a board size. All of them are built
+ * during startup, so this is safe to call from any thread. */
 NeighborTable const* getNeighborTable(
     unsigned int num_rows, unsigned int num_cols);
 
-
 }
 
 #endif
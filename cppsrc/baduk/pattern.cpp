@@ -0,0 +1,68 @@
+#include "pattern.h"
+
+namespace baduk {
+
+namespace {
+
+const unsigned int OWN = 1;
+const unsigned int ENEMY = 2;
+
+unsigned int defaultWeight(PatternCode code) {
+    bool captures = false;
+    bool saves = false;
+    for (unsigned int k = 0; k < 4; ++k) {
+        if (patternAtari(code, k)) {
+            // We're next to a string in atari, so this is its last
+            // liberty.
+            captures |= patternColor(code, k) == ENEMY;
+            saves |= patternColor(code, k) == OWN;
+        }
+    }
+    if (captures) {
+        return 16;
+    }
+    if (saves) {
+        return 8;
+    }
+    for (unsigned int k = 0; k < 8; ++k) {
+        const auto color = patternColor(code, k);
+        if (color == OWN || color == ENEMY) {
+            return 2;
+        }
+    }
+    return 1;
+}
+
+PatternWeights makeDefaults() {
+    PatternWeights weights;
+    for (PatternCode code = 0; code < NUM_PATTERNS; ++code) {
+        weights.set(code, defaultWeight(code));
+    }
+    return weights;
+}
+
+}
+
+PatternWeights::PatternWeights() :
+    weights_(NUM_PATTERNS, 1),
+    max_weight_(1) {}
+
+PatternWeights const& PatternWeights::defaults() {
+    static const PatternWeights weights = makeDefaults();
+    return weights;
+}
+
+void PatternWeights::set(PatternCode code, unsigned int weight) {
+    if (code >= NUM_PATTERNS) {
+        throw BadPatternCode();
+    }
+    if (weight < 1 || weight > 255) {
+        throw BadPatternWeight();
+    }
+    weights_[code] = static_cast<std::uint8_t>(weight);
+    if (weight > max_weight_) {
+        max_weight_ = weight;
+    }
+}
+
+}
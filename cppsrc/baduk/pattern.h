@@ -0,0 +1,74 @@
+#ifndef incl_BADUK_PATTERN_H__
+#define incl_BADUK_PATTERN_H__
+
+#include <cstdint>
+#include <vector>
+
+#include "point.h"
+
+namespace baduk {
+
+class BadPatternCode : public std::exception {};
+class BadPatternWeight : public std::exception {};
+
+// The 3x3 neighborhood of a point, packed into an integer. The low 16
+// bits hold the color of each of the eight surrounding points, two bits
+// apiece: the four sides first, in the order of
+// FixedBoard::NEIGHBOR_OFFSETS, then the four corners, in the order of
+// FixedBoard::DIAGONAL_OFFSETS. Each is empty (0), a black stone (1), a
+// white stone (2) or off the board (3). Bits 16 to 19 are set for the
+// sides that hold a string in atari.
+using PatternCode = std::uint32_t;
+const unsigned int PATTERN_BITS = 20;
+const PatternCode NUM_PATTERNS = PatternCode(1) << PATTERN_BITS;
+
+/** The color of neighbor k (0-7) in code. */
+inline unsigned int patternColor(PatternCode code, unsigned int k) {
+    return (code >> (2 * k)) & 3;
+}
+
+/** Whether side k (0-3) of code is a string in atari. */
+inline bool patternAtari(PatternCode code, unsigned int k) {
+    return (code >> (16 + k)) & 1;
+}
+
+/** code as seen by player: swaps black and white when player is white,
+ * so that the stones of the player to move are always black. */
+inline PatternCode forPlayer(PatternCode code, Stone player) {
+    if (player == Stone::black) {
+        return code;
+    }
+    const PatternCode colors = code & 0xffff;
+    const PatternCode swapped =
+        ((colors & 0x5555) << 1) | ((colors >> 1) & 0x5555);
+    return (code & ~PatternCode(0xffff)) | swapped;
+}
+
+// How strongly to favor a move, looked up by the pattern around it as
+// seen by the player making it. Every weight is at least 1, so that no
+// legal move is ruled out entirely.
+class PatternWeights {
+public:
+    /** Every pattern weighted 1, so moves are drawn uniformly. */
+    PatternWeights();
+
+    /** Hand-picked weights for playouts: capturing comes first, then
+     * saving a string in atari, then playing in contact with other
+     * stones. Shared, and built on first use. */
+    static PatternWeights const& defaults();
+
+    unsigned int weight(PatternCode code) const { return weights_[code]; }
+    /** Throws BadPatternCode unless code < NUM_PATTERNS, and
+     * BadPatternWeight unless 1 <= weight <= 255. */
+    void set(PatternCode code, unsigned int weight);
+    /** At least as large as every weight in the table. */
+    unsigned int maxWeight() const { return max_weight_; }
+
+private:
+    std::vector<std::uint8_t> weights_;
+    unsigned int max_weight_;
+};
+
+}
+
+#endif
@@ -0,0 +1,294 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <new>
+
+#include "persistenthash.h"
+
+namespace baduk {
+
+namespace {
+
+const unsigned int BITS_PER_LEVEL = 5;
+// The most nodes on the path from the root to any entry.
+const unsigned int MAX_DEPTH =
+    (zobrist::HASH_BITS + BITS_PER_LEVEL - 1) / BITS_PER_LEVEL;
+
+std::uint32_t slotBit(zobrist::hashcode hash, unsigned int shift) {
+    return std::uint32_t(1) << (zobrist::bitsFrom(hash, shift) & 31);
+}
+
+unsigned int popcount(std::uint32_t map) {
+    return static_cast<unsigned int>(__builtin_popcount(map));
+}
+
+// Position in a compressed array of the slot for bit.
+unsigned int arrayIndex(std::uint32_t map, std::uint32_t bit) {
+    return popcount(map & (bit - 1));
+}
+
+// Copy the n items at src to dst, leaving dst[gap] free.
+template <typename T>
+void copyWithGap(T const* src, unsigned int n, T* dst, unsigned int gap) {
+    std::copy(src, src + gap, dst);
+    std::copy(src + gap, src + n, dst + gap + 1);
+}
+
+// Copy the n items at src to dst, all but src[skip].
+template <typename T>
+void copyWithout(T const* src, unsigned int n, T* dst, unsigned int skip) {
+    std::copy(src, src + skip, dst);
+    std::copy(src + skip + 1, src + n, dst + skip);
+}
+
+}
+
+// Bit i of entry_map is set if slot i holds a hash code; bit i of
+// child_map if it holds a child node. The node is followed by the hash
+// codes and then the child pointers, with only as much room as the
+// slots in use, in slot order.
+struct alignas(8) PersistentHashSet::Node {
+    std::uint32_t entry_map;
+    std::uint32_t child_map;
+
+    unsigned int numEntries() const { return popcount(entry_map); }
+    unsigned int numChildren() const { return popcount(child_map); }
+
+    zobrist::hashcode* entries() {
+        return reinterpret_cast<zobrist::hashcode*>(this + 1);
+    }
+    zobrist::hashcode const* entries() const {
+        return reinterpret_cast<zobrist::hashcode const*>(this + 1);
+    }
+    Node const** children() {
+        return reinterpret_cast<Node const**>(entries() + numEntries());
+    }
+    Node const* const* children() const {
+        return reinterpret_cast<Node const* const*>(
+            entries() + numEntries());
+    }
+
+    static std::size_t bytes(std::uint32_t entries, std::uint32_t children) {
+        return sizeof(Node) +
+            popcount(entries) * sizeof(zobrist::hashcode) +
+            popcount(children) * sizeof(Node const*);
+    }
+
+    static_assert(
+        alignof(zobrist::hashcode) <= 8 && alignof(void*) <= 8 &&
+        sizeof(zobrist::hashcode) % 8 == 0,
+        "node arrays must stay aligned");
+};
+
+// The nodes made by one insert(), laid out one after another after the
+// header.
+struct alignas(8) PersistentHashSet::Block {
+    std::atomic<std::uint32_t> refs;
+    std::uint32_t bytes;
+    Block* parent;
+
+    Block(std::size_t size, Block* parent_block) :
+        refs(1),
+        bytes(static_cast<std::uint32_t>(size)),
+        parent(parent_block) {}
+
+    char* nodes() { return reinterpret_cast<char*>(this + 1); }
+};
+
+PersistentHashSet::PersistentHashSet(PersistentHashSet const& other) :
+        root_(other.root_),
+        block_(other.block_),
+        size_(other.size_),
+        resource_(other.resource_) {
+    if (block_ != nullptr) {
+        block_->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+PersistentHashSet::PersistentHashSet(PersistentHashSet&& other) noexcept :
+        root_(other.root_),
+        block_(other.block_),
+        size_(other.size_),
+        resource_(other.resource_) {
+    other.root_ = nullptr;
+    other.block_ = nullptr;
+    other.size_ = 0;
+}
+
+PersistentHashSet& PersistentHashSet::operator=(
+        PersistentHashSet other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(block_, other.block_);
+    std::swap(size_, other.size_);
+    std::swap(resource_, other.resource_);
+    return *this;
+}
+
+PersistentHashSet::~PersistentHashSet() {
+    release(block_, resource_);
+}
+
+void PersistentHashSet::release(
+        Block* block, std::pmr::memory_resource* resource) {
+    // A loop rather than recursion, since a chain is as long as the
+    // game.
+    while (block != nullptr &&
+            block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        const auto parent = block->parent;
+        const auto bytes = block->bytes;
+        block->~Block();
+        resource->deallocate(block, bytes, alignof(Block));
+        block = parent;
+    }
+}
+
+bool PersistentHashSet::contains(zobrist::hashcode hash) const {
+    auto node = root_;
+    unsigned int shift = 0;
+    while (node != nullptr) {
+        const auto bit = slotBit(hash, shift);
+        if (node->entry_map & bit) {
+            return node->entries()[arrayIndex(node->entry_map, bit)] == hash;
+        }
+        if (!(node->child_map & bit)) {
+            return false;
+        }
+        node = node->children()[arrayIndex(node->child_map, bit)];
+        shift += BITS_PER_LEVEL;
+    }
+    return false;
+}
+
+PersistentHashSet PersistentHashSet::insert(zobrist::hashcode hash) const {
+    if (contains(hash)) {
+        return *this;
+    }
+
+    // First work out the shape of every new node, from the root down,
+    // so they can all go in one block. The path copies the nodes down
+    // to the slot for hash. If that slot holds another entry, the two
+    // go into a new subtree with a node for each level they share.
+    enum class Kind {
+        // A copy pointing to the next node in place of an old child.
+        descend,
+        // A copy with hash added.
+        add,
+        // A copy with the old entry replaced by the next node.
+        split,
+        // A new node whose only child is the next node.
+        fork,
+        // A new node holding hash and the old entry.
+        leaf,
+    };
+    struct Step {
+        Kind kind;
+        Node const* old;
+        std::uint32_t bit;
+        std::uint32_t entry_map;
+        std::uint32_t child_map;
+    };
+    std::array<Step, MAX_DEPTH> path;
+    unsigned int depth = 0;
+    std::size_t bytes = sizeof(Block);
+    const auto push = [&](
+            Kind kind, Node const* old, std::uint32_t bit,
+            std::uint32_t entry_map, std::uint32_t child_map) {
+        path[depth++] = Step{kind, old, bit, entry_map, child_map};
+        bytes += Node::bytes(entry_map, child_map);
+    };
+
+    auto node = root_;
+    unsigned int shift = 0;
+    zobrist::hashcode existing = hash;
+    while (true) {
+        const auto bit = slotBit(hash, shift);
+        const auto entry_map = node ? node->entry_map : 0;
+        const auto child_map = node ? node->child_map : 0;
+        if (child_map & bit) {
+            push(Kind::descend, node, bit, entry_map, child_map);
+            node = node->children()[arrayIndex(child_map, bit)];
+            shift += BITS_PER_LEVEL;
+        } else if (entry_map & bit) {
+            existing = node->entries()[arrayIndex(entry_map, bit)];
+            push(Kind::split, node, bit, entry_map & ~bit, child_map | bit);
+            break;
+        } else {
+            push(Kind::add, node, bit, entry_map | bit, child_map);
+            break;
+        }
+    }
+    if (path[depth - 1].kind == Kind::split) {
+        shift += BITS_PER_LEVEL;
+        while (slotBit(hash, shift) == slotBit(existing, shift)) {
+            const auto bit = slotBit(hash, shift);
+            push(Kind::fork, nullptr, bit, 0, bit);
+            shift += BITS_PER_LEVEL;
+        }
+        const auto bit = slotBit(hash, shift);
+        push(Kind::leaf, nullptr, bit, bit | slotBit(existing, shift), 0);
+    }
+
+    void* memory = resource_->allocate(bytes, alignof(Block));
+    const auto block = new (memory) Block(bytes, block_);
+    if (block_ != nullptr) {
+        block_->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+    std::array<Node*, MAX_DEPTH> nodes;
+    auto next = block->nodes();
+    for (unsigned int k = 0; k < depth; ++k) {
+        nodes[k] = new (next) Node{path[k].entry_map, path[k].child_map};
+        next += Node::bytes(path[k].entry_map, path[k].child_map);
+    }
+
+    for (unsigned int k = 0; k < depth; ++k) {
+        const auto& step = path[k];
+        const auto copy = nodes[k];
+        const auto old = step.old;
+        switch (step.kind) {
+        case Kind::descend:
+            std::copy(
+                old->entries(), old->entries() + old->numEntries(),
+                copy->entries());
+            std::copy(
+                old->children(), old->children() + old->numChildren(),
+                copy->children());
+            copy->children()[arrayIndex(copy->child_map, step.bit)] =
+                nodes[k + 1];
+            break;
+        case Kind::add: {
+            const auto i = arrayIndex(copy->entry_map, step.bit);
+            if (old != nullptr) {
+                copyWithGap(
+                    old->entries(), old->numEntries(), copy->entries(), i);
+                std::copy(
+                    old->children(), old->children() + old->numChildren(),
+                    copy->children());
+            }
+            copy->entries()[i] = hash;
+            break;
+        }
+        case Kind::split: {
+            const auto j = arrayIndex(copy->child_map, step.bit);
+            copyWithout(
+                old->entries(), old->numEntries(), copy->entries(),
+                arrayIndex(old->entry_map, step.bit));
+            copyWithGap(
+                old->children(), old->numChildren(), copy->children(), j);
+            copy->children()[j] = nodes[k + 1];
+            break;
+        }
+        case Kind::fork:
+            copy->children()[0] = nodes[k + 1];
+            break;
+        case Kind::leaf: {
+            const auto i = arrayIndex(copy->entry_map, step.bit);
+            copy->entries()[i] = hash;
+            copy->entries()[1 - i] = existing;
+            break;
+        }
+        }
+    }
+    return PersistentHashSet(nodes[0], block, size_ + 1, resource_);
+}
+
+}
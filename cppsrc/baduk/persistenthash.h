@@ -0,0 +1,67 @@
+#ifndef incl_BADUK_PERSISTENTHASH_H__
+#define incl_BADUK_PERSISTENTHASH_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+#include "zobrist/zobrist.h"
+
+namespace baduk {
+
+// An immutable set of hash codes. insert() returns a new set and leaves
+// this one alone; the two share all but the handful of nodes on the
+// path to the new entry, so a game state can extend its parent's
+// history without copying it.
+//
+// Internally it's a hash trie: each level takes the next 5 bits of the
+// hash code, and a node stores entries and child nodes in arrays
+// compressed with a bitmap. Lookups touch one node per level, and there
+// are only about log32(n) levels.
+//
+// The nodes that one insert() creates all go in a single block from
+// the set's memory resource. A block keeps the block of the set it was
+// made from alive, and every node a set can reach is in its own block
+// or further up that chain, so the blocks are the only thing counted:
+// an insert costs one allocation and one reference.
+//
+// Sets are safe to share between threads. Every set made by insert()
+// allocates from the same resource as the set it came from, and the
+// resource must outlive them all.
+class PersistentHashSet {
+public:
+    explicit PersistentHashSet(
+        std::pmr::memory_resource* resource =
+            std::pmr::new_delete_resource()) :
+        root_(nullptr), block_(nullptr), size_(0), resource_(resource) {}
+    PersistentHashSet(PersistentHashSet const& other);
+    PersistentHashSet(PersistentHashSet&& other) noexcept;
+    PersistentHashSet& operator=(PersistentHashSet other) noexcept;
+    ~PersistentHashSet();
+
+    PersistentHashSet insert(zobrist::hashcode hash) const;
+    bool contains(zobrist::hashcode hash) const;
+    std::size_t size() const { return size_; }
+
+private:
+    struct Node;
+    struct Block;
+
+    Node const* root_;
+    Block* block_;
+    std::size_t size_;
+    std::pmr::memory_resource* resource_;
+
+    PersistentHashSet(
+            Node const* root, Block* block, std::size_t size,
+            std::pmr::memory_resource* resource) :
+        root_(root), block_(block), size_(size), resource_(resource) {}
+
+    // Drop a reference to block, freeing it and as much of the chain
+    // above it as nothing else refers to.
+    static void release(Block* block, std::pmr::memory_resource* resource);
+};
+
+}
+
+#endif
@@ -0,0 +1,132 @@
+#include <utility>
+
+#include "playout.h"
+#include "scoring.h"
+
+namespace baduk {
+
+// Random play can't always finish under simple ko; a triple ko goes
+// round forever. Give up once a game has run this many moves per point.
+const unsigned int MAX_MOVES_PER_POINT = 3;
+
+namespace {
+
+unsigned int pointIndex(Point p) {
+    return p.col() + MAX_BOARD_SIZE * p.row();
+}
+
+}
+
+Playout::Playout() :
+    num_empty_(0) {}
+
+unsigned int Playout::run(Board& board, Stone next_player, Rng& rng) {
+    return board.visit([this, next_player, &rng](auto& fixed_board) {
+        return play(fixed_board, next_player, rng, [](Point, Stone) {
+            return true;
+        });
+    });
+}
+
+unsigned int Playout::run(
+        Board& board, Stone next_player, Rng& rng,
+        PatternWeights const& weights) {
+    const auto max_weight = weights.maxWeight();
+    return board.visit([&](auto& fixed_board) {
+        return play(fixed_board, next_player, rng, [&](Point p, Stone player) {
+            const auto code = forPlayer(fixed_board.pattern(p), player);
+            return rng.below(max_weight) < weights.weight(code);
+        });
+    });
+}
+
+template<typename FixedBoardType, typename Accept>
+unsigned int Playout::play(
+        FixedBoardType& board, Stone player, Rng& rng, Accept accept) {
+    num_empty_ = 0;
+    board.emptyPoints().forEach([this](Point p) { addEmpty(p); });
+
+    const auto max_moves =
+        MAX_MOVES_PER_POINT * board.numRows() * board.numCols();
+    // Where the player to move may not play, if the opponent just took
+    // a ko.
+    Point ko_point;
+    bool has_ko = false;
+    unsigned int num_moves = 0;
+    unsigned int num_passes = 0;
+    while (num_passes < 2 && num_moves < max_moves) {
+        ++num_moves;
+        auto const& candidates = board.candidates(player);
+        // Points from num_left on have been ruled out for this move.
+        auto num_left = num_empty_;
+        Point chosen;
+        bool found = false;
+        while (num_left > 0) {
+            const auto i = rng.below(num_left);
+            const auto point = empty_[i];
+            const bool is_ko = has_ko && ko_point == point;
+            if (candidates.get(point) && !is_ko &&
+                    !board.isEye(point, player)) {
+                if (accept(point, player)) {
+                    chosen = point;
+                    found = true;
+                    break;
+                }
+                // Still playable; leave it in the draw.
+                continue;
+            }
+            --num_left;
+            swapEmpty(i, num_left);
+        }
+
+        has_ko = false;
+        if (!found) {
+            ++num_passes;
+            player = other(player);
+            continue;
+        }
+        num_passes = 0;
+
+        const auto move = board.analyzeMove(chosen, player);
+        removeEmpty(chosen);
+        if (move.isCapture()) {
+            const auto before = board.emptyPoints();
+            board.place(move);
+            board.emptyPoints().without(before).forEach([&](Point p) {
+                addEmpty(p);
+                if (move.isKoCapture()) {
+                    ko_point = p;
+                    has_ko = true;
+                }
+            });
+        } else {
+            board.place(move);
+        }
+        player = other(player);
+    }
+    return num_moves;
+}
+
+void Playout::addEmpty(Point p) {
+    empty_pos_[pointIndex(p)] = static_cast<std::uint16_t>(num_empty_);
+    empty_[num_empty_++] = p;
+}
+
+void Playout::removeEmpty(Point p) {
+    swapEmpty(empty_pos_[pointIndex(p)], num_empty_ - 1);
+    --num_empty_;
+}
+
+void Playout::swapEmpty(unsigned int i, unsigned int j) {
+    std::swap(empty_[i], empty_[j]);
+    empty_pos_[pointIndex(empty_[i])] = static_cast<std::uint16_t>(i);
+    empty_pos_[pointIndex(empty_[j])] = static_cast<std::uint16_t>(j);
+}
+
+float playoutScore(Board const& board, float komi) {
+    const auto black_minus_white = areaDifference(
+        evaluateTerritory(board), board.numRows(), board.numCols());
+    return static_cast<float>(black_minus_white) - komi;
+}
+
+}
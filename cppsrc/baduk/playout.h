@@ -0,0 +1,66 @@
+#ifndef incl_BADUK_PLAYOUT_H__
+#define incl_BADUK_PLAYOUT_H__
+
+#include <array>
+#include <cstdint>
+
+#include "board.h"
+#include "dim.h"
+#include "pattern.h"
+#include "rng.h"
+
+namespace baduk {
+
+// Plays random games to the end on a single board, changing it in
+// place. This is the cheap alternative to stepping a GameState through
+// RandomBot: no game states are created and there's no history, so only
+// simple ko is enforced. Neither player fills in their own eyes, and
+// the game ends when both players pass in a row.
+//
+// The empty points are kept in a list that is updated as stones are
+// placed and captured. Each move draws points from the list at random,
+// setting aside any that turn out to be illegal or an eye, until it
+// finds one it can play. Heavy playouts then keep each point with
+// probability proportional to the weight of its pattern, and put it back
+// to be drawn again otherwise.
+//
+// A Playout can be reused for any number of games, but isn't
+// thread-safe; give each thread its own.
+class Playout {
+public:
+    Playout();
+
+    /** Play board out to the end, starting with next_player and
+     * drawing moves from rng. Returns the number of moves played,
+     * passes included. */
+    unsigned int run(Board& board, Stone next_player, Rng& rng);
+    /** Like run(), but favoring moves by the pattern around them. */
+    unsigned int run(
+        Board& board, Stone next_player, Rng& rng,
+        PatternWeights const& weights);
+
+private:
+    // The empty points in no particular order, and the position in
+    // empty_ of each one, indexed like a TerritoryMap.
+    std::array<Point, MAX_POINTS> empty_;
+    std::array<std::uint16_t, MAX_POINTS> empty_pos_;
+    unsigned int num_empty_;
+
+    // accept(point, player) has the last word on each point that would
+    // otherwise be played.
+    template<typename FixedBoardType, typename Accept>
+    unsigned int play(
+        FixedBoardType& board, Stone player, Rng& rng, Accept accept);
+
+    void addEmpty(Point p);
+    void removeEmpty(Point p);
+    void swapEmpty(unsigned int i, unsigned int j);
+};
+
+/** Black's area score minus white's and komi, for a board that has been
+ * played out. */
+float playoutScore(Board const& board, float komi);
+
+}
+
+#endif
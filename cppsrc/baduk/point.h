@@ -1,20 +1,21 @@
 #ifndef incl_BADUK_POINT_H__
 #define incl_BADUK_POINT_H__
 
+#include <cstdint>
 #include <functional>
 #include <iostream>
 
 namespace baduk {
 
-enum class Stone { black, white };
+enum class Stone : std::uint8_t { black, white };
 
 Stone other(Stone stone);
 std::ostream& operator<<(std::ostream& out, Stone s);
 
 class Point {
 public:
-    Point() : row_(1), col_(1) {}
-    Point(unsigned int r, unsigned int c) :
+    constexpr Point() : row_(1), col_(1) {}
+    constexpr Point(unsigned int r, unsigned int c) :
         row_(r),
         col_(c) {}
     /** Construct from D4 style coordinates. */
@@ -24,8 +25,8 @@ public:
     /** Format as D4 style coordinates. */
     std::string name() const;
 
-    unsigned int row() const { return row_; }
-    unsigned int col() const { return col_; }
+    constexpr unsigned int row() const { return row_; }
+    constexpr unsigned int col() const { return col_; }
 
     bool operator==(Point q) const {
         return row_ == q.row() && col_ == q.col();
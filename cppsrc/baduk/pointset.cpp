@@ -2,65 +2,83 @@
 
 namespace baduk {
 
+namespace {
+
 unsigned int index(Point const& p) {
     return p.col() + MAX_BOARD_SIZE * p.row();
 }
 
-Point point(unsigned int index) {
-    return Point(index / MAX_BOARD_SIZE, index % MAX_BOARD_SIZE);
+PointSet::Word bit(unsigned int index) {
+    return PointSet::Word(1) << (index % PointSet::WORD_BITS);
+}
+
 }
 
-PointIter::PointIter(PointSet const* pointset, unsigned int i) :
+PointIter::PointIter(PointSet const* pointset, unsigned int word) :
     pointset_(pointset),
-    i_(i) {}
-
-PointIter& PointIter::operator++() {
-    ++i_;
-    while (i_ < MAX_POINTS &&
-            i_ <= pointset_->max_ &&
-            !pointset_->points_[i_]) {
-        ++i_;
+    word_(word),
+    bits_(0) {
+    if (word_ < PointSet::NUM_WORDS) {
+        bits_ = pointset_->words_[word_];
+        skipEmptyWords();
+    }
+}
+
+unsigned int PointSet::size() const {
+    unsigned int count = 0;
+    for (auto word : words_) {
+        count += static_cast<unsigned int>(__builtin_popcountll(word));
     }
-    return *this;
+    return count;
 }
 
-Point PointIter::operator*() const {
-    return point(i_);
+bool PointSet::empty() const {
+    for (auto word : words_) {
+        if (word != 0) {
+            return false;
+        }
+    }
+    return true;
 }
 
-bool PointIter::operator!=(PointIter const& p) const {
-    return i_ != p.i_;
+bool PointSet::contains(Point const& p) const {
+    const auto pindex = index(p);
+    return (words_[pindex / WORD_BITS] & bit(pindex)) != 0;
 }
 
 void PointSet::add(Point const& p) {
     const auto pindex = index(p);
-    points_.set(pindex);
-    if (pindex < min_) {
-        min_ = pindex;
-    }
-    if (pindex > max_) {
-        max_ = pindex;
-    }
+    words_[pindex / WORD_BITS] |= bit(pindex);
 }
 
 void PointSet::add(PointSet const& ps) {
-    points_ |= ps.points_;
-    min_ = std::min(min_, ps.min_);
-    max_ = std::max(max_, ps.max_);
+    for (unsigned int i = 0; i < NUM_WORDS; ++i) {
+        words_[i] |= ps.words_[i];
+    }
 }
 
 void PointSet::remove(Point const& p) {
-    points_.reset(index(p));
+    const auto pindex = index(p);
+    words_[pindex / WORD_BITS] &= ~bit(pindex);
 }
 
 void PointSet::remove(PointSet const& ps) {
-    points_ &= (~ps.points_);
+    for (unsigned int i = 0; i < NUM_WORDS; ++i) {
+        words_[i] &= ~ps.words_[i];
+    }
 }
 
 void PointSet::clear() {
-    points_.reset();
-    min_ = MAX_POINTS - 1;
-    max_ = 0;
+    words_.fill(0);
+}
+
+std::vector<Point> PointSet::asPoints() const {
+    std::vector<Point> points;
+    points.reserve(size());
+    for (auto p : *this) {
+        points.push_back(p);
+    }
+    return points;
 }
 
 PointSet PointSet::without(Point const& p) const {
@@ -82,13 +100,11 @@ PointSet PointSet::unionWith(PointSet const& ps) const {
 }
 
 PointIter PointSet::begin() const {
-    auto tmp = PointIter(this, min_ - 1);
-    ++tmp;
-    return tmp;
+    return PointIter(this, 0);
 }
 
 PointIter PointSet::end() const {
-    return PointIter(this, max_ + 1);
+    return PointIter(this, NUM_WORDS);
 }
 
 }
@@ -1,7 +1,8 @@
 #ifndef incl_BADUK_POINTSET_H__
 #define incl_BADUK_POINTSET_H__
 
-#include <bitset>
+#include <array>
+#include <cstdint>
 #include <vector>
 
 #include "dim.h"
@@ -11,13 +12,20 @@ namespace baduk {
 
 class PointIter;
 
+// A set of points, stored as a bitmask in 64-bit words. Point (r, c) is
+// bit c + MAX_BOARD_SIZE * r.
 class PointSet {
 public:
-    PointSet() :
-        min_(MAX_POINTS - 1),
-        max_(0) {}
+    using Word = std::uint64_t;
+    static constexpr unsigned int WORD_BITS = 64;
+    static constexpr unsigned int NUM_WORDS =
+        (MAX_POINTS + WORD_BITS - 1) / WORD_BITS;
 
-    auto size() const { return points_.count(); }
+    PointSet() : words_{} {}
+
+    unsigned int size() const;
+    bool empty() const;
+    bool contains(Point const&) const;
 
     // These return a copy
     PointSet unionWith(Point const&) const;
@@ -36,29 +44,48 @@ public:
     PointIter begin() const;
     PointIter end() const;
 
+    bool operator==(PointSet const& ps) const { return words_ == ps.words_; }
+
 private:
-    std::bitset<MAX_POINTS> points_;
-    unsigned int min_;
-    unsigned int max_;
+    std::array<Word, NUM_WORDS> words_;
 
     friend class PointIter;
 };
 
+// Visits the set bits in order. The iterator keeps a copy of the word it
+// is working through, with the bits it has already visited cleared, so
+// each step is a count-trailing-zeros rather than a bit-by-bit scan.
 class PointIter {
 public:
-    PointIter() : pointset_(nullptr), i_(0) {}
-    PointIter(PointSet const* pointset, unsigned int i);
-
-    bool operator!=(PointIter const& p) const;
-    PointIter& operator++();
-    Point operator*() const;
+    PointIter() : pointset_(nullptr), word_(PointSet::NUM_WORDS), bits_(0) {}
+    PointIter(PointSet const* pointset, unsigned int word);
+
+    bool operator!=(PointIter const& p) const {
+        return word_ != p.word_ || bits_ != p.bits_;
+    }
+    PointIter& operator++() {
+        bits_ &= bits_ - 1;
+        skipEmptyWords();
+        return *this;
+    }
+    Point operator*() const {
+        const auto i = word_ * PointSet::WORD_BITS +
+            static_cast<unsigned int>(__builtin_ctzll(bits_));
+        return Point(i / MAX_BOARD_SIZE, i % MAX_BOARD_SIZE);
+    }
 
 private:
     PointSet const* pointset_;
-    unsigned int i_;
+    unsigned int word_;
+    PointSet::Word bits_;
+
+    void skipEmptyWords() {
+        while (bits_ == 0 && ++word_ < PointSet::NUM_WORDS) {
+            bits_ = pointset_->words_[word_];
+        }
+    }
 };
 
-
 }
 
 #endif
@@ -0,0 +1,127 @@
+#include <vector>
+
+#include "position.h"
+
+namespace baduk {
+
+Position::Position(
+        Board const& board, Stone next_player, float komi,
+        Rules const& rules) :
+    board_(board),
+    next_player_(next_player),
+    komi_(komi),
+    num_moves_(0),
+    rules_(rules) {}
+
+Position::Position(GameState const& game_state) :
+    board_(game_state.board()),
+    next_player_(game_state.nextPlayer()),
+    komi_(game_state.komi()),
+    num_moves_(game_state.numMoves()),
+    rules_(game_state.rules()) {
+    if (rules_.ko != KoRule::simple) {
+        std::vector<zobrist::hashcode> earlier_hashes;
+        for (auto state = game_state.prevState();
+                state != nullptr;
+                state = state->prevState()) {
+            earlier_hashes.push_back(
+                rules_.ko == KoRule::positional ?
+                    state->board().hash() :
+                    state->hash());
+        }
+        for (auto it = earlier_hashes.rbegin();
+                it != earlier_hashes.rend();
+                ++it) {
+            history_.push(*it);
+        }
+    }
+
+    if (game_state.hasLastMove()) {
+        last_moves_[0] = game_state.lastMove();
+        const auto prev_state = game_state.prevState();
+        if (prev_state != nullptr && prev_state->hasLastMove()) {
+            last_moves_[1] = prev_state->lastMove();
+        }
+        if (rules_.ko == KoRule::simple && prev_state != nullptr &&
+                std::holds_alternative<Play>(*last_moves_[0])) {
+            const auto point = std::get<Play>(*last_moves_[0]).point();
+            const auto move = prev_state->board().analyzeMove(
+                point, other(next_player_));
+            ko_point_ = koPointAfter(board_, point, move);
+        }
+    }
+}
+
+bool Position::isOver() const {
+    const auto& last_move = last_moves_[0];
+    if (!last_move) {
+        return false;
+    }
+    if (isResign(*last_move)) {
+        return true;
+    }
+    if (isPass(*last_move)) {
+        return last_moves_[1] && isPass(*last_moves_[1]);
+    }
+    return false;
+}
+
+zobrist::hashcode Position::hash() const {
+    return stateHash(board_.hash(), next_player_);
+}
+
+bool Position::isMoveLegal(Move const& move) const {
+    return referee().isMoveLegal(move);
+}
+
+bool Position::doesMoveViolateKo(Move const& move) const {
+    return referee().doesMoveViolateKo(move);
+}
+
+Bitboard Position::legalMoves() const {
+    return referee().legalMoves();
+}
+
+void Position::play(Move const& move) {
+    PlaceUndo board_undo;
+    play(move, board_undo);
+}
+
+void Position::play(Move const& move, PlaceUndo& board_undo) {
+    if (rules_.ko != KoRule::simple) {
+        history_.push(referee().historyHash());
+    }
+    ko_point_.reset();
+    if (std::holds_alternative<Play>(move)) {
+        const auto point = std::get<Play>(move).point();
+        const auto analysis = board_.analyzeMove(point, next_player_);
+        board_.place(analysis, board_undo);
+        if (rules_.ko == KoRule::simple) {
+            ko_point_ = koPointAfter(board_, point, analysis);
+        }
+    }
+    last_moves_[1] = last_moves_[0];
+    last_moves_[0] = move;
+    next_player_ = other(next_player_);
+    ++num_moves_;
+}
+
+void Position::undo(
+        Move const& move,
+        PlaceUndo const& board_undo,
+        std::optional<Move> const& dropped_move,
+        std::optional<Point> const& ko_point) {
+    if (std::holds_alternative<Play>(move)) {
+        board_.undo(board_undo);
+    }
+    if (rules_.ko != KoRule::simple) {
+        history_.pop();
+    }
+    ko_point_ = ko_point;
+    last_moves_[0] = last_moves_[1];
+    last_moves_[1] = dropped_move;
+    next_player_ = other(next_player_);
+    --num_moves_;
+}
+
+}
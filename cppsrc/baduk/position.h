@@ -0,0 +1,81 @@
+#ifndef incl_BADUK_POSITION_H__
+#define incl_BADUK_POSITION_H__
+
+#include <array>
+#include <optional>
+
+#include "board.h"
+#include "game.h"
+#include "hashhistory.h"
+#include "referee.h"
+
+namespace baduk {
+
+// The state of a game held by value: the board, whose turn it is, the
+// last two moves and what the ko rule needs to know about the history.
+// There are no virtual functions and no shared pointers, so playouts
+// and search can keep positions on the stack or in arrays; copying one
+// copies everything, and play() updates it in place.
+class Position final {
+public:
+    Position(
+        Board const& board, Stone next_player, float komi,
+        Rules const& rules = Rules());
+    explicit Position(GameState const& game_state);
+
+    Board const& board() const { return board_; }
+    Stone nextPlayer() const { return next_player_; }
+    float komi() const { return komi_; }
+    Rules const& rules() const { return rules_; }
+    int numMoves() const { return num_moves_; }
+    bool hasLastMove() const { return bool(last_moves_[0]); }
+    Move lastMove() const { return last_moves_[0].value(); }
+    bool isOver() const;
+    bool isMoveLegal(Move const& move) const;
+    bool doesMoveViolateKo(Move const& move) const;
+    /** Every point the next player can legally play. */
+    Bitboard legalMoves() const;
+    zobrist::hashcode hash() const;
+
+    bool operator==(Position const& p) const {
+        return board_ == p.board_ && next_player_ == p.next_player_;
+    }
+
+    /** Apply a move in place. */
+    void play(Move const& move);
+
+private:
+    Board board_;
+    Stone next_player_;
+    float komi_;
+    int num_moves_;
+    // The last two moves, most recent first.
+    std::array<std::optional<Move>, 2> last_moves_;
+    Rules rules_;
+    // Under superko, the hashes of every earlier board or state in the
+    // game. Simple ko only needs the point where the opponent just took
+    // a ko.
+    HashHistory history_;
+    std::optional<Point> ko_point_;
+
+    Referee<HashHistory> referee() const {
+        return Referee<HashHistory>(
+            board_, next_player_, rules_, ko_point_, history_);
+    }
+
+    // For MutableGame: play a move keeping what undo() needs to take it
+    // back. dropped_move is the move that play() pushed out of
+    // last_moves_, and ko_point is the ko point before the move.
+    void play(Move const& move, PlaceUndo& board_undo);
+    void undo(
+        Move const& move,
+        PlaceUndo const& board_undo,
+        std::optional<Move> const& dropped_move,
+        std::optional<Point> const& ko_point);
+
+    friend class MutableGame;
+};
+
+}
+
+#endif
@@ -0,0 +1,100 @@
+#include "referee.h"
+
+namespace baduk {
+
+zobrist::hashcode stateHash(zobrist::hashcode board_hash, Stone next_player) {
+    return board_hash ^ (next_player == Stone::black ?
+        zobrist::BLACK_TO_PLAY :
+        zobrist::WHITE_TO_PLAY);
+}
+
+template <typename History>
+bool Referee<History>::isMoveLegal(Move const& move) const {
+    if (!std::holds_alternative<Play>(move)) {
+        // Passing and resigning are always legal.
+        return true;
+    }
+    const auto point = std::get<Play>(move).point();
+    if (isKoPoint(point)) {
+        return false;
+    }
+    const auto analysis = board_.analyzeMove(point, next_player_);
+    return isLegalIgnoringKo(analysis) && !willViolateSuperko(analysis);
+}
+
+template <typename History>
+bool Referee<History>::doesMoveViolateKo(Move const& move) const {
+    if (!std::holds_alternative<Play>(move)) {
+        return false;
+    }
+    const auto point = std::get<Play>(move).point();
+    if (rules_.ko == KoRule::simple) {
+        // No need to look at the board.
+        return isKoPoint(point);
+    }
+    const auto analysis = board_.analyzeMove(point, next_player_);
+    return isLegalIgnoringKo(analysis) && willViolateSuperko(analysis);
+}
+
+template <typename History>
+Bitboard Referee<History>::legalMoves() const {
+    auto legal = rules_.allow_suicide ?
+        board_.emptyPoints() :
+        board_.candidates(next_player_);
+    if (rules_.ko == KoRule::simple) {
+        if (ko_point_) {
+            legal.reset(*ko_point_);
+        }
+        return legal;
+    }
+    // Under superko, only the moves that remove stones need to be
+    // looked up in the history.
+    auto removing = board_.captures(next_player_);
+    if (rules_.allow_suicide) {
+        removing = removing |
+            board_.emptyPoints().without(board_.candidates(next_player_));
+    }
+    (removing & legal).forEach([&](Point p) {
+        if (willViolateSuperko(board_.analyzeMove(p, next_player_))) {
+            legal.reset(p);
+        }
+    });
+    return legal;
+}
+
+template <typename History>
+zobrist::hashcode Referee<History>::historyHash() const {
+    return rules_.ko == KoRule::positional ?
+        board_.hash() :
+        stateHash(board_.hash(), next_player_);
+}
+
+template <typename History>
+bool Referee<History>::isLegalIgnoringKo(MoveAnalysis const& move) const {
+    return rules_.allow_suicide ? !move.occupied : move.isLegal();
+}
+
+template <typename History>
+bool Referee<History>::willViolateSuperko(MoveAnalysis const& move) const {
+    // Only removing stones can bring back an earlier position.
+    if (!move.isCapture() && !move.isSuicide()) {
+        return false;
+    }
+    // The analysis has the hash of the next board, without actually
+    // computing the full board position.
+    switch (rules_.ko) {
+    case KoRule::simple:
+        return false;
+    case KoRule::positional:
+        // A suicide can leave the board as it is now.
+        return move.hash == board_.hash() || history_.contains(move.hash);
+    case KoRule::situational:
+        break;
+    }
+    return history_.contains(stateHash(move.hash, other(next_player_)));
+}
+
+template class Referee<HashHistory>;
+template class Referee<PersistentHashSet>;
+
+}
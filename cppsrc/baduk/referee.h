@@ -0,0 +1,63 @@
+#ifndef incl_BADUK_REFEREE_H__
+#define incl_BADUK_REFEREE_H__
+
+#include <optional>
+
+#include "board.h"
+#include "game.h"
+#include "hashhistory.h"
+#include "persistenthash.h"
+#include "zobrist/zobrist.h"
+
+namespace baduk {
+
+/** The hash of a game state: a board with next_player to move. */
+zobrist::hashcode stateHash(zobrist::hashcode board_hash, Stone next_player);
+
+// Decides which moves are legal, for both GameState and Position, so
+// that the two can't disagree. A Referee only borrows what it looks
+// at, and is meant to be made on the spot by whoever owns it.
+//
+// History is whatever set the owner keeps its superko hashes in: the
+// earlier boards under positional superko, or the earlier states under
+// situational superko. It isn't looked at under simple ko, where
+// ko_point is the point the opponent just took a ko at, if any.
+template <typename History>
+class Referee {
+public:
+    Referee(
+            Board const& board, Stone next_player, Rules const& rules,
+            std::optional<Point> const& ko_point, History const& history) :
+        board_(board),
+        next_player_(next_player),
+        rules_(rules),
+        ko_point_(ko_point),
+        history_(history) {}
+
+    bool isMoveLegal(Move const& move) const;
+    bool doesMoveViolateKo(Move const& move) const;
+    /** Every point the next player can legally play. */
+    Bitboard legalMoves() const;
+    /** What goes in the history for the position as it is now. */
+    zobrist::hashcode historyHash() const;
+
+private:
+    Board const& board_;
+    Stone next_player_;
+    Rules const& rules_;
+    std::optional<Point> const& ko_point_;
+    History const& history_;
+
+    bool isKoPoint(Point point) const {
+        return ko_point_ && *ko_point_ == point;
+    }
+    bool isLegalIgnoringKo(MoveAnalysis const& move) const;
+    bool willViolateSuperko(MoveAnalysis const& move) const;
+};
+
+extern template class Referee<HashHistory>;
+extern template class Referee<PersistentHashSet>;
+
+}
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef incl_BADUK_RNG_H__
+#define incl_BADUK_RNG_H__
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace baduk {
+
+// A small, fast random number generator for playouts: xoshiro256**,
+// seeded through splitmix64. It meets the standard
+// UniformRandomBitGenerator requirements, so the <random> distributions
+// accept it, but below() is the quick way to pick from n choices.
+//
+// There is deliberately no default seed. Generators built from the same
+// seed and stream produce the same numbers on every platform, and
+// different streams of one seed are independent, so each thread or
+// each playout can have its own stream and still reproduce a run.
+class Rng {
+public:
+    using result_type = std::uint64_t;
+
+    explicit Rng(std::uint64_t seed, std::uint64_t stream = 0) {
+        // Not symmetric in seed and stream, so Rng(a, b) and Rng(b, a)
+        // are different generators.
+        auto x = mix(seed ^ mix(stream + GOLDEN_GAMMA));
+        for (auto& word : state_) {
+            x += GOLDEN_GAMMA;
+            word = mix(x);
+        }
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()() {
+        const auto result = rotl(state_[1] * 5, 7) * 9;
+        const auto t = state_[1] << 17;
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = rotl(state_[3], 45);
+        return result;
+    }
+
+    /** A uniformly distributed number from 0 to n - 1; n must not be
+     * 0. Scales a 32-bit draw by multiplying instead of taking a
+     * remainder, and only divides in the rare case that a draw might
+     * have to be rejected to keep the result unbiased. */
+    std::uint32_t below(std::uint32_t n) {
+        auto m = (operator()() >> 32) * n;
+        auto low = static_cast<std::uint32_t>(m);
+        if (low < n) {
+            const std::uint32_t threshold = (0u - n) % n;
+            while (low < threshold) {
+                m = (operator()() >> 32) * n;
+                low = static_cast<std::uint32_t>(m);
+            }
+        }
+        return static_cast<std::uint32_t>(m >> 32);
+    }
+
+private:
+    static constexpr std::uint64_t GOLDEN_GAMMA = 0x9e3779b97f4a7c15ULL;
+
+    std::array<std::uint64_t, 4> state_;
+
+    static std::uint64_t rotl(std::uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    // The splitmix64 output function.
+    static std::uint64_t mix(std::uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,166 @@
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "playout.h"
+#include "runner.h"
+#include "scoring.h"
+
+namespace baduk {
+
+PlayoutStats::PlayoutStats(unsigned int num_rows, unsigned int num_cols) :
+    num_rows_(num_rows),
+    num_cols_(num_cols),
+    num_playouts_(0),
+    black_wins_(0),
+    score_sum_(0.0),
+    black_owned_(num_rows, num_cols),
+    white_owned_(num_rows, num_cols) {}
+
+void PlayoutStats::add(Board const& final_board, float komi) {
+    const auto tmap = evaluateTerritory(final_board);
+    for (unsigned int r = 0; r < num_rows_; ++r) {
+        for (unsigned int c = 0; c < num_cols_; ++c) {
+            const Point p(r, c);
+            const auto status = tmap.at(p);
+            if (status == PointStatus::black) {
+                black_owned_.increment(p);
+            } else if (status == PointStatus::white) {
+                white_owned_.increment(p);
+            }
+        }
+    }
+    // Scored the same way as playoutScore.
+    const auto score = static_cast<double>(
+        areaDifference(tmap, num_rows_, num_cols_)) - komi;
+    ++num_playouts_;
+    score_sum_ += score;
+    if (score > 0) {
+        ++black_wins_;
+    }
+}
+
+void PlayoutStats::merge(PlayoutStats const& other) {
+    num_playouts_ += other.num_playouts_;
+    black_wins_ += other.black_wins_;
+    score_sum_ += other.score_sum_;
+    black_owned_.merge(other.black_owned_);
+    white_owned_.merge(other.white_owned_);
+}
+
+double PlayoutStats::meanScore() const {
+    return num_playouts_ == 0 ? 0.0 : score_sum_ / num_playouts_;
+}
+
+double PlayoutStats::blackWinRate() const {
+    return num_playouts_ == 0 ?
+        0.0 :
+        static_cast<double>(black_wins_) / num_playouts_;
+}
+
+namespace {
+
+// Light playouts if weights is null.
+PlayoutStats runPlayoutsWith(
+        GameState const& start, unsigned int num_playouts,
+        unsigned int num_threads, std::uint64_t seed,
+        PatternWeights const* weights) {
+    if (num_threads == 0) {
+        num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    num_threads = std::min(num_threads, std::max(1u, num_playouts));
+
+    Board const& start_board = start.board();
+    const auto next_player = start.nextPlayer();
+    const auto komi = start.komi();
+
+    // One set of results per thread, merged once they're all done.
+    std::vector<PlayoutStats> results(
+        num_threads,
+        PlayoutStats(start_board.numRows(), start_board.numCols()));
+    // Playouts are handed out one at a time, so a thread that gets
+    // short games takes more of them. Each playout has its own random
+    // stream, so which thread plays it makes no difference to the
+    // result.
+    std::atomic<unsigned int> next_playout(0);
+    // Handing out the rest of the playouts stops every thread after
+    // the game it's on.
+    const auto stop = [&]() { next_playout = num_playouts; };
+    // An exception can't leave a thread, so each one keeps what it
+    // caught for the calling thread to throw.
+    std::vector<std::exception_ptr> errors(num_threads);
+    const auto work = [&](unsigned int thread) {
+        try {
+            Playout playout;
+            // Counted locally, so threads don't write near each other's
+            // results until they're finished.
+            PlayoutStats stats(
+                start_board.numRows(), start_board.numCols());
+            for (auto i = next_playout++; i < num_playouts;
+                    i = next_playout++) {
+                Rng rng(seed, i);
+                auto board = start_board;
+                if (weights == nullptr) {
+                    playout.run(board, next_player, rng);
+                } else {
+                    playout.run(board, next_player, rng, *weights);
+                }
+                stats.add(board, komi);
+            }
+            results[thread] = stats;
+        } catch (...) {
+            errors[thread] = std::current_exception();
+            stop();
+        }
+    };
+
+    // The calling thread joins in too.
+    std::vector<std::thread> threads;
+    try {
+        for (unsigned int thread = 1; thread < num_threads; ++thread) {
+            threads.emplace_back(work, thread);
+        }
+    } catch (...) {
+        // Destroying a thread that's still running would terminate the
+        // program, so wait for the ones that did start.
+        stop();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        throw;
+    }
+    work(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto const& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    auto stats = results[0];
+    for (unsigned int thread = 1; thread < num_threads; ++thread) {
+        stats.merge(results[thread]);
+    }
+    return stats;
+}
+
+}
+
+PlayoutStats runPlayouts(
+        GameState const& start, unsigned int num_playouts,
+        unsigned int num_threads, std::uint64_t seed) {
+    return runPlayoutsWith(start, num_playouts, num_threads, seed, nullptr);
+}
+
+PlayoutStats runPlayouts(
+        GameState const& start, unsigned int num_playouts,
+        unsigned int num_threads, std::uint64_t seed,
+        PatternWeights const& weights) {
+    return runPlayoutsWith(start, num_playouts, num_threads, seed, &weights);
+}
+
+}
@@ -0,0 +1,62 @@
+#ifndef incl_BADUK_RUNNER_H__
+#define incl_BADUK_RUNNER_H__
+
+#include <cstdint>
+
+#include "board.h"
+#include "counter.h"
+#include "game.h"
+#include "pattern.h"
+
+namespace baduk {
+
+// What a batch of playouts from one position added up to.
+class PlayoutStats {
+public:
+    PlayoutStats(unsigned int num_rows, unsigned int num_cols);
+
+    /** Count one played-out board. */
+    void add(Board const& final_board, float komi);
+    /** Add in the playouts counted in other. */
+    void merge(PlayoutStats const& other);
+
+    unsigned int numPlayouts() const { return num_playouts_; }
+    /** How many playouts ended with each point counted for black, and
+     * for white. */
+    BoardCounter const& blackOwned() const { return black_owned_; }
+    BoardCounter const& whiteOwned() const { return white_owned_; }
+    /** Average of black's area score minus white's and komi. */
+    double meanScore() const;
+    double blackWinRate() const;
+
+private:
+    unsigned int num_rows_;
+    unsigned int num_cols_;
+    unsigned int num_playouts_;
+    unsigned int black_wins_;
+    double score_sum_;
+    BoardCounter black_owned_;
+    BoardCounter white_owned_;
+};
+
+/** Play num_playouts random games from start, spread over num_threads
+ * threads, and merge the results. A num_threads of 0 means one per
+ * core. Each thread plays its share on its own board, so they share
+ * nothing until the end. The games are played by Playout, so only
+ * simple ko is enforced.
+ *
+ * Playout i draws its moves from stream i of seed, whichever thread
+ * it lands on, so a seed gives the same result on any number of
+ * threads. */
+PlayoutStats runPlayouts(
+    GameState const& start, unsigned int num_playouts,
+    unsigned int num_threads, std::uint64_t seed);
+/** The same, with heavy playouts that favor moves by weights. */
+PlayoutStats runPlayouts(
+    GameState const& start, unsigned int num_playouts,
+    unsigned int num_threads, std::uint64_t seed,
+    PatternWeights const& weights);
+
+}
+
+#endif
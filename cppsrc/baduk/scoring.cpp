@@ -1,161 +1,95 @@
-#include <queue>
-#include <set>
-#include "agent.h"
-#include "counter.h"
+#include "runner.h"
 #include "scoring.h"
 
 namespace baduk {
 
 const double DEAD_THRESHOLD = 0.75;
 
-PointStatus TerritoryMap::at(Point p) const {
-    // TODO Should bounds-check p;
-    const auto ptr = map_.find(p);
-    if (ptr != map_.end()) {
-        return ptr->second;
-    }
-    return PointStatus::neutral;
-}
+namespace {
 
-void TerritoryMap::set(Point p, PointStatus s) {
-    map_[p] = s;
+unsigned int statusIndex(Point p) {
+    return p.col() + MAX_BOARD_SIZE * p.row();
 }
 
-struct Boundary {
-    Boundary() : includes_black(false), includes_white(false) {}
-    Boundary(bool b, bool w) : includes_black(b), includes_white(w) {}
-
-    bool includes_black;
-    bool includes_white;
-
-    bool isOnlyBlack() const {
-        return includes_black && !includes_white;
-    }
-
-    bool isOnlyWhite() const {
-        return includes_white && !includes_black;
-    }
-};
+}
 
-Boundary collectBoundary(Board board, Point origin) {
-    Boundary b;
-    std::queue<Point> q;
-    std::set<Point> visited;
+TerritoryMap::TerritoryMap() {
+    status_.fill(PointStatus::neutral);
+}
 
-    const auto check_and_enqueue = [&q, &visited](Point new_point) {
-        if (visited.find(new_point) == visited.end()) {
-            q.push(new_point);
-        }
-    };
-
-    q.push(origin);
-    while (!q.empty()) {
-        const auto p = q.front();
-        q.pop();
-        if (visited.find(p) != visited.end()) {
-            continue;
-        }
-        if (board.isEmpty(p)) {
-            // Enqueue its neighbors.
-            if (p.row() > 0) {
-                check_and_enqueue(Point(p.row() - 1, p.col()));
-            }
-            if (p.row() < board.numRows() - 1) {
-                check_and_enqueue(Point(p.row() + 1, p.col()));
-            }
-            if (p.col() > 0) {
-                check_and_enqueue(Point(p.row(), p.col() - 1));
-            }
-            if (p.col() < board.numCols() - 1) {
-                check_and_enqueue(Point(p.row(), p.col() + 1));
-            }
-        } else {
-            const auto stone = board.at(p);
-            if (stone == Stone::black) {
-                b.includes_black = true;
-            } else {
-                // Not empty, not black, must be white
-                b.includes_white = true;
-            }
-        }
-        visited.insert(p);
-    }
+PointStatus TerritoryMap::at(Point p) const {
+    // TODO Should bounds-check p;
+    return status_[statusIndex(p)];
+}
 
-    return b;
+void TerritoryMap::set(Point p, PointStatus s) {
+    status_[statusIndex(p)] = s;
 }
 
 TerritoryMap evaluateTerritory(Board const& board) {
     TerritoryMap tmap;
 
-    for (unsigned int r = 0; r < board.numRows(); ++r) {
-        for (unsigned int c = 0; c < board.numCols(); ++c) {
-            const Point p(r, c);
-            if (board.isEmpty(p)) {
-                // If it is empty, figure out the surrounding stones. If
-                // they are exclusively one color, it's territory. Otherwise
-                // it's dame.
-                const auto boundary = collectBoundary(board, p);
-                if (boundary.isOnlyBlack()) {
-                    tmap.set(p, PointStatus::black);
-                } else if (boundary.isOnlyWhite()) {
-                    tmap.set(p, PointStatus::white);
-                } else {
-                    tmap.set(p, PointStatus::neutral);
-                }
-            } else {
-                // If it contains a stone, count it for that color (chinese
-                // style)
-                const auto stone = board.at(p);
-                if (stone == Stone::black) {
-                    tmap.set(p, PointStatus::black);
-                } else {
-                    // not empty, not black, must be white
-                    tmap.set(p, PointStatus::white);
-                }
-            }
+    // Stones count for their own color (chinese style).
+    const auto black = board.stones(Stone::black);
+    const auto white = board.stones(Stone::white);
+    black.forEach([&tmap](Point p) { tmap.set(p, PointStatus::black); });
+    white.forEach([&tmap](Point p) { tmap.set(p, PointStatus::white); });
+
+    // Each connected empty region is territory if the stones around it
+    // are exclusively one color. Otherwise it's dame.
+    const auto on_board = Bitboard::full(board.numRows(), board.numCols());
+    auto unvisited = board.emptyPoints();
+    while (unvisited.any()) {
+        Bitboard region;
+        region.set(unvisited.first());
+        region = region.floodFill(unvisited);
+        unvisited = unvisited.without(region);
+
+        const auto boundary = region.dilate(on_board);
+        const bool touches_black = (boundary & black).any();
+        const bool touches_white = (boundary & white).any();
+        auto status = PointStatus::neutral;
+        if (touches_black && !touches_white) {
+            status = PointStatus::black;
+        } else if (touches_white && !touches_black) {
+            status = PointStatus::white;
         }
+        region.forEach([&tmap, status](Point p) { tmap.set(p, status); });
     }
 
     return tmap;
 }
 
-std::shared_ptr<const GameState> completeGame(
-        std::shared_ptr<const GameState> start) {
-    RandomBot bot;
-
-    auto game = start;
-    while (!game->isOver()) {
-        const auto next_move = bot.selectMove(*game);
-        game = game->applyMove(next_move);
+int areaDifference(
+        TerritoryMap const& tmap,
+        unsigned int num_rows, unsigned int num_cols) {
+    int black_minus_white = 0;
+    for (unsigned int r = 0; r < num_rows; ++r) {
+        for (unsigned int c = 0; c < num_cols; ++c) {
+            const auto status = tmap.at(Point(r, c));
+            if (status == PointStatus::black) {
+                ++black_minus_white;
+            } else if (status == PointStatus::white) {
+                --black_minus_white;
+            }
+        }
     }
-    return game;
+    return black_minus_white;
 }
 
-Board removeDeadStones(std::shared_ptr<const GameState> game) {
+Board removeDeadStones(
+        std::shared_ptr<const GameState> game, std::uint64_t seed) {
     const unsigned int num_rounds = 1000;
     const auto orig_board = game->board();
     const auto num_rows = orig_board.numRows();
     const auto num_cols = orig_board.numCols();
-    BoardCounter b_count(num_rows, num_cols);
-    BoardCounter w_count(num_rows, num_cols);
-    for (unsigned int num_done = 0; num_done < num_rounds; ++num_done) {
-        // Randomly complete the game
-        const auto final_state = completeGame(game);
-        // Score the result
-        const auto tmap = evaluateTerritory(final_state->board());
-        // Count up the status
-        for (unsigned int r = 0; r < num_rows; ++r) {
-            for (unsigned int c = 0; c < num_cols; ++c) {
-                const Point p(r, c);
-                const auto status = tmap.at(p);
-                if (status == PointStatus::black) {
-                    b_count.increment(p);
-                } else if (status == PointStatus::white) {
-                    w_count.increment(p);
-                }
-            }
-        }
-    }
+    // Complete the game many times over, on every core. Heavy playouts
+    // capture stones in atari and save their own much as real players
+    // would, so weak groups aren't decided by random blunders.
+    const auto stats = runPlayouts(
+        *game, num_rounds, 0, seed, PatternWeights::defaults());
+    auto const& b_count = stats.blackOwned();
+    auto const& w_count = stats.whiteOwned();
 
     // Remove dead stones.
     Board cleaned_board(num_rows, num_cols);
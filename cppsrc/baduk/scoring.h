@@ -1,9 +1,11 @@
 #ifndef incl_BADUK_SCORING_H__
 #define incl_BADUK_SCORING_H__
 
-#include <map>
+#include <array>
+#include <cstdint>
 
 #include "board.h"
+#include "dim.h"
 #include "game.h"
 
 namespace baduk {
@@ -12,16 +14,26 @@ enum class PointStatus { black, white, neutral };
 
 class TerritoryMap {
 public:
+    TerritoryMap();
+
     PointStatus at(Point) const;
     void set(Point, PointStatus);
 
 private:
-    std::map<Point, PointStatus> map_;
+    std::array<PointStatus, MAX_POINTS> status_;
 };
 
 TerritoryMap evaluateTerritory(Board const&);
 
-Board removeDeadStones(std::shared_ptr<const GameState> game);
+/** Points counted for black minus points counted for white, over the
+ * first num_rows by num_cols points of tmap. */
+int areaDifference(
+    TerritoryMap const& tmap, unsigned int num_rows, unsigned int num_cols);
+
+/** Estimate which stones are dead by playing the game out many times
+ * with heavy playouts. The same seed always gives the same answer. */
+Board removeDeadStones(
+    std::shared_ptr<const GameState> game, std::uint64_t seed);
 
 }
 
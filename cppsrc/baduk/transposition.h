@@ -0,0 +1,195 @@
+#ifndef incl_BADUK_TRANSPOSITION_H__
+#define incl_BADUK_TRANSPOSITION_H__
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "zobrist/zobrist.h"
+
+namespace baduk {
+
+// Replacement policies for TranspositionTable. When a bucket is full,
+// the table offers each entry in turn to replaces(incoming, existing)
+// and overwrites the first one it accepts; if none is accepted, the new
+// result is dropped. A position already in the table is always updated.
+struct AlwaysReplace {
+    template<typename Payload>
+    static bool replaces(Payload const&, Payload const&) { return true; }
+};
+
+// For payloads with a depth member: keep the results of the deeper
+// searches.
+struct ReplaceIfDeeper {
+    template<typename Payload>
+    static bool replaces(Payload const& incoming, Payload const& existing) {
+        return incoming.depth >= existing.depth;
+    }
+};
+
+struct TranspositionStats {
+    std::uint64_t hits;
+    std::uint64_t misses;
+    std::uint64_t stores;
+    // Stores that evicted a different position.
+    std::uint64_t replacements;
+    // Stores the replacement policy turned away.
+    std::uint64_t rejections;
+};
+
+// A fixed-size cache of per-position results, keyed on
+// GameState::hash() or Position::hash(), that any number of threads can
+// share.
+//
+// Entries are grouped into buckets of one cache line each, so a lookup
+// touches a single line. Buckets are guarded by a fixed set of striped
+// locks: two threads only contend if their positions land on the same
+// stripe, and a lookup holds the lock just long enough to copy one
+// payload out. Payload should be small and trivially copyable. The
+// statistics are counted per stripe under the same lock, so keeping
+// them adds no shared writes.
+template<typename Payload, typename Policy = AlwaysReplace>
+class TranspositionTable {
+public:
+    static const std::size_t CACHE_LINE = 64;
+
+    /** Room for at least num_entries results, rounded up to a power of
+     * two number of buckets. */
+    explicit TranspositionTable(std::size_t num_entries) :
+            buckets_(bucketCount(num_entries)),
+            mask_(buckets_.size() - 1) {}
+    TranspositionTable(TranspositionTable const&) = delete;
+    TranspositionTable& operator=(TranspositionTable const&) = delete;
+
+    std::size_t capacity() const { return buckets_.size() * WAYS; }
+
+    std::optional<Payload> lookup(zobrist::hashcode key) {
+        auto& bucket = bucketFor(key);
+        auto& stripe = stripeFor(key);
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        for (auto const& entry : bucket.entries) {
+            if (entry.used && entry.key == key) {
+                ++stripe.stats.hits;
+                return entry.value;
+            }
+        }
+        ++stripe.stats.misses;
+        return std::nullopt;
+    }
+
+    void store(zobrist::hashcode key, Payload const& value) {
+        auto& bucket = bucketFor(key);
+        auto& stripe = stripeFor(key);
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        Entry* empty = nullptr;
+        for (auto& entry : bucket.entries) {
+            if (entry.used && entry.key == key) {
+                entry.value = value;
+                ++stripe.stats.stores;
+                return;
+            }
+            if (!entry.used && empty == nullptr) {
+                empty = &entry;
+            }
+        }
+        if (empty != nullptr) {
+            *empty = Entry{key, value, true};
+            ++stripe.stats.stores;
+            return;
+        }
+        // Start the search for a victim at a different way for each
+        // key, so AlwaysReplace doesn't keep evicting the same entry.
+        const auto start =
+            static_cast<std::size_t>(zobrist::lowBits(key) >> 32) % WAYS;
+        for (std::size_t i = 0; i < WAYS; ++i) {
+            auto& entry = bucket.entries[(start + i) % WAYS];
+            if (Policy::replaces(value, entry.value)) {
+                entry = Entry{key, value, true};
+                ++stripe.stats.stores;
+                ++stripe.stats.replacements;
+                return;
+            }
+        }
+        ++stripe.stats.rejections;
+    }
+
+    /** Forget every entry. Not safe to call while other threads are
+     * using the table. */
+    void clear() {
+        std::fill(buckets_.begin(), buckets_.end(), Bucket());
+        for (auto& stripe : stripes_) {
+            stripe.stats = TranspositionStats{};
+        }
+    }
+
+    /** Totals over every stripe. Takes each stripe's lock in turn, so
+     * the counts from a busy table are only roughly simultaneous. */
+    TranspositionStats stats() const {
+        TranspositionStats total{};
+        for (auto& stripe : stripes_) {
+            std::lock_guard<std::mutex> lock(stripe.mutex);
+            total.hits += stripe.stats.hits;
+            total.misses += stripe.stats.misses;
+            total.stores += stripe.stats.stores;
+            total.replacements += stripe.stats.replacements;
+            total.rejections += stripe.stats.rejections;
+        }
+        return total;
+    }
+
+private:
+    struct Entry {
+        zobrist::hashcode key;
+        Payload value;
+        bool used;
+    };
+
+    // As many entries as fit in a cache line, but at least one.
+    static const std::size_t WAYS =
+        sizeof(Entry) >= CACHE_LINE ? 1 : CACHE_LINE / sizeof(Entry);
+
+    struct alignas(CACHE_LINE) Bucket {
+        std::array<Entry, WAYS> entries{};
+    };
+
+    // A lock and the counts for the buckets it guards.
+    struct alignas(CACHE_LINE) Stripe {
+        std::mutex mutex;
+        TranspositionStats stats{};
+    };
+
+    static const std::size_t NUM_STRIPES = 256;
+
+    std::vector<Bucket> buckets_;
+    std::size_t mask_;
+    // Mutable so that stats() can lock them.
+    mutable std::array<Stripe, NUM_STRIPES> stripes_;
+
+    static std::size_t bucketCount(std::size_t num_entries) {
+        std::size_t count = 1;
+        while (count * WAYS < num_entries) {
+            count *= 2;
+        }
+        return count;
+    }
+
+    Bucket& bucketFor(zobrist::hashcode key) {
+        const auto bucket =
+            static_cast<std::size_t>(zobrist::lowBits(key)) & mask_;
+        return buckets_[bucket];
+    }
+
+    // Keys in the same bucket must share a stripe.
+    Stripe& stripeFor(zobrist::hashcode key) {
+        const auto bucket =
+            static_cast<std::size_t>(zobrist::lowBits(key)) & mask_;
+        return stripes_[bucket % NUM_STRIPES];
+    }
+};
+
+}
+
+#endif
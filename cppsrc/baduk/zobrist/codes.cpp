@@ -1,1889 +0,0 @@
-#include "zobrist.h"
-
-namespace baduk {
-namespace zobrist {
-
-void ZobristCodes::initialize() {
-    empty_codes_.resize(25 * 25);
-    empty_codes_[index(::baduk::Point(0, 0))] = 3585600138055221254LL;
-    empty_codes_[index(::baduk::Point(0, 1))] = 8124587972890615857LL;
-    empty_codes_[index(::baduk::Point(0, 2))] = 8263392243105302934LL;
-    empty_codes_[index(::baduk::Point(0, 3))] = 6503207118146915764LL;
-    empty_codes_[index(::baduk::Point(0, 4))] = 7921397879887992570LL;
-    empty_codes_[index(::baduk::Point(0, 5))] = 817907097906826117LL;
-    empty_codes_[index(::baduk::Point(0, 6))] = 353013120859504215LL;
-    empty_codes_[index(::baduk::Point(0, 7))] = 6373085944173749704LL;
-    empty_codes_[index(::baduk::Point(0, 8))] = 5351186294823349692LL;
-    empty_codes_[index(::baduk::Point(0, 9))] = 7881266402939002988LL;
-    empty_codes_[index(::baduk::Point(0, 10))] = 2806541085859545552LL;
-    empty_codes_[index(::baduk::Point(0, 11))] = 2320964994793311589LL;
-    empty_codes_[index(::baduk::Point(0, 12))] = 125493801020170958LL;
-    empty_codes_[index(::baduk::Point(0, 13))] = 7539723779833777351LL;
-    empty_codes_[index(::baduk::Point(0, 14))] = 2457409816221652613LL;
-    empty_codes_[index(::baduk::Point(0, 15))] = 2037553193986069569LL;
-    empty_codes_[index(::baduk::Point(0, 16))] = 7185752698487015966LL;
-    empty_codes_[index(::baduk::Point(0, 17))] = 4427355967064674433LL;
-    empty_codes_[index(::baduk::Point(0, 18))] = 1434205958596016703LL;
-    empty_codes_[index(::baduk::Point(0, 19))] = 3150257612049730443LL;
-    empty_codes_[index(::baduk::Point(0, 20))] = 1220123700029692942LL;
-    empty_codes_[index(::baduk::Point(0, 21))] = 4533965901535448400LL;
-    empty_codes_[index(::baduk::Point(0, 22))] = 5266603404206810148LL;
-    empty_codes_[index(::baduk::Point(0, 23))] = 5450964861605245679LL;
-    empty_codes_[index(::baduk::Point(0, 24))] = 8436767532202279115LL;
-    empty_codes_[index(::baduk::Point(1, 0))] = 7760869206835468584LL;
-    empty_codes_[index(::baduk::Point(1, 1))] = 6387397021714165312LL;
-    empty_codes_[index(::baduk::Point(1, 2))] = 8726497926412174048LL;
-    empty_codes_[index(::baduk::Point(1, 3))] = 587890582172698326LL;
-    empty_codes_[index(::baduk::Point(1, 4))] = 7715997925499721416LL;
-    empty_codes_[index(::baduk::Point(1, 5))] = 1743562011189485593LL;
-    empty_codes_[index(::baduk::Point(1, 6))] = 3234114492143803356LL;
-    empty_codes_[index(::baduk::Point(1, 7))] = 7530939190955631479LL;
-    empty_codes_[index(::baduk::Point(1, 8))] = 3964629821229440616LL;
-    empty_codes_[index(::baduk::Point(1, 9))] = 3386885422656199506LL;
-    empty_codes_[index(::baduk::Point(1, 10))] = 6097620987455956893LL;
-    empty_codes_[index(::baduk::Point(1, 11))] = 5807145452924129918LL;
-    empty_codes_[index(::baduk::Point(1, 12))] = 6247193136664291525LL;
-    empty_codes_[index(::baduk::Point(1, 13))] = 4884935637258243063LL;
-    empty_codes_[index(::baduk::Point(1, 14))] = 2324430586455296421LL;
-    empty_codes_[index(::baduk::Point(1, 15))] = 5727888829743968437LL;
-    empty_codes_[index(::baduk::Point(1, 16))] = 6289389495884229858LL;
-    empty_codes_[index(::baduk::Point(1, 17))] = 5896291913964840637LL;
-    empty_codes_[index(::baduk::Point(1, 18))] = 1652949141547635287LL;
-    empty_codes_[index(::baduk::Point(1, 19))] = 447160202995561927LL;
-    empty_codes_[index(::baduk::Point(1, 20))] = 1404984876860585849LL;
-    empty_codes_[index(::baduk::Point(1, 21))] = 3787340584371158086LL;
-    empty_codes_[index(::baduk::Point(1, 22))] = 9144251203607206159LL;
-    empty_codes_[index(::baduk::Point(1, 23))] = 4045917069183655960LL;
-    empty_codes_[index(::baduk::Point(1, 24))] = 4889350040150423209LL;
-    empty_codes_[index(::baduk::Point(2, 0))] = 918128384689680506LL;
-    empty_codes_[index(::baduk::Point(2, 1))] = 7486953876158886477LL;
-    empty_codes_[index(::baduk::Point(2, 2))] = 1059284342836605357LL;
-    empty_codes_[index(::baduk::Point(2, 3))] = 711945423734779049LL;
-    empty_codes_[index(::baduk::Point(2, 4))] = 1444689020075054218LL;
-    empty_codes_[index(::baduk::Point(2, 5))] = 4614958907698841134LL;
-    empty_codes_[index(::baduk::Point(2, 6))] = 5400493838112677443LL;
-    empty_codes_[index(::baduk::Point(2, 7))] = 8205747836369911986LL;
-    empty_codes_[index(::baduk::Point(2, 8))] = 1842872842522273586LL;
-    empty_codes_[index(::baduk::Point(2, 9))] = 4921938083314012114LL;
-    empty_codes_[index(::baduk::Point(2, 10))] = 1390146055924809879LL;
-    empty_codes_[index(::baduk::Point(2, 11))] = 1543700884305803708LL;
-    empty_codes_[index(::baduk::Point(2, 12))] = 6054078557214293011LL;
-    empty_codes_[index(::baduk::Point(2, 13))] = 6317463161970432148LL;
-    empty_codes_[index(::baduk::Point(2, 14))] = 4448315712018918324LL;
-    empty_codes_[index(::baduk::Point(2, 15))] = 7277252066100846293LL;
-    empty_codes_[index(::baduk::Point(2, 16))] = 4964828697491673454LL;
-    empty_codes_[index(::baduk::Point(2, 17))] = 4675481527225255103LL;
-    empty_codes_[index(::baduk::Point(2, 18))] = 3628961053222813023LL;
-    empty_codes_[index(::baduk::Point(2, 19))] = 7233065107626843832LL;
-    empty_codes_[index(::baduk::Point(2, 20))] = 5939707955763516403LL;
-    empty_codes_[index(::baduk::Point(2, 21))] = 708106281537369314LL;
-    empty_codes_[index(::baduk::Point(2, 22))] = 1770082109523879091LL;
-    empty_codes_[index(::baduk::Point(2, 23))] = 2785788499802885510LL;
-    empty_codes_[index(::baduk::Point(2, 24))] = 7422243717946429692LL;
-    empty_codes_[index(::baduk::Point(3, 0))] = 2164249059831910191LL;
-    empty_codes_[index(::baduk::Point(3, 1))] = 415499734940385904LL;
-    empty_codes_[index(::baduk::Point(3, 2))] = 1818840891318856929LL;
-    empty_codes_[index(::baduk::Point(3, 3))] = 6459238462234081286LL;
-    empty_codes_[index(::baduk::Point(3, 4))] = 3444464190932451902LL;
-    empty_codes_[index(::baduk::Point(3, 5))] = 8213040306272763286LL;
-    empty_codes_[index(::baduk::Point(3, 6))] = 5385999510319421839LL;
-    empty_codes_[index(::baduk::Point(3, 7))] = 745444049443391705LL;
-    empty_codes_[index(::baduk::Point(3, 8))] = 7327840057615989614LL;
-    empty_codes_[index(::baduk::Point(3, 9))] = 1307987550680482585LL;
-    empty_codes_[index(::baduk::Point(3, 10))] = 7847112244450281088LL;
-    empty_codes_[index(::baduk::Point(3, 11))] = 4916389833627466799LL;
-    empty_codes_[index(::baduk::Point(3, 12))] = 1169521847100272821LL;
-    empty_codes_[index(::baduk::Point(3, 13))] = 5311494035134783247LL;
-    empty_codes_[index(::baduk::Point(3, 14))] = 4956249607497983414LL;
-    empty_codes_[index(::baduk::Point(3, 15))] = 2086881710671325557LL;
-    empty_codes_[index(::baduk::Point(3, 16))] = 4225692073644779583LL;
-    empty_codes_[index(::baduk::Point(3, 17))] = 3108796594284602890LL;
-    empty_codes_[index(::baduk::Point(3, 18))] = 4764820668930635186LL;
-    empty_codes_[index(::baduk::Point(3, 19))] = 4415260171884023497LL;
-    empty_codes_[index(::baduk::Point(3, 20))] = 7490848489901337216LL;
-    empty_codes_[index(::baduk::Point(3, 21))] = 1458038691866860228LL;
-    empty_codes_[index(::baduk::Point(3, 22))] = 8203380276357716781LL;
-    empty_codes_[index(::baduk::Point(3, 23))] = 4757069998309967704LL;
-    empty_codes_[index(::baduk::Point(3, 24))] = 5713256817493373692LL;
-    empty_codes_[index(::baduk::Point(4, 0))] = 7857117774098027550LL;
-    empty_codes_[index(::baduk::Point(4, 1))] = 4679141340270815255LL;
-    empty_codes_[index(::baduk::Point(4, 2))] = 2787327604113043110LL;
-    empty_codes_[index(::baduk::Point(4, 3))] = 5012061019687181816LL;
-    empty_codes_[index(::baduk::Point(4, 4))] = 2003212712570062778LL;
-    empty_codes_[index(::baduk::Point(4, 5))] = 1598803714940593018LL;
-    empty_codes_[index(::baduk::Point(4, 6))] = 6059566119984546882LL;
-    empty_codes_[index(::baduk::Point(4, 7))] = 3916324102446745520LL;
-    empty_codes_[index(::baduk::Point(4, 8))] = 3980827874196403062LL;
-    empty_codes_[index(::baduk::Point(4, 9))] = 3540379722224766825LL;
-    empty_codes_[index(::baduk::Point(4, 10))] = 2510822245762151838LL;
-    empty_codes_[index(::baduk::Point(4, 11))] = 1926519843196044980LL;
-    empty_codes_[index(::baduk::Point(4, 12))] = 4668234885632679397LL;
-    empty_codes_[index(::baduk::Point(4, 13))] = 8859939138198416011LL;
-    empty_codes_[index(::baduk::Point(4, 14))] = 8346821890689561528LL;
-    empty_codes_[index(::baduk::Point(4, 15))] = 1852686474736878377LL;
-    empty_codes_[index(::baduk::Point(4, 16))] = 7228547622229848876LL;
-    empty_codes_[index(::baduk::Point(4, 17))] = 8881110804267976912LL;
-    empty_codes_[index(::baduk::Point(4, 18))] = 2620070780692297253LL;
-    empty_codes_[index(::baduk::Point(4, 19))] = 3863841397539670834LL;
-    empty_codes_[index(::baduk::Point(4, 20))] = 7658003753792646546LL;
-    empty_codes_[index(::baduk::Point(4, 21))] = 5912873618788417126LL;
-    empty_codes_[index(::baduk::Point(4, 22))] = 2468126788890268439LL;
-    empty_codes_[index(::baduk::Point(4, 23))] = 6040903873826004753LL;
-    empty_codes_[index(::baduk::Point(4, 24))] = 3232759658823277051LL;
-    empty_codes_[index(::baduk::Point(5, 0))] = 6144188246103882173LL;
-    empty_codes_[index(::baduk::Point(5, 1))] = 6306926152280659742LL;
-    empty_codes_[index(::baduk::Point(5, 2))] = 634549168309226409LL;
-    empty_codes_[index(::baduk::Point(5, 3))] = 2953458797845402104LL;
-    empty_codes_[index(::baduk::Point(5, 4))] = 6939297327344990690LL;
-    empty_codes_[index(::baduk::Point(5, 5))] = 2222886470794222228LL;
-    empty_codes_[index(::baduk::Point(5, 6))] = 2269368687898042400LL;
-    empty_codes_[index(::baduk::Point(5, 7))] = 3435676890665260497LL;
-    empty_codes_[index(::baduk::Point(5, 8))] = 7469011514732645352LL;
-    empty_codes_[index(::baduk::Point(5, 9))] = 6296672368615143181LL;
-    empty_codes_[index(::baduk::Point(5, 10))] = 4730720517202403982LL;
-    empty_codes_[index(::baduk::Point(5, 11))] = 3865084772231701851LL;
-    empty_codes_[index(::baduk::Point(5, 12))] = 4314331711508180792LL;
-    empty_codes_[index(::baduk::Point(5, 13))] = 3995608484175132408LL;
-    empty_codes_[index(::baduk::Point(5, 14))] = 3193262142434912495LL;
-    empty_codes_[index(::baduk::Point(5, 15))] = 3967348299705378752LL;
-    empty_codes_[index(::baduk::Point(5, 16))] = 8835167863222072870LL;
-    empty_codes_[index(::baduk::Point(5, 17))] = 2280394490098062129LL;
-    empty_codes_[index(::baduk::Point(5, 18))] = 7490444455461072302LL;
-    empty_codes_[index(::baduk::Point(5, 19))] = 1512659780921203350LL;
-    empty_codes_[index(::baduk::Point(5, 20))] = 7109755410349401842LL;
-    empty_codes_[index(::baduk::Point(5, 21))] = 1241305615398001966LL;
-    empty_codes_[index(::baduk::Point(5, 22))] = 5544710323716670480LL;
-    empty_codes_[index(::baduk::Point(5, 23))] = 8098699855028703101LL;
-    empty_codes_[index(::baduk::Point(5, 24))] = 7763708182647423437LL;
-    empty_codes_[index(::baduk::Point(6, 0))] = 8109605161313245898LL;
-    empty_codes_[index(::baduk::Point(6, 1))] = 2116268018316476451LL;
-    empty_codes_[index(::baduk::Point(6, 2))] = 7364989143465457255LL;
-    empty_codes_[index(::baduk::Point(6, 3))] = 7874481275951487823LL;
-    empty_codes_[index(::baduk::Point(6, 4))] = 3566064826826959341LL;
-    empty_codes_[index(::baduk::Point(6, 5))] = 7309293522189362443LL;
-    empty_codes_[index(::baduk::Point(6, 6))] = 1049872864771578487LL;
-    empty_codes_[index(::baduk::Point(6, 7))] = 5646352648070435983LL;
-    empty_codes_[index(::baduk::Point(6, 8))] = 3805742992844265758LL;
-    empty_codes_[index(::baduk::Point(6, 9))] = 5146332641958147695LL;
-    empty_codes_[index(::baduk::Point(6, 10))] = 8279473022649136482LL;
-    empty_codes_[index(::baduk::Point(6, 11))] = 7918098311961085395LL;
-    empty_codes_[index(::baduk::Point(6, 12))] = 1647970682911322935LL;
-    empty_codes_[index(::baduk::Point(6, 13))] = 1690837146332901123LL;
-    empty_codes_[index(::baduk::Point(6, 14))] = 4800971880494378642LL;
-    empty_codes_[index(::baduk::Point(6, 15))] = 5563180987171410318LL;
-    empty_codes_[index(::baduk::Point(6, 16))] = 225728750917562812LL;
-    empty_codes_[index(::baduk::Point(6, 17))] = 5354582975447047277LL;
-    empty_codes_[index(::baduk::Point(6, 18))] = 8544953445129127338LL;
-    empty_codes_[index(::baduk::Point(6, 19))] = 3139414663921444421LL;
-    empty_codes_[index(::baduk::Point(6, 20))] = 1947238639830029949LL;
-    empty_codes_[index(::baduk::Point(6, 21))] = 8915225211944227743LL;
-    empty_codes_[index(::baduk::Point(6, 22))] = 6985509443676474014LL;
-    empty_codes_[index(::baduk::Point(6, 23))] = 8024448300779576554LL;
-    empty_codes_[index(::baduk::Point(6, 24))] = 4217951216002814706LL;
-    empty_codes_[index(::baduk::Point(7, 0))] = 6094952851283609984LL;
-    empty_codes_[index(::baduk::Point(7, 1))] = 6908173032469098368LL;
-    empty_codes_[index(::baduk::Point(7, 2))] = 315998682721121510LL;
-    empty_codes_[index(::baduk::Point(7, 3))] = 1541081080471926728LL;
-    empty_codes_[index(::baduk::Point(7, 4))] = 4637028840244770086LL;
-    empty_codes_[index(::baduk::Point(7, 5))] = 4923089496508063722LL;
-    empty_codes_[index(::baduk::Point(7, 6))] = 5591573308387528926LL;
-    empty_codes_[index(::baduk::Point(7, 7))] = 8939428973510356685LL;
-    empty_codes_[index(::baduk::Point(7, 8))] = 5533391743658744182LL;
-    empty_codes_[index(::baduk::Point(7, 9))] = 9108381668852909925LL;
-    empty_codes_[index(::baduk::Point(7, 10))] = 3205007261606325310LL;
-    empty_codes_[index(::baduk::Point(7, 11))] = 6066180664739430196LL;
-    empty_codes_[index(::baduk::Point(7, 12))] = 5363764773910714764LL;
-    empty_codes_[index(::baduk::Point(7, 13))] = 3495579960702420336LL;
-    empty_codes_[index(::baduk::Point(7, 14))] = 7555110821718280593LL;
-    empty_codes_[index(::baduk::Point(7, 15))] = 3658615796725127465LL;
-    empty_codes_[index(::baduk::Point(7, 16))] = 2174798497878056061LL;
-    empty_codes_[index(::baduk::Point(7, 17))] = 5663060519771808455LL;
-    empty_codes_[index(::baduk::Point(7, 18))] = 1138553622462609741LL;
-    empty_codes_[index(::baduk::Point(7, 19))] = 624498015551847183LL;
-    empty_codes_[index(::baduk::Point(7, 20))] = 6744111109498511181LL;
-    empty_codes_[index(::baduk::Point(7, 21))] = 4815192833447055916LL;
-    empty_codes_[index(::baduk::Point(7, 22))] = 8399433480721198860LL;
-    empty_codes_[index(::baduk::Point(7, 23))] = 7979806217252736268LL;
-    empty_codes_[index(::baduk::Point(7, 24))] = 5040225366082886791LL;
-    empty_codes_[index(::baduk::Point(8, 0))] = 829110319175281145LL;
-    empty_codes_[index(::baduk::Point(8, 1))] = 8362493178824453346LL;
-    empty_codes_[index(::baduk::Point(8, 2))] = 3974445661034289815LL;
-    empty_codes_[index(::baduk::Point(8, 3))] = 4928795325734049954LL;
-    empty_codes_[index(::baduk::Point(8, 4))] = 460364475319939620LL;
-    empty_codes_[index(::baduk::Point(8, 5))] = 2671796703519182439LL;
-    empty_codes_[index(::baduk::Point(8, 6))] = 7143367658933172712LL;
-    empty_codes_[index(::baduk::Point(8, 7))] = 614161820343027720LL;
-    empty_codes_[index(::baduk::Point(8, 8))] = 6892174491912114032LL;
-    empty_codes_[index(::baduk::Point(8, 9))] = 1863845472529929898LL;
-    empty_codes_[index(::baduk::Point(8, 10))] = 3464565751744353556LL;
-    empty_codes_[index(::baduk::Point(8, 11))] = 147322359888426386LL;
-    empty_codes_[index(::baduk::Point(8, 12))] = 7853867687209798887LL;
-    empty_codes_[index(::baduk::Point(8, 13))] = 1017751521902496960LL;
-    empty_codes_[index(::baduk::Point(8, 14))] = 1166394975656447031LL;
-    empty_codes_[index(::baduk::Point(8, 15))] = 2707782103383565891LL;
-    empty_codes_[index(::baduk::Point(8, 16))] = 8689813260795725746LL;
-    empty_codes_[index(::baduk::Point(8, 17))] = 4754841152194611440LL;
-    empty_codes_[index(::baduk::Point(8, 18))] = 3449640410786801499LL;
-    empty_codes_[index(::baduk::Point(8, 19))] = 5080618187379024613LL;
-    empty_codes_[index(::baduk::Point(8, 20))] = 5209757290924094838LL;
-    empty_codes_[index(::baduk::Point(8, 21))] = 5758519197346451815LL;
-    empty_codes_[index(::baduk::Point(8, 22))] = 5589055474765057416LL;
-    empty_codes_[index(::baduk::Point(8, 23))] = 6152465514723636820LL;
-    empty_codes_[index(::baduk::Point(8, 24))] = 8998299876339982093LL;
-    empty_codes_[index(::baduk::Point(9, 0))] = 5205905465723568717LL;
-    empty_codes_[index(::baduk::Point(9, 1))] = 4715854361605027940LL;
-    empty_codes_[index(::baduk::Point(9, 2))] = 1332104997770872194LL;
-    empty_codes_[index(::baduk::Point(9, 3))] = 4246847351305060101LL;
-    empty_codes_[index(::baduk::Point(9, 4))] = 747707807345639160LL;
-    empty_codes_[index(::baduk::Point(9, 5))] = 8665085402367353702LL;
-    empty_codes_[index(::baduk::Point(9, 6))] = 4132046982688228494LL;
-    empty_codes_[index(::baduk::Point(9, 7))] = 4457139219872279631LL;
-    empty_codes_[index(::baduk::Point(9, 8))] = 5959884894883449185LL;
-    empty_codes_[index(::baduk::Point(9, 9))] = 3293749883302529924LL;
-    empty_codes_[index(::baduk::Point(9, 10))] = 7808445058192894488LL;
-    empty_codes_[index(::baduk::Point(9, 11))] = 3997914453032047766LL;
-    empty_codes_[index(::baduk::Point(9, 12))] = 5277197667356452164LL;
-    empty_codes_[index(::baduk::Point(9, 13))] = 3594057923126361856LL;
-    empty_codes_[index(::baduk::Point(9, 14))] = 2492984311741001030LL;
-    empty_codes_[index(::baduk::Point(9, 15))] = 6184349321191728064LL;
-    empty_codes_[index(::baduk::Point(9, 16))] = 468519189170000387LL;
-    empty_codes_[index(::baduk::Point(9, 17))] = 2473077946382686798LL;
-    empty_codes_[index(::baduk::Point(9, 18))] = 5912682188623978993LL;
-    empty_codes_[index(::baduk::Point(9, 19))] = 2272116329128107899LL;
-    empty_codes_[index(::baduk::Point(9, 20))] = 6329150762266122253LL;
-    empty_codes_[index(::baduk::Point(9, 21))] = 7533313986209834582LL;
-    empty_codes_[index(::baduk::Point(9, 22))] = 4706526870514309354LL;
-    empty_codes_[index(::baduk::Point(9, 23))] = 7126137473817968580LL;
-    empty_codes_[index(::baduk::Point(9, 24))] = 1331523838181655339LL;
-    empty_codes_[index(::baduk::Point(10, 0))] = 2962974937423054674LL;
-    empty_codes_[index(::baduk::Point(10, 1))] = 1190270215337658517LL;
-    empty_codes_[index(::baduk::Point(10, 2))] = 7126779398033311472LL;
-    empty_codes_[index(::baduk::Point(10, 3))] = 9007374586585759129LL;
-    empty_codes_[index(::baduk::Point(10, 4))] = 6840118227734524497LL;
-    empty_codes_[index(::baduk::Point(10, 5))] = 8635382413065310527LL;
-    empty_codes_[index(::baduk::Point(10, 6))] = 8318559016580857958LL;
-    empty_codes_[index(::baduk::Point(10, 7))] = 8141771154163882339LL;
-    empty_codes_[index(::baduk::Point(10, 8))] = 2103145462451693035LL;
-    empty_codes_[index(::baduk::Point(10, 9))] = 1888049456345468059LL;
-    empty_codes_[index(::baduk::Point(10, 10))] = 25402245264716441LL;
-    empty_codes_[index(::baduk::Point(10, 11))] = 9116832762375132102LL;
-    empty_codes_[index(::baduk::Point(10, 12))] = 7492320478527471537LL;
-    empty_codes_[index(::baduk::Point(10, 13))] = 1661308910656975327LL;
-    empty_codes_[index(::baduk::Point(10, 14))] = 7058164250618640918LL;
-    empty_codes_[index(::baduk::Point(10, 15))] = 1547169229226361366LL;
-    empty_codes_[index(::baduk::Point(10, 16))] = 7821171514706321879LL;
-    empty_codes_[index(::baduk::Point(10, 17))] = 142278496284590088LL;
-    empty_codes_[index(::baduk::Point(10, 18))] = 923336321816770896LL;
-    empty_codes_[index(::baduk::Point(10, 19))] = 1220488552346588776LL;
-    empty_codes_[index(::baduk::Point(10, 20))] = 8608245865025150524LL;
-    empty_codes_[index(::baduk::Point(10, 21))] = 306560339465409741LL;
-    empty_codes_[index(::baduk::Point(10, 22))] = 529019249341934844LL;
-    empty_codes_[index(::baduk::Point(10, 23))] = 3619934868810027744LL;
-    empty_codes_[index(::baduk::Point(10, 24))] = 4697571785659529444LL;
-    empty_codes_[index(::baduk::Point(11, 0))] = 1329502672191635985LL;
-    empty_codes_[index(::baduk::Point(11, 1))] = 4948935980733019941LL;
-    empty_codes_[index(::baduk::Point(11, 2))] = 3311096287205292369LL;
-    empty_codes_[index(::baduk::Point(11, 3))] = 456655480645951990LL;
-    empty_codes_[index(::baduk::Point(11, 4))] = 7870359293703687257LL;
-    empty_codes_[index(::baduk::Point(11, 5))] = 1787133139589769363LL;
-    empty_codes_[index(::baduk::Point(11, 6))] = 1181478239014628512LL;
-    empty_codes_[index(::baduk::Point(11, 7))] = 2549687242600189407LL;
-    empty_codes_[index(::baduk::Point(11, 8))] = 2088276264342246563LL;
-    empty_codes_[index(::baduk::Point(11, 9))] = 4217370833123625922LL;
-    empty_codes_[index(::baduk::Point(11, 10))] = 2633272992037044076LL;
-    empty_codes_[index(::baduk::Point(11, 11))] = 2595666125244578051LL;
-    empty_codes_[index(::baduk::Point(11, 12))] = 2741939538983254581LL;
-    empty_codes_[index(::baduk::Point(11, 13))] = 3489080775592904121LL;
-    empty_codes_[index(::baduk::Point(11, 14))] = 4192981682801701901LL;
-    empty_codes_[index(::baduk::Point(11, 15))] = 8673990414423533840LL;
-    empty_codes_[index(::baduk::Point(11, 16))] = 1258198541123834386LL;
-    empty_codes_[index(::baduk::Point(11, 17))] = 449364372411323234LL;
-    empty_codes_[index(::baduk::Point(11, 18))] = 7194918088434662369LL;
-    empty_codes_[index(::baduk::Point(11, 19))] = 5262037095041700858LL;
-    empty_codes_[index(::baduk::Point(11, 20))] = 1345175726098534809LL;
-    empty_codes_[index(::baduk::Point(11, 21))] = 4243723861469621035LL;
-    empty_codes_[index(::baduk::Point(11, 22))] = 950032477345309115LL;
-    empty_codes_[index(::baduk::Point(11, 23))] = 7928815727262428336LL;
-    empty_codes_[index(::baduk::Point(11, 24))] = 8287827291790563170LL;
-    empty_codes_[index(::baduk::Point(12, 0))] = 940039385106446709LL;
-    empty_codes_[index(::baduk::Point(12, 1))] = 5130508519535829389LL;
-    empty_codes_[index(::baduk::Point(12, 2))] = 1973443815725001169LL;
-    empty_codes_[index(::baduk::Point(12, 3))] = 7407640221094851713LL;
-    empty_codes_[index(::baduk::Point(12, 4))] = 3195875211877425399LL;
-    empty_codes_[index(::baduk::Point(12, 5))] = 160794314203416909LL;
-    empty_codes_[index(::baduk::Point(12, 6))] = 3084434037040760132LL;
-    empty_codes_[index(::baduk::Point(12, 7))] = 1657213943400087798LL;
-    empty_codes_[index(::baduk::Point(12, 8))] = 3561399280178249677LL;
-    empty_codes_[index(::baduk::Point(12, 9))] = 3429585930370947513LL;
-    empty_codes_[index(::baduk::Point(12, 10))] = 5959312455709469455LL;
-    empty_codes_[index(::baduk::Point(12, 11))] = 2348688216946873578LL;
-    empty_codes_[index(::baduk::Point(12, 12))] = 4895564168840127501LL;
-    empty_codes_[index(::baduk::Point(12, 13))] = 5545913937415231832LL;
-    empty_codes_[index(::baduk::Point(12, 14))] = 3200664365033775158LL;
-    empty_codes_[index(::baduk::Point(12, 15))] = 5096099226476325649LL;
-    empty_codes_[index(::baduk::Point(12, 16))] = 416573620395640141LL;
-    empty_codes_[index(::baduk::Point(12, 17))] = 5652437246386797611LL;
-    empty_codes_[index(::baduk::Point(12, 18))] = 7423629217027636560LL;
-    empty_codes_[index(::baduk::Point(12, 19))] = 3200848219401263761LL;
-    empty_codes_[index(::baduk::Point(12, 20))] = 699552832678605926LL;
-    empty_codes_[index(::baduk::Point(12, 21))] = 3116756379140773988LL;
-    empty_codes_[index(::baduk::Point(12, 22))] = 8059450100834532993LL;
-    empty_codes_[index(::baduk::Point(12, 23))] = 7464073277091139060LL;
-    empty_codes_[index(::baduk::Point(12, 24))] = 7745961628562105422LL;
-    empty_codes_[index(::baduk::Point(13, 0))] = 6281549449403579849LL;
-    empty_codes_[index(::baduk::Point(13, 1))] = 4184506759654242040LL;
-    empty_codes_[index(::baduk::Point(13, 2))] = 5158399697327474371LL;
-    empty_codes_[index(::baduk::Point(13, 3))] = 6764758167961003937LL;
-    empty_codes_[index(::baduk::Point(13, 4))] = 6608756468796408314LL;
-    empty_codes_[index(::baduk::Point(13, 5))] = 7363243374438200158LL;
-    empty_codes_[index(::baduk::Point(13, 6))] = 3615915249446815171LL;
-    empty_codes_[index(::baduk::Point(13, 7))] = 755749583674737664LL;
-    empty_codes_[index(::baduk::Point(13, 8))] = 8463575288748810004LL;
-    empty_codes_[index(::baduk::Point(13, 9))] = 7774131328108774732LL;
-    empty_codes_[index(::baduk::Point(13, 10))] = 2102647625196767285LL;
-    empty_codes_[index(::baduk::Point(13, 11))] = 422844107191538700LL;
-    empty_codes_[index(::baduk::Point(13, 12))] = 8325586243902467805LL;
-    empty_codes_[index(::baduk::Point(13, 13))] = 3212910845149975534LL;
-    empty_codes_[index(::baduk::Point(13, 14))] = 3091346437632854938LL;
-    empty_codes_[index(::baduk::Point(13, 15))] = 2253767898992269895LL;
-    empty_codes_[index(::baduk::Point(13, 16))] = 4981445689717394155LL;
-    empty_codes_[index(::baduk::Point(13, 17))] = 6787072992619769517LL;
-    empty_codes_[index(::baduk::Point(13, 18))] = 5075590907601221196LL;
-    empty_codes_[index(::baduk::Point(13, 19))] = 1749616408436009800LL;
-    empty_codes_[index(::baduk::Point(13, 20))] = 6142279569544876826LL;
-    empty_codes_[index(::baduk::Point(13, 21))] = 4557083828433600141LL;
-    empty_codes_[index(::baduk::Point(13, 22))] = 8282974493593332972LL;
-    empty_codes_[index(::baduk::Point(13, 23))] = 123515464319531272LL;
-    empty_codes_[index(::baduk::Point(13, 24))] = 9171118649953986682LL;
-    empty_codes_[index(::baduk::Point(14, 0))] = 4268374946946334778LL;
-    empty_codes_[index(::baduk::Point(14, 1))] = 6891487541197719710LL;
-    empty_codes_[index(::baduk::Point(14, 2))] = 2796400180575463789LL;
-    empty_codes_[index(::baduk::Point(14, 3))] = 5589765429127876610LL;
-    empty_codes_[index(::baduk::Point(14, 4))] = 1745994481773691783LL;
-    empty_codes_[index(::baduk::Point(14, 5))] = 872763135275459439LL;
-    empty_codes_[index(::baduk::Point(14, 6))] = 9137410966365577469LL;
-    empty_codes_[index(::baduk::Point(14, 7))] = 6287483311934668543LL;
-    empty_codes_[index(::baduk::Point(14, 8))] = 5499668318158279059LL;
-    empty_codes_[index(::baduk::Point(14, 9))] = 3489968035721999917LL;
-    empty_codes_[index(::baduk::Point(14, 10))] = 6181708653147822803LL;
-    empty_codes_[index(::baduk::Point(14, 11))] = 1705711983252688142LL;
-    empty_codes_[index(::baduk::Point(14, 12))] = 5156619803651748801LL;
-    empty_codes_[index(::baduk::Point(14, 13))] = 6818579955544945561LL;
-    empty_codes_[index(::baduk::Point(14, 14))] = 1964812093999843391LL;
-    empty_codes_[index(::baduk::Point(14, 15))] = 2991090900291884500LL;
-    empty_codes_[index(::baduk::Point(14, 16))] = 1937565383711101282LL;
-    empty_codes_[index(::baduk::Point(14, 17))] = 8424553877600253104LL;
-    empty_codes_[index(::baduk::Point(14, 18))] = 8732270361056947485LL;
-    empty_codes_[index(::baduk::Point(14, 19))] = 3882009273258795478LL;
-    empty_codes_[index(::baduk::Point(14, 20))] = 4279021394406328794LL;
-    empty_codes_[index(::baduk::Point(14, 21))] = 2486661134726709379LL;
-    empty_codes_[index(::baduk::Point(14, 22))] = 49095881260195715LL;
-    empty_codes_[index(::baduk::Point(14, 23))] = 5642431590197308102LL;
-    empty_codes_[index(::baduk::Point(14, 24))] = 4165961597648575748LL;
-    empty_codes_[index(::baduk::Point(15, 0))] = 1832434842911471413LL;
-    empty_codes_[index(::baduk::Point(15, 1))] = 7742563809787888381LL;
-    empty_codes_[index(::baduk::Point(15, 2))] = 6781787671332435267LL;
-    empty_codes_[index(::baduk::Point(15, 3))] = 1639513826628757721LL;
-    empty_codes_[index(::baduk::Point(15, 4))] = 4202809285522355163LL;
-    empty_codes_[index(::baduk::Point(15, 5))] = 1182410417433174328LL;
-    empty_codes_[index(::baduk::Point(15, 6))] = 9078530937414685871LL;
-    empty_codes_[index(::baduk::Point(15, 7))] = 4657235268685110374LL;
-    empty_codes_[index(::baduk::Point(15, 8))] = 8830737637093833291LL;
-    empty_codes_[index(::baduk::Point(15, 9))] = 1831521463084156254LL;
-    empty_codes_[index(::baduk::Point(15, 10))] = 7922348809249296205LL;
-    empty_codes_[index(::baduk::Point(15, 11))] = 6059525093715646794LL;
-    empty_codes_[index(::baduk::Point(15, 12))] = 6002771636505378958LL;
-    empty_codes_[index(::baduk::Point(15, 13))] = 6136492820360703658LL;
-    empty_codes_[index(::baduk::Point(15, 14))] = 3738740370397734859LL;
-    empty_codes_[index(::baduk::Point(15, 15))] = 6223511105254941362LL;
-    empty_codes_[index(::baduk::Point(15, 16))] = 3926167126650977749LL;
-    empty_codes_[index(::baduk::Point(15, 17))] = 638519415348308649LL;
-    empty_codes_[index(::baduk::Point(15, 18))] = 4185404327283123523LL;
-    empty_codes_[index(::baduk::Point(15, 19))] = 4171100118610568154LL;
-    empty_codes_[index(::baduk::Point(15, 20))] = 8779092529906226322LL;
-    empty_codes_[index(::baduk::Point(15, 21))] = 5586466893681572121LL;
-    empty_codes_[index(::baduk::Point(15, 22))] = 8179837709568995613LL;
-    empty_codes_[index(::baduk::Point(15, 23))] = 1161965128787124171LL;
-    empty_codes_[index(::baduk::Point(15, 24))] = 2899069523634352298LL;
-    empty_codes_[index(::baduk::Point(16, 0))] = 9020615903479641323LL;
-    empty_codes_[index(::baduk::Point(16, 1))] = 491698449455540062LL;
-    empty_codes_[index(::baduk::Point(16, 2))] = 3607767193790567041LL;
-    empty_codes_[index(::baduk::Point(16, 3))] = 1382758430562893034LL;
-    empty_codes_[index(::baduk::Point(16, 4))] = 5456569041621404326LL;
-    empty_codes_[index(::baduk::Point(16, 5))] = 190350304691839565LL;
-    empty_codes_[index(::baduk::Point(16, 6))] = 1779415230898672724LL;
-    empty_codes_[index(::baduk::Point(16, 7))] = 5797208900401760370LL;
-    empty_codes_[index(::baduk::Point(16, 8))] = 4272012469886309349LL;
-    empty_codes_[index(::baduk::Point(16, 9))] = 6166882071747900038LL;
-    empty_codes_[index(::baduk::Point(16, 10))] = 312287533030514020LL;
-    empty_codes_[index(::baduk::Point(16, 11))] = 1034080010699041793LL;
-    empty_codes_[index(::baduk::Point(16, 12))] = 9183115804175144245LL;
-    empty_codes_[index(::baduk::Point(16, 13))] = 9190156569192506099LL;
-    empty_codes_[index(::baduk::Point(16, 14))] = 1041715561203574886LL;
-    empty_codes_[index(::baduk::Point(16, 15))] = 9132569549989471726LL;
-    empty_codes_[index(::baduk::Point(16, 16))] = 2918029061695030459LL;
-    empty_codes_[index(::baduk::Point(16, 17))] = 818844806403096033LL;
-    empty_codes_[index(::baduk::Point(16, 18))] = 4025179879539481686LL;
-    empty_codes_[index(::baduk::Point(16, 19))] = 4881766429694326LL;
-    empty_codes_[index(::baduk::Point(16, 20))] = 3026963213298017127LL;
-    empty_codes_[index(::baduk::Point(16, 21))] = 8602860356656211829LL;
-    empty_codes_[index(::baduk::Point(16, 22))] = 1906296391528476922LL;
-    empty_codes_[index(::baduk::Point(16, 23))] = 6464914894265974393LL;
-    empty_codes_[index(::baduk::Point(16, 24))] = 6021827216847042047LL;
-    empty_codes_[index(::baduk::Point(17, 0))] = 4783409368148107582LL;
-    empty_codes_[index(::baduk::Point(17, 1))] = 3232535339117095793LL;
-    empty_codes_[index(::baduk::Point(17, 2))] = 3222816267280396652LL;
-    empty_codes_[index(::baduk::Point(17, 3))] = 8433095299775993872LL;
-    empty_codes_[index(::baduk::Point(17, 4))] = 6945853289446406681LL;
-    empty_codes_[index(::baduk::Point(17, 5))] = 91389359835530211LL;
-    empty_codes_[index(::baduk::Point(17, 6))] = 6336686934965691751LL;
-    empty_codes_[index(::baduk::Point(17, 7))] = 5165853663422641628LL;
-    empty_codes_[index(::baduk::Point(17, 8))] = 5195360834017707904LL;
-    empty_codes_[index(::baduk::Point(17, 9))] = 9154875760054075797LL;
-    empty_codes_[index(::baduk::Point(17, 10))] = 3451921177498193734LL;
-    empty_codes_[index(::baduk::Point(17, 11))] = 300373781836547551LL;
-    empty_codes_[index(::baduk::Point(17, 12))] = 3758068572801190085LL;
-    empty_codes_[index(::baduk::Point(17, 13))] = 8288292326121689675LL;
-    empty_codes_[index(::baduk::Point(17, 14))] = 2392477352309437314LL;
-    empty_codes_[index(::baduk::Point(17, 15))] = 5247705949360922719LL;
-    empty_codes_[index(::baduk::Point(17, 16))] = 4974192508482586513LL;
-    empty_codes_[index(::baduk::Point(17, 17))] = 7716397554945687614LL;
-    empty_codes_[index(::baduk::Point(17, 18))] = 4725729684865320018LL;
-    empty_codes_[index(::baduk::Point(17, 19))] = 4895289142877719224LL;
-    empty_codes_[index(::baduk::Point(17, 20))] = 1020172432345783947LL;
-    empty_codes_[index(::baduk::Point(17, 21))] = 2652292091980610054LL;
-    empty_codes_[index(::baduk::Point(17, 22))] = 48946436502263083LL;
-    empty_codes_[index(::baduk::Point(17, 23))] = 798067591251291514LL;
-    empty_codes_[index(::baduk::Point(17, 24))] = 6155372586816722493LL;
-    empty_codes_[index(::baduk::Point(18, 0))] = 219823297667130725LL;
-    empty_codes_[index(::baduk::Point(18, 1))] = 3542302124215730415LL;
-    empty_codes_[index(::baduk::Point(18, 2))] = 4877063358773760535LL;
-    empty_codes_[index(::baduk::Point(18, 3))] = 6645866486144117685LL;
-    empty_codes_[index(::baduk::Point(18, 4))] = 2925365251200466646LL;
-    empty_codes_[index(::baduk::Point(18, 5))] = 5789659275005821862LL;
-    empty_codes_[index(::baduk::Point(18, 6))] = 8580459147527716396LL;
-    empty_codes_[index(::baduk::Point(18, 7))] = 8275355217817362275LL;
-    empty_codes_[index(::baduk::Point(18, 8))] = 4222259663162258625LL;
-    empty_codes_[index(::baduk::Point(18, 9))] = 2810053244784075565LL;
-    empty_codes_[index(::baduk::Point(18, 10))] = 145840289828795320LL;
-    empty_codes_[index(::baduk::Point(18, 11))] = 4525131347740625484LL;
-    empty_codes_[index(::baduk::Point(18, 12))] = 5242501251433661576LL;
-    empty_codes_[index(::baduk::Point(18, 13))] = 5974874130136536057LL;
-    empty_codes_[index(::baduk::Point(18, 14))] = 3426601891584199814LL;
-    empty_codes_[index(::baduk::Point(18, 15))] = 3465349057181778364LL;
-    empty_codes_[index(::baduk::Point(18, 16))] = 5106701938983371382LL;
-    empty_codes_[index(::baduk::Point(18, 17))] = 3653952820656055385LL;
-    empty_codes_[index(::baduk::Point(18, 18))] = 6933567308678567023LL;
-    empty_codes_[index(::baduk::Point(18, 19))] = 5185408538940659026LL;
-    empty_codes_[index(::baduk::Point(18, 20))] = 6157347320042088161LL;
-    empty_codes_[index(::baduk::Point(18, 21))] = 786244207799556251LL;
-    empty_codes_[index(::baduk::Point(18, 22))] = 2176207309664103123LL;
-    empty_codes_[index(::baduk::Point(18, 23))] = 8908908967916018577LL;
-    empty_codes_[index(::baduk::Point(18, 24))] = 7575571848312458413LL;
-    empty_codes_[index(::baduk::Point(19, 0))] = 7613553675248494359LL;
-    empty_codes_[index(::baduk::Point(19, 1))] = 7557827786775030214LL;
-    empty_codes_[index(::baduk::Point(19, 2))] = 1466937341689440520LL;
-    empty_codes_[index(::baduk::Point(19, 3))] = 6746597262294964049LL;
-    empty_codes_[index(::baduk::Point(19, 4))] = 3590455593575873993LL;
-    empty_codes_[index(::baduk::Point(19, 5))] = 8490134117195578244LL;
-    empty_codes_[index(::baduk::Point(19, 6))] = 2669203671387961283LL;
-    empty_codes_[index(::baduk::Point(19, 7))] = 7404445801019516444LL;
-    empty_codes_[index(::baduk::Point(19, 8))] = 2668926330596706534LL;
-    empty_codes_[index(::baduk::Point(19, 9))] = 4597508238348284091LL;
-    empty_codes_[index(::baduk::Point(19, 10))] = 6717091091679914338LL;
-    empty_codes_[index(::baduk::Point(19, 11))] = 8002876052756061083LL;
-    empty_codes_[index(::baduk::Point(19, 12))] = 8018641589765355975LL;
-    empty_codes_[index(::baduk::Point(19, 13))] = 2663716998370108204LL;
-    empty_codes_[index(::baduk::Point(19, 14))] = 4199784141695142452LL;
-    empty_codes_[index(::baduk::Point(19, 15))] = 3359075229663231037LL;
-    empty_codes_[index(::baduk::Point(19, 16))] = 6388824404365231604LL;
-    empty_codes_[index(::baduk::Point(19, 17))] = 1523347589944520002LL;
-    empty_codes_[index(::baduk::Point(19, 18))] = 832730959929930551LL;
-    empty_codes_[index(::baduk::Point(19, 19))] = 8599679930043706126LL;
-    empty_codes_[index(::baduk::Point(19, 20))] = 3792572570793711889LL;
-    empty_codes_[index(::baduk::Point(19, 21))] = 4192582566641793234LL;
-    empty_codes_[index(::baduk::Point(19, 22))] = 5165951573682947888LL;
-    empty_codes_[index(::baduk::Point(19, 23))] = 2242062296523290388LL;
-    empty_codes_[index(::baduk::Point(19, 24))] = 7030674746501093393LL;
-    empty_codes_[index(::baduk::Point(20, 0))] = 1525104995207027250LL;
-    empty_codes_[index(::baduk::Point(20, 1))] = 325838682380903664LL;
-    empty_codes_[index(::baduk::Point(20, 2))] = 8945428988212600528LL;
-    empty_codes_[index(::baduk::Point(20, 3))] = 8677597938007937404LL;
-    empty_codes_[index(::baduk::Point(20, 4))] = 626117657714963189LL;
-    empty_codes_[index(::baduk::Point(20, 5))] = 948555693388267389LL;
-    empty_codes_[index(::baduk::Point(20, 6))] = 2917994475196491353LL;
-    empty_codes_[index(::baduk::Point(20, 7))] = 441744683636051563LL;
-    empty_codes_[index(::baduk::Point(20, 8))] = 5888445153184083693LL;
-    empty_codes_[index(::baduk::Point(20, 9))] = 5587109843507956545LL;
-    empty_codes_[index(::baduk::Point(20, 10))] = 3785283403605306590LL;
-    empty_codes_[index(::baduk::Point(20, 11))] = 6939987865968188887LL;
-    empty_codes_[index(::baduk::Point(20, 12))] = 6213515148586603960LL;
-    empty_codes_[index(::baduk::Point(20, 13))] = 3860444003718476687LL;
-    empty_codes_[index(::baduk::Point(20, 14))] = 2301200831864644456LL;
-    empty_codes_[index(::baduk::Point(20, 15))] = 1904982346658927415LL;
-    empty_codes_[index(::baduk::Point(20, 16))] = 5149999376451367754LL;
-    empty_codes_[index(::baduk::Point(20, 17))] = 3854314733638052083LL;
-    empty_codes_[index(::baduk::Point(20, 18))] = 7351933428215798280LL;
-    empty_codes_[index(::baduk::Point(20, 19))] = 8121923611539809229LL;
-    empty_codes_[index(::baduk::Point(20, 20))] = 1443695272979300858LL;
-    empty_codes_[index(::baduk::Point(20, 21))] = 2391852334455250637LL;
-    empty_codes_[index(::baduk::Point(20, 22))] = 5972146085467155061LL;
-    empty_codes_[index(::baduk::Point(20, 23))] = 6105583601223820371LL;
-    empty_codes_[index(::baduk::Point(20, 24))] = 2758839174164934727LL;
-    empty_codes_[index(::baduk::Point(21, 0))] = 7308185674249170694LL;
-    empty_codes_[index(::baduk::Point(21, 1))] = 5243292561809912155LL;
-    empty_codes_[index(::baduk::Point(21, 2))] = 4661136862023996862LL;
-    empty_codes_[index(::baduk::Point(21, 3))] = 7301011434175267885LL;
-    empty_codes_[index(::baduk::Point(21, 4))] = 4774160095893585116LL;
-    empty_codes_[index(::baduk::Point(21, 5))] = 216399473105901814LL;
-    empty_codes_[index(::baduk::Point(21, 6))] = 7176280332521508281LL;
-    empty_codes_[index(::baduk::Point(21, 7))] = 2111364710369456766LL;
-    empty_codes_[index(::baduk::Point(21, 8))] = 4532838753708432857LL;
-    empty_codes_[index(::baduk::Point(21, 9))] = 5382764376937814747LL;
-    empty_codes_[index(::baduk::Point(21, 10))] = 7448976828665001426LL;
-    empty_codes_[index(::baduk::Point(21, 11))] = 8957474234624030166LL;
-    empty_codes_[index(::baduk::Point(21, 12))] = 8725669274822556233LL;
-    empty_codes_[index(::baduk::Point(21, 13))] = 2252988953711080255LL;
-    empty_codes_[index(::baduk::Point(21, 14))] = 257257475790882614LL;
-    empty_codes_[index(::baduk::Point(21, 15))] = 7916369257833135665LL;
-    empty_codes_[index(::baduk::Point(21, 16))] = 5400031169461667081LL;
-    empty_codes_[index(::baduk::Point(21, 17))] = 2580273410654919401LL;
-    empty_codes_[index(::baduk::Point(21, 18))] = 4269373960281687308LL;
-    empty_codes_[index(::baduk::Point(21, 19))] = 7675066155650394776LL;
-    empty_codes_[index(::baduk::Point(21, 20))] = 8677154312602820611LL;
-    empty_codes_[index(::baduk::Point(21, 21))] = 69203698187959061LL;
-    empty_codes_[index(::baduk::Point(21, 22))] = 1915636181675625888LL;
-    empty_codes_[index(::baduk::Point(21, 23))] = 2745539295278547940LL;
-    empty_codes_[index(::baduk::Point(21, 24))] = 7948876731365364643LL;
-    empty_codes_[index(::baduk::Point(22, 0))] = 7579153580676257564LL;
-    empty_codes_[index(::baduk::Point(22, 1))] = 5772774467616920656LL;
-    empty_codes_[index(::baduk::Point(22, 2))] = 1052377374431732053LL;
-    empty_codes_[index(::baduk::Point(22, 3))] = 8933519215721299408LL;
-    empty_codes_[index(::baduk::Point(22, 4))] = 5422429554912853834LL;
-    empty_codes_[index(::baduk::Point(22, 5))] = 6418733137418935181LL;
-    empty_codes_[index(::baduk::Point(22, 6))] = 1437101864551963546LL;
-    empty_codes_[index(::baduk::Point(22, 7))] = 5680508661325771566LL;
-    empty_codes_[index(::baduk::Point(22, 8))] = 8627545841421650317LL;
-    empty_codes_[index(::baduk::Point(22, 9))] = 9132618314235310288LL;
-    empty_codes_[index(::baduk::Point(22, 10))] = 3458045971226122132LL;
-    empty_codes_[index(::baduk::Point(22, 11))] = 1917015523164358635LL;
-    empty_codes_[index(::baduk::Point(22, 12))] = 5328666491479361847LL;
-    empty_codes_[index(::baduk::Point(22, 13))] = 820647757658390076LL;
-    empty_codes_[index(::baduk::Point(22, 14))] = 4985168184111831723LL;
-    empty_codes_[index(::baduk::Point(22, 15))] = 6825036314194373956LL;
-    empty_codes_[index(::baduk::Point(22, 16))] = 6235597057649968455LL;
-    empty_codes_[index(::baduk::Point(22, 17))] = 2325367872975255208LL;
-    empty_codes_[index(::baduk::Point(22, 18))] = 8866280670394264244LL;
-    empty_codes_[index(::baduk::Point(22, 19))] = 8631342063649226815LL;
-    empty_codes_[index(::baduk::Point(22, 20))] = 8457770872526457604LL;
-    empty_codes_[index(::baduk::Point(22, 21))] = 1174886069936041221LL;
-    empty_codes_[index(::baduk::Point(22, 22))] = 6640581678080926652LL;
-    empty_codes_[index(::baduk::Point(22, 23))] = 6223318430913820208LL;
-    empty_codes_[index(::baduk::Point(22, 24))] = 965710861441010219LL;
-    empty_codes_[index(::baduk::Point(23, 0))] = 860314007437903251LL;
-    empty_codes_[index(::baduk::Point(23, 1))] = 5260035428028332193LL;
-    empty_codes_[index(::baduk::Point(23, 2))] = 1612454609944562634LL;
-    empty_codes_[index(::baduk::Point(23, 3))] = 2091911221173541917LL;
-    empty_codes_[index(::baduk::Point(23, 4))] = 7595056861765375087LL;
-    empty_codes_[index(::baduk::Point(23, 5))] = 2888057843729278722LL;
-    empty_codes_[index(::baduk::Point(23, 6))] = 2750083324960419061LL;
-    empty_codes_[index(::baduk::Point(23, 7))] = 3353711429520973338LL;
-    empty_codes_[index(::baduk::Point(23, 8))] = 3602580409077788645LL;
-    empty_codes_[index(::baduk::Point(23, 9))] = 1643844490742724694LL;
-    empty_codes_[index(::baduk::Point(23, 10))] = 5676326827051250644LL;
-    empty_codes_[index(::baduk::Point(23, 11))] = 3261785330332577073LL;
-    empty_codes_[index(::baduk::Point(23, 12))] = 8844053425302074383LL;
-    empty_codes_[index(::baduk::Point(23, 13))] = 3100021095107296727LL;
-    empty_codes_[index(::baduk::Point(23, 14))] = 4923434790083277743LL;
-    empty_codes_[index(::baduk::Point(23, 15))] = 2906051527601670214LL;
-    empty_codes_[index(::baduk::Point(23, 16))] = 6529569055027863396LL;
-    empty_codes_[index(::baduk::Point(23, 17))] = 4781458711505685314LL;
-    empty_codes_[index(::baduk::Point(23, 18))] = 9105842818787165297LL;
-    empty_codes_[index(::baduk::Point(23, 19))] = 5428483597992588250LL;
-    empty_codes_[index(::baduk::Point(23, 20))] = 3791085680357915427LL;
-    empty_codes_[index(::baduk::Point(23, 21))] = 1401482117866453591LL;
-    empty_codes_[index(::baduk::Point(23, 22))] = 411502057466180921LL;
-    empty_codes_[index(::baduk::Point(23, 23))] = 4347674662094512896LL;
-    empty_codes_[index(::baduk::Point(23, 24))] = 8842746693188885693LL;
-    empty_codes_[index(::baduk::Point(24, 0))] = 7205090207275689995LL;
-    empty_codes_[index(::baduk::Point(24, 1))] = 7382188840069040668LL;
-    empty_codes_[index(::baduk::Point(24, 2))] = 3945328090323460861LL;
-    empty_codes_[index(::baduk::Point(24, 3))] = 2310157113919139639LL;
-    empty_codes_[index(::baduk::Point(24, 4))] = 4993202646618520737LL;
-    empty_codes_[index(::baduk::Point(24, 5))] = 4693521968178086414LL;
-    empty_codes_[index(::baduk::Point(24, 6))] = 8661447672948497547LL;
-    empty_codes_[index(::baduk::Point(24, 7))] = 8010957973010249205LL;
-    empty_codes_[index(::baduk::Point(24, 8))] = 2186921897840243437LL;
-    empty_codes_[index(::baduk::Point(24, 9))] = 950748374602491836LL;
-    empty_codes_[index(::baduk::Point(24, 10))] = 8536655108575031359LL;
-    empty_codes_[index(::baduk::Point(24, 11))] = 936280453323835952LL;
-    empty_codes_[index(::baduk::Point(24, 12))] = 3715323924969913298LL;
-    empty_codes_[index(::baduk::Point(24, 13))] = 8923183547076473152LL;
-    empty_codes_[index(::baduk::Point(24, 14))] = 8205096655358469692LL;
-    empty_codes_[index(::baduk::Point(24, 15))] = 840277538782002916LL;
-    empty_codes_[index(::baduk::Point(24, 16))] = 6932946719401193912LL;
-    empty_codes_[index(::baduk::Point(24, 17))] = 4238877321334888894LL;
-    empty_codes_[index(::baduk::Point(24, 18))] = 7038729941009808887LL;
-    empty_codes_[index(::baduk::Point(24, 19))] = 5083214860760669647LL;
-    empty_codes_[index(::baduk::Point(24, 20))] = 1881397881922579657LL;
-    empty_codes_[index(::baduk::Point(24, 21))] = 7589642173187634149LL;
-    empty_codes_[index(::baduk::Point(24, 22))] = 3249742513316607708LL;
-    empty_codes_[index(::baduk::Point(24, 23))] = 8557627684381475600LL;
-    empty_codes_[index(::baduk::Point(24, 24))] = 5917111332883744484LL;
-    black_codes_.resize(25 * 25);
-    black_codes_[index(::baduk::Point(0, 0))] = 4801006839845007102LL;
-    black_codes_[index(::baduk::Point(0, 1))] = 8729333300053970668LL;
-    black_codes_[index(::baduk::Point(0, 2))] = 7291446025369429485LL;
-    black_codes_[index(::baduk::Point(0, 3))] = 2064159871141917690LL;
-    black_codes_[index(::baduk::Point(0, 4))] = 4815314694197402709LL;
-    black_codes_[index(::baduk::Point(0, 5))] = 368288133150249442LL;
-    black_codes_[index(::baduk::Point(0, 6))] = 6450858749229900473LL;
-    black_codes_[index(::baduk::Point(0, 7))] = 9166279396475002614LL;
-    black_codes_[index(::baduk::Point(0, 8))] = 3486773895677199154LL;
-    black_codes_[index(::baduk::Point(0, 9))] = 4991634597603546469LL;
-    black_codes_[index(::baduk::Point(0, 10))] = 8513485244075931413LL;
-    black_codes_[index(::baduk::Point(0, 11))] = 6261708319162450992LL;
-    black_codes_[index(::baduk::Point(0, 12))] = 7871879667692656592LL;
-    black_codes_[index(::baduk::Point(0, 13))] = 7253378017523154011LL;
-    black_codes_[index(::baduk::Point(0, 14))] = 8317453906480284647LL;
-    black_codes_[index(::baduk::Point(0, 15))] = 657141029303911258LL;
-    black_codes_[index(::baduk::Point(0, 16))] = 5258506664693386712LL;
-    black_codes_[index(::baduk::Point(0, 17))] = 2129567688385901408LL;
-    black_codes_[index(::baduk::Point(0, 18))] = 3807345982298434593LL;
-    black_codes_[index(::baduk::Point(0, 19))] = 1157481502684108550LL;
-    black_codes_[index(::baduk::Point(0, 20))] = 4439104979861914134LL;
-    black_codes_[index(::baduk::Point(0, 21))] = 6890533118118296489LL;
-    black_codes_[index(::baduk::Point(0, 22))] = 1132913825948109121LL;
-    black_codes_[index(::baduk::Point(0, 23))] = 8339636894986536111LL;
-    black_codes_[index(::baduk::Point(0, 24))] = 5053616333110678800LL;
-    black_codes_[index(::baduk::Point(1, 0))] = 6049327618754585925LL;
-    black_codes_[index(::baduk::Point(1, 1))] = 1582898811434812687LL;
-    black_codes_[index(::baduk::Point(1, 2))] = 4547756197799141486LL;
-    black_codes_[index(::baduk::Point(1, 3))] = 351577665643402522LL;
-    black_codes_[index(::baduk::Point(1, 4))] = 4691495827820483378LL;
-    black_codes_[index(::baduk::Point(1, 5))] = 7603617927332601652LL;
-    black_codes_[index(::baduk::Point(1, 6))] = 6510908438089344617LL;
-    black_codes_[index(::baduk::Point(1, 7))] = 6603736219691119161LL;
-    black_codes_[index(::baduk::Point(1, 8))] = 9014380994531522460LL;
-    black_codes_[index(::baduk::Point(1, 9))] = 8989744329833919323LL;
-    black_codes_[index(::baduk::Point(1, 10))] = 3562646889652594913LL;
-    black_codes_[index(::baduk::Point(1, 11))] = 142525165614994060LL;
-    black_codes_[index(::baduk::Point(1, 12))] = 2544059874099184342LL;
-    black_codes_[index(::baduk::Point(1, 13))] = 1686034125711312679LL;
-    black_codes_[index(::baduk::Point(1, 14))] = 4278571880584203028LL;
-    black_codes_[index(::baduk::Point(1, 15))] = 4585143090228544450LL;
-    black_codes_[index(::baduk::Point(1, 16))] = 7160466324112611064LL;
-    black_codes_[index(::baduk::Point(1, 17))] = 7197775241243735642LL;
-    black_codes_[index(::baduk::Point(1, 18))] = 3142229449024762262LL;
-    black_codes_[index(::baduk::Point(1, 19))] = 8046370285609011583LL;
-    black_codes_[index(::baduk::Point(1, 20))] = 8283034336791963223LL;
-    black_codes_[index(::baduk::Point(1, 21))] = 6593539476275765435LL;
-    black_codes_[index(::baduk::Point(1, 22))] = 4234415624830341859LL;
-    black_codes_[index(::baduk::Point(1, 23))] = 281624121691332075LL;
-    black_codes_[index(::baduk::Point(1, 24))] = 1393674647031500887LL;
-    black_codes_[index(::baduk::Point(2, 0))] = 904928876511191719LL;
-    black_codes_[index(::baduk::Point(2, 1))] = 1453902140363654836LL;
-    black_codes_[index(::baduk::Point(2, 2))] = 2846217927370861181LL;
-    black_codes_[index(::baduk::Point(2, 3))] = 6771619367031817272LL;
-    black_codes_[index(::baduk::Point(2, 4))] = 4925560335021961787LL;
-    black_codes_[index(::baduk::Point(2, 5))] = 2120802941561138821LL;
-    black_codes_[index(::baduk::Point(2, 6))] = 3626155749846415428LL;
-    black_codes_[index(::baduk::Point(2, 7))] = 5229912467671050686LL;
-    black_codes_[index(::baduk::Point(2, 8))] = 5863073002752511398LL;
-    black_codes_[index(::baduk::Point(2, 9))] = 5628231190687511447LL;
-    black_codes_[index(::baduk::Point(2, 10))] = 5910127654661789808LL;
-    black_codes_[index(::baduk::Point(2, 11))] = 3287481736492250600LL;
-    black_codes_[index(::baduk::Point(2, 12))] = 3449156277025433917LL;
-    black_codes_[index(::baduk::Point(2, 13))] = 4310241861503341884LL;
-    black_codes_[index(::baduk::Point(2, 14))] = 331223527372681487LL;
-    black_codes_[index(::baduk::Point(2, 15))] = 507501796283512434LL;
-    black_codes_[index(::baduk::Point(2, 16))] = 4126746766603787743LL;
-    black_codes_[index(::baduk::Point(2, 17))] = 4388664824128440157LL;
-    black_codes_[index(::baduk::Point(2, 18))] = 4451344372808359419LL;
-    black_codes_[index(::baduk::Point(2, 19))] = 8122101877261638830LL;
-    black_codes_[index(::baduk::Point(2, 20))] = 3991689078855994139LL;
-    black_codes_[index(::baduk::Point(2, 21))] = 1261271447826848278LL;
-    black_codes_[index(::baduk::Point(2, 22))] = 4388476657925624525LL;
-    black_codes_[index(::baduk::Point(2, 23))] = 12842047366742900LL;
-    black_codes_[index(::baduk::Point(2, 24))] = 2186872249034807172LL;
-    black_codes_[index(::baduk::Point(3, 0))] = 6096141353127632LL;
-    black_codes_[index(::baduk::Point(3, 1))] = 5392226940404757338LL;
-    black_codes_[index(::baduk::Point(3, 2))] = 4765794555636302253LL;
-    black_codes_[index(::baduk::Point(3, 3))] = 6152684708417218188LL;
-    black_codes_[index(::baduk::Point(3, 4))] = 1848588290024147261LL;
-    black_codes_[index(::baduk::Point(3, 5))] = 5316604763177985671LL;
-    black_codes_[index(::baduk::Point(3, 6))] = 8548755960539763253LL;
-    black_codes_[index(::baduk::Point(3, 7))] = 3589827809240604066LL;
-    black_codes_[index(::baduk::Point(3, 8))] = 488468001801167057LL;
-    black_codes_[index(::baduk::Point(3, 9))] = 1076733132816502628LL;
-    black_codes_[index(::baduk::Point(3, 10))] = 9030428389877598749LL;
-    black_codes_[index(::baduk::Point(3, 11))] = 6439126968824901161LL;
-    black_codes_[index(::baduk::Point(3, 12))] = 3321207564019468261LL;
-    black_codes_[index(::baduk::Point(3, 13))] = 1610230856486919718LL;
-    black_codes_[index(::baduk::Point(3, 14))] = 1673010555612300474LL;
-    black_codes_[index(::baduk::Point(3, 15))] = 145921119495295025LL;
-    black_codes_[index(::baduk::Point(3, 16))] = 603920886092761868LL;
-    black_codes_[index(::baduk::Point(3, 17))] = 7081167444006893346LL;
-    black_codes_[index(::baduk::Point(3, 18))] = 3050761848312772020LL;
-    black_codes_[index(::baduk::Point(3, 19))] = 4542118678761443854LL;
-    black_codes_[index(::baduk::Point(3, 20))] = 612582372693359236LL;
-    black_codes_[index(::baduk::Point(3, 21))] = 8446089062226007398LL;
-    black_codes_[index(::baduk::Point(3, 22))] = 1998755220700251772LL;
-    black_codes_[index(::baduk::Point(3, 23))] = 3030278058872973683LL;
-    black_codes_[index(::baduk::Point(3, 24))] = 8650488039617839093LL;
-    black_codes_[index(::baduk::Point(4, 0))] = 8850483036900319567LL;
-    black_codes_[index(::baduk::Point(4, 1))] = 811712884879947401LL;
-    black_codes_[index(::baduk::Point(4, 2))] = 2306048045846231170LL;
-    black_codes_[index(::baduk::Point(4, 3))] = 411952219051262610LL;
-    black_codes_[index(::baduk::Point(4, 4))] = 2410286211423845320LL;
-    black_codes_[index(::baduk::Point(4, 5))] = 8867844445550164118LL;
-    black_codes_[index(::baduk::Point(4, 6))] = 8092535821596640837LL;
-    black_codes_[index(::baduk::Point(4, 7))] = 5368065757427387498LL;
-    black_codes_[index(::baduk::Point(4, 8))] = 211821917146082185LL;
-    black_codes_[index(::baduk::Point(4, 9))] = 1517979601622473374LL;
-    black_codes_[index(::baduk::Point(4, 10))] = 7696506068507069506LL;
-    black_codes_[index(::baduk::Point(4, 11))] = 3634420930834620215LL;
-    black_codes_[index(::baduk::Point(4, 12))] = 604461375435895862LL;
-    black_codes_[index(::baduk::Point(4, 13))] = 1695848575327542425LL;
-    black_codes_[index(::baduk::Point(4, 14))] = 7524046766992390252LL;
-    black_codes_[index(::baduk::Point(4, 15))] = 6860076596836793301LL;
-    black_codes_[index(::baduk::Point(4, 16))] = 2161613270306742867LL;
-    black_codes_[index(::baduk::Point(4, 17))] = 931458720101386415LL;
-    black_codes_[index(::baduk::Point(4, 18))] = 7241708170301431734LL;
-    black_codes_[index(::baduk::Point(4, 19))] = 1977477333773701976LL;
-    black_codes_[index(::baduk::Point(4, 20))] = 5086437914542673213LL;
-    black_codes_[index(::baduk::Point(4, 21))] = 2112092186290038414LL;
-    black_codes_[index(::baduk::Point(4, 22))] = 900262557809501765LL;
-    black_codes_[index(::baduk::Point(4, 23))] = 3899902354550320155LL;
-    black_codes_[index(::baduk::Point(4, 24))] = 1968669734883120739LL;
-    black_codes_[index(::baduk::Point(5, 0))] = 4022382474586296809LL;
-    black_codes_[index(::baduk::Point(5, 1))] = 7026516191735313162LL;
-    black_codes_[index(::baduk::Point(5, 2))] = 5228644826725033278LL;
-    black_codes_[index(::baduk::Point(5, 3))] = 4368359636113726277LL;
-    black_codes_[index(::baduk::Point(5, 4))] = 6677638257627496115LL;
-    black_codes_[index(::baduk::Point(5, 5))] = 1720337200229175466LL;
-    black_codes_[index(::baduk::Point(5, 6))] = 3714736207016838732LL;
-    black_codes_[index(::baduk::Point(5, 7))] = 1934081818737377276LL;
-    black_codes_[index(::baduk::Point(5, 8))] = 7663304303539432118LL;
-    black_codes_[index(::baduk::Point(5, 9))] = 7121051425642973725LL;
-    black_codes_[index(::baduk::Point(5, 10))] = 1959909415337076394LL;
-    black_codes_[index(::baduk::Point(5, 11))] = 6378212927062911780LL;
-    black_codes_[index(::baduk::Point(5, 12))] = 4334144775199875394LL;
-    black_codes_[index(::baduk::Point(5, 13))] = 5424879681021215287LL;
-    black_codes_[index(::baduk::Point(5, 14))] = 2835646714989461321LL;
-    black_codes_[index(::baduk::Point(5, 15))] = 7521986253258685754LL;
-    black_codes_[index(::baduk::Point(5, 16))] = 3028454839917722708LL;
-    black_codes_[index(::baduk::Point(5, 17))] = 4268560285614740481LL;
-    black_codes_[index(::baduk::Point(5, 18))] = 5639551995951465017LL;
-    black_codes_[index(::baduk::Point(5, 19))] = 1813924866957334138LL;
-    black_codes_[index(::baduk::Point(5, 20))] = 688439151129628543LL;
-    black_codes_[index(::baduk::Point(5, 21))] = 7354850246998839550LL;
-    black_codes_[index(::baduk::Point(5, 22))] = 6329259817782211526LL;
-    black_codes_[index(::baduk::Point(5, 23))] = 6459186954724208667LL;
-    black_codes_[index(::baduk::Point(5, 24))] = 5575400291320398594LL;
-    black_codes_[index(::baduk::Point(6, 0))] = 3420325938253135748LL;
-    black_codes_[index(::baduk::Point(6, 1))] = 6987609491483972077LL;
-    black_codes_[index(::baduk::Point(6, 2))] = 793529379860118672LL;
-    black_codes_[index(::baduk::Point(6, 3))] = 3504951498285241611LL;
-    black_codes_[index(::baduk::Point(6, 4))] = 9124937914320348776LL;
-    black_codes_[index(::baduk::Point(6, 5))] = 1491924739263828120LL;
-    black_codes_[index(::baduk::Point(6, 6))] = 8523573100859665160LL;
-    black_codes_[index(::baduk::Point(6, 7))] = 8325753970464961515LL;
-    black_codes_[index(::baduk::Point(6, 8))] = 8471310100210193299LL;
-    black_codes_[index(::baduk::Point(6, 9))] = 465911546276816786LL;
-    black_codes_[index(::baduk::Point(6, 10))] = 6522593671049257946LL;
-    black_codes_[index(::baduk::Point(6, 11))] = 1892456214319543769LL;
-    black_codes_[index(::baduk::Point(6, 12))] = 2485869526343604701LL;
-    black_codes_[index(::baduk::Point(6, 13))] = 1956517781367696065LL;
-    black_codes_[index(::baduk::Point(6, 14))] = 6877393069337255670LL;
-    black_codes_[index(::baduk::Point(6, 15))] = 9164210214219941014LL;
-    black_codes_[index(::baduk::Point(6, 16))] = 3457277579014368720LL;
-    black_codes_[index(::baduk::Point(6, 17))] = 2873234478667748597LL;
-    black_codes_[index(::baduk::Point(6, 18))] = 7084906894765115960LL;
-    black_codes_[index(::baduk::Point(6, 19))] = 4321282120674927701LL;
-    black_codes_[index(::baduk::Point(6, 20))] = 1207311323666387177LL;
-    black_codes_[index(::baduk::Point(6, 21))] = 7078149668789523358LL;
-    black_codes_[index(::baduk::Point(6, 22))] = 4316455722733049758LL;
-    black_codes_[index(::baduk::Point(6, 23))] = 7241667031238114121LL;
-    black_codes_[index(::baduk::Point(6, 24))] = 1790079430798413363LL;
-    black_codes_[index(::baduk::Point(7, 0))] = 3593347847216723661LL;
-    black_codes_[index(::baduk::Point(7, 1))] = 1446686950683645214LL;
-    black_codes_[index(::baduk::Point(7, 2))] = 665747446837356282LL;
-    black_codes_[index(::baduk::Point(7, 3))] = 7773905612994497883LL;
-    black_codes_[index(::baduk::Point(7, 4))] = 4506824184634211288LL;
-    black_codes_[index(::baduk::Point(7, 5))] = 473406275241802816LL;
-    black_codes_[index(::baduk::Point(7, 6))] = 5213607122248544298LL;
-    black_codes_[index(::baduk::Point(7, 7))] = 8068252477250733591LL;
-    black_codes_[index(::baduk::Point(7, 8))] = 7265457189903450435LL;
-    black_codes_[index(::baduk::Point(7, 9))] = 7915635520564219568LL;
-    black_codes_[index(::baduk::Point(7, 10))] = 7193677186652485836LL;
-    black_codes_[index(::baduk::Point(7, 11))] = 6685710549102207038LL;
-    black_codes_[index(::baduk::Point(7, 12))] = 4760286610940503666LL;
-    black_codes_[index(::baduk::Point(7, 13))] = 6508772357414750625LL;
-    black_codes_[index(::baduk::Point(7, 14))] = 8704985093108649340LL;
-    black_codes_[index(::baduk::Point(7, 15))] = 5572681662733844015LL;
-    black_codes_[index(::baduk::Point(7, 16))] = 5497832874035549716LL;
-    black_codes_[index(::baduk::Point(7, 17))] = 2858797082533460611LL;
-    black_codes_[index(::baduk::Point(7, 18))] = 8808318434053901981LL;
-    black_codes_[index(::baduk::Point(7, 19))] = 4200173719606920068LL;
-    black_codes_[index(::baduk::Point(7, 20))] = 6108508257091269013LL;
-    black_codes_[index(::baduk::Point(7, 21))] = 539548725532803030LL;
-    black_codes_[index(::baduk::Point(7, 22))] = 2034298087791572037LL;
-    black_codes_[index(::baduk::Point(7, 23))] = 702877412254693234LL;
-    black_codes_[index(::baduk::Point(7, 24))] = 197339590916877712LL;
-    black_codes_[index(::baduk::Point(8, 0))] = 645926719851231511LL;
-    black_codes_[index(::baduk::Point(8, 1))] = 6873574090693701017LL;
-    black_codes_[index(::baduk::Point(8, 2))] = 7300454561538740809LL;
-    black_codes_[index(::baduk::Point(8, 3))] = 4956618673223177653LL;
-    black_codes_[index(::baduk::Point(8, 4))] = 8470118080207022267LL;
-    black_codes_[index(::baduk::Point(8, 5))] = 3517889347138053310LL;
-    black_codes_[index(::baduk::Point(8, 6))] = 5110296461217698907LL;
-    black_codes_[index(::baduk::Point(8, 7))] = 1947600607318043942LL;
-    black_codes_[index(::baduk::Point(8, 8))] = 6130234872922191719LL;
-    black_codes_[index(::baduk::Point(8, 9))] = 7291546417598722609LL;
-    black_codes_[index(::baduk::Point(8, 10))] = 3518618357068532634LL;
-    black_codes_[index(::baduk::Point(8, 11))] = 393349501444675584LL;
-    black_codes_[index(::baduk::Point(8, 12))] = 3602578890839258247LL;
-    black_codes_[index(::baduk::Point(8, 13))] = 3871792898332568882LL;
-    black_codes_[index(::baduk::Point(8, 14))] = 2268728694030288726LL;
-    black_codes_[index(::baduk::Point(8, 15))] = 2845505343341162196LL;
-    black_codes_[index(::baduk::Point(8, 16))] = 8581359236020652680LL;
-    black_codes_[index(::baduk::Point(8, 17))] = 8305752055467413586LL;
-    black_codes_[index(::baduk::Point(8, 18))] = 4216403788394710196LL;
-    black_codes_[index(::baduk::Point(8, 19))] = 3473311223529498019LL;
-    black_codes_[index(::baduk::Point(8, 20))] = 1158427148254691857LL;
-    black_codes_[index(::baduk::Point(8, 21))] = 3899072487230345432LL;
-    black_codes_[index(::baduk::Point(8, 22))] = 1362545451319316884LL;
-    black_codes_[index(::baduk::Point(8, 23))] = 4734706466004189239LL;
-    black_codes_[index(::baduk::Point(8, 24))] = 2794226715564571911LL;
-    black_codes_[index(::baduk::Point(9, 0))] = 7109150640999153284LL;
-    black_codes_[index(::baduk::Point(9, 1))] = 8962018899229636085LL;
-    black_codes_[index(::baduk::Point(9, 2))] = 5735790214799384307LL;
-    black_codes_[index(::baduk::Point(9, 3))] = 3831038378769999795LL;
-    black_codes_[index(::baduk::Point(9, 4))] = 1762575808632919017LL;
-    black_codes_[index(::baduk::Point(9, 5))] = 8689823379334930577LL;
-    black_codes_[index(::baduk::Point(9, 6))] = 7711248234172263898LL;
-    black_codes_[index(::baduk::Point(9, 7))] = 4978532608384880381LL;
-    black_codes_[index(::baduk::Point(9, 8))] = 7847646669817434689LL;
-    black_codes_[index(::baduk::Point(9, 9))] = 7603292243848591490LL;
-    black_codes_[index(::baduk::Point(9, 10))] = 4762739485552162643LL;
-    black_codes_[index(::baduk::Point(9, 11))] = 4924410739379446404LL;
-    black_codes_[index(::baduk::Point(9, 12))] = 1397570616026586646LL;
-    black_codes_[index(::baduk::Point(9, 13))] = 2115257736411235045LL;
-    black_codes_[index(::baduk::Point(9, 14))] = 6742400939214383473LL;
-    black_codes_[index(::baduk::Point(9, 15))] = 3533665139518703429LL;
-    black_codes_[index(::baduk::Point(9, 16))] = 1096550367914626402LL;
-    black_codes_[index(::baduk::Point(9, 17))] = 560148001470350647LL;
-    black_codes_[index(::baduk::Point(9, 18))] = 2159114244248457864LL;
-    black_codes_[index(::baduk::Point(9, 19))] = 1892447424105782147LL;
-    black_codes_[index(::baduk::Point(9, 20))] = 3472862243654511368LL;
-    black_codes_[index(::baduk::Point(9, 21))] = 7230573168036078227LL;
-    black_codes_[index(::baduk::Point(9, 22))] = 7180274711046132077LL;
-    black_codes_[index(::baduk::Point(9, 23))] = 8709198305102904684LL;
-    black_codes_[index(::baduk::Point(9, 24))] = 2072453489892754189LL;
-    black_codes_[index(::baduk::Point(10, 0))] = 7035331930253889942LL;
-    black_codes_[index(::baduk::Point(10, 1))] = 7533279690822164562LL;
-    black_codes_[index(::baduk::Point(10, 2))] = 2794829796405989142LL;
-    black_codes_[index(::baduk::Point(10, 3))] = 2099907633409894934LL;
-    black_codes_[index(::baduk::Point(10, 4))] = 4577403109915545848LL;
-    black_codes_[index(::baduk::Point(10, 5))] = 3054252239540877734LL;
-    black_codes_[index(::baduk::Point(10, 6))] = 8931620695992386233LL;
-    black_codes_[index(::baduk::Point(10, 7))] = 8767704250489769056LL;
-    black_codes_[index(::baduk::Point(10, 8))] = 1783358491485775014LL;
-    black_codes_[index(::baduk::Point(10, 9))] = 1337288109957332230LL;
-    black_codes_[index(::baduk::Point(10, 10))] = 4241495388826570331LL;
-    black_codes_[index(::baduk::Point(10, 11))] = 810436780278871254LL;
-    black_codes_[index(::baduk::Point(10, 12))] = 7167469869016631557LL;
-    black_codes_[index(::baduk::Point(10, 13))] = 858783324475479119LL;
-    black_codes_[index(::baduk::Point(10, 14))] = 8555382998289594464LL;
-    black_codes_[index(::baduk::Point(10, 15))] = 3454551921934684353LL;
-    black_codes_[index(::baduk::Point(10, 16))] = 2372267904008339436LL;
-    black_codes_[index(::baduk::Point(10, 17))] = 1070131740134773437LL;
-    black_codes_[index(::baduk::Point(10, 18))] = 3592884673233071750LL;
-    black_codes_[index(::baduk::Point(10, 19))] = 982150351063689208LL;
-    black_codes_[index(::baduk::Point(10, 20))] = 6791921305965738165LL;
-    black_codes_[index(::baduk::Point(10, 21))] = 6412535344267866115LL;
-    black_codes_[index(::baduk::Point(10, 22))] = 6213370958021378077LL;
-    black_codes_[index(::baduk::Point(10, 23))] = 5155333909435220102LL;
-    black_codes_[index(::baduk::Point(10, 24))] = 1478264698604985205LL;
-    black_codes_[index(::baduk::Point(11, 0))] = 2158098028193593690LL;
-    black_codes_[index(::baduk::Point(11, 1))] = 2920242474165984158LL;
-    black_codes_[index(::baduk::Point(11, 2))] = 5272164378015304653LL;
-    black_codes_[index(::baduk::Point(11, 3))] = 4755010486846625158LL;
-    black_codes_[index(::baduk::Point(11, 4))] = 5973191247531021323LL;
-    black_codes_[index(::baduk::Point(11, 5))] = 6130946196060392604LL;
-    black_codes_[index(::baduk::Point(11, 6))] = 1939906071185930603LL;
-    black_codes_[index(::baduk::Point(11, 7))] = 1351609060771222353LL;
-    black_codes_[index(::baduk::Point(11, 8))] = 6889416973831626484LL;
-    black_codes_[index(::baduk::Point(11, 9))] = 3485071284912826543LL;
-    black_codes_[index(::baduk::Point(11, 10))] = 8429007054775109916LL;
-    black_codes_[index(::baduk::Point(11, 11))] = 716856825427062659LL;
-    black_codes_[index(::baduk::Point(11, 12))] = 8336812343896082537LL;
-    black_codes_[index(::baduk::Point(11, 13))] = 5524579218993126000LL;
-    black_codes_[index(::baduk::Point(11, 14))] = 9039994988132845317LL;
-    black_codes_[index(::baduk::Point(11, 15))] = 8704836267602278652LL;
-    black_codes_[index(::baduk::Point(11, 16))] = 7289071954304731267LL;
-    black_codes_[index(::baduk::Point(11, 17))] = 4220729316398875560LL;
-    black_codes_[index(::baduk::Point(11, 18))] = 7600126403477464450LL;
-    black_codes_[index(::baduk::Point(11, 19))] = 9186426307950600607LL;
-    black_codes_[index(::baduk::Point(11, 20))] = 6123573489210846454LL;
-    black_codes_[index(::baduk::Point(11, 21))] = 4211392291642490267LL;
-    black_codes_[index(::baduk::Point(11, 22))] = 2119994498839422004LL;
-    black_codes_[index(::baduk::Point(11, 23))] = 900178788758615861LL;
-    black_codes_[index(::baduk::Point(11, 24))] = 2665244972098714597LL;
-    black_codes_[index(::baduk::Point(12, 0))] = 8082238459527270702LL;
-    black_codes_[index(::baduk::Point(12, 1))] = 5433446596564068484LL;
-    black_codes_[index(::baduk::Point(12, 2))] = 8814350719237827182LL;
-    black_codes_[index(::baduk::Point(12, 3))] = 3924297351972874637LL;
-    black_codes_[index(::baduk::Point(12, 4))] = 7779428691265570285LL;
-    black_codes_[index(::baduk::Point(12, 5))] = 8153946563757748970LL;
-    black_codes_[index(::baduk::Point(12, 6))] = 7976170832396108869LL;
-    black_codes_[index(::baduk::Point(12, 7))] = 8005963403454012268LL;
-    black_codes_[index(::baduk::Point(12, 8))] = 2592262130917342079LL;
-    black_codes_[index(::baduk::Point(12, 9))] = 2404182286580980475LL;
-    black_codes_[index(::baduk::Point(12, 10))] = 282304406713751367LL;
-    black_codes_[index(::baduk::Point(12, 11))] = 427219216054507361LL;
-    black_codes_[index(::baduk::Point(12, 12))] = 1882246714060425498LL;
-    black_codes_[index(::baduk::Point(12, 13))] = 7099803786794744352LL;
-    black_codes_[index(::baduk::Point(12, 14))] = 2620253239302997106LL;
-    black_codes_[index(::baduk::Point(12, 15))] = 659283090266318282LL;
-    black_codes_[index(::baduk::Point(12, 16))] = 5584545628617097626LL;
-    black_codes_[index(::baduk::Point(12, 17))] = 3834886810655757188LL;
-    black_codes_[index(::baduk::Point(12, 18))] = 9096229625016852791LL;
-    black_codes_[index(::baduk::Point(12, 19))] = 5525621608201525802LL;
-    black_codes_[index(::baduk::Point(12, 20))] = 9024326360098610676LL;
-    black_codes_[index(::baduk::Point(12, 21))] = 7625091695454819683LL;
-    black_codes_[index(::baduk::Point(12, 22))] = 4094477113205310782LL;
-    black_codes_[index(::baduk::Point(12, 23))] = 6026476853795338052LL;
-    black_codes_[index(::baduk::Point(12, 24))] = 1785411094317961947LL;
-    black_codes_[index(::baduk::Point(13, 0))] = 7067430411963401746LL;
-    black_codes_[index(::baduk::Point(13, 1))] = 1103587303996743186LL;
-    black_codes_[index(::baduk::Point(13, 2))] = 2504813616719002529LL;
-    black_codes_[index(::baduk::Point(13, 3))] = 4694742329704812990LL;
-    black_codes_[index(::baduk::Point(13, 4))] = 3486845140987580861LL;
-    black_codes_[index(::baduk::Point(13, 5))] = 154498544568522039LL;
-    black_codes_[index(::baduk::Point(13, 6))] = 732234123854564402LL;
-    black_codes_[index(::baduk::Point(13, 7))] = 1316760921663138990LL;
-    black_codes_[index(::baduk::Point(13, 8))] = 619873016987045669LL;
-    black_codes_[index(::baduk::Point(13, 9))] = 1724515332151656083LL;
-    black_codes_[index(::baduk::Point(13, 10))] = 6467858153817129085LL;
-    black_codes_[index(::baduk::Point(13, 11))] = 45071117596217560LL;
-    black_codes_[index(::baduk::Point(13, 12))] = 2309502448560836667LL;
-    black_codes_[index(::baduk::Point(13, 13))] = 1876611771545844215LL;
-    black_codes_[index(::baduk::Point(13, 14))] = 3736124669719135756LL;
-    black_codes_[index(::baduk::Point(13, 15))] = 5734991556974147396LL;
-    black_codes_[index(::baduk::Point(13, 16))] = 6434729106185183641LL;
-    black_codes_[index(::baduk::Point(13, 17))] = 7901546730921118586LL;
-    black_codes_[index(::baduk::Point(13, 18))] = 4300102975700375707LL;
-    black_codes_[index(::baduk::Point(13, 19))] = 1368777964149002368LL;
-    black_codes_[index(::baduk::Point(13, 20))] = 1827611548634507241LL;
-    black_codes_[index(::baduk::Point(13, 21))] = 2057292829156916130LL;
-    black_codes_[index(::baduk::Point(13, 22))] = 5416655859466955961LL;
-    black_codes_[index(::baduk::Point(13, 23))] = 2261682865856262751LL;
-    black_codes_[index(::baduk::Point(13, 24))] = 8736107272340421877LL;
-    black_codes_[index(::baduk::Point(14, 0))] = 1454054538239277057LL;
-    black_codes_[index(::baduk::Point(14, 1))] = 6410618530896608291LL;
-    black_codes_[index(::baduk::Point(14, 2))] = 891390251645616948LL;
-    black_codes_[index(::baduk::Point(14, 3))] = 3720187197827100855LL;
-    black_codes_[index(::baduk::Point(14, 4))] = 940265691598663442LL;
-    black_codes_[index(::baduk::Point(14, 5))] = 394024827292375598LL;
-    black_codes_[index(::baduk::Point(14, 6))] = 7852625123532919757LL;
-    black_codes_[index(::baduk::Point(14, 7))] = 7478798667990050958LL;
-    black_codes_[index(::baduk::Point(14, 8))] = 210471772290959744LL;
-    black_codes_[index(::baduk::Point(14, 9))] = 8644879169460636455LL;
-    black_codes_[index(::baduk::Point(14, 10))] = 2418317160979372713LL;
-    black_codes_[index(::baduk::Point(14, 11))] = 461437478174840835LL;
-    black_codes_[index(::baduk::Point(14, 12))] = 7096977895080867114LL;
-    black_codes_[index(::baduk::Point(14, 13))] = 4718472729258169575LL;
-    black_codes_[index(::baduk::Point(14, 14))] = 6525424211931248796LL;
-    black_codes_[index(::baduk::Point(14, 15))] = 6707407793960384619LL;
-    black_codes_[index(::baduk::Point(14, 16))] = 2530294114670363961LL;
-    black_codes_[index(::baduk::Point(14, 17))] = 1668654081656059589LL;
-    black_codes_[index(::baduk::Point(14, 18))] = 3487011187360061761LL;
-    black_codes_[index(::baduk::Point(14, 19))] = 9058317087248694792LL;
-    black_codes_[index(::baduk::Point(14, 20))] = 3792816592599247805LL;
-    black_codes_[index(::baduk::Point(14, 21))] = 5819598665691027313LL;
-    black_codes_[index(::baduk::Point(14, 22))] = 3934979813465588637LL;
-    black_codes_[index(::baduk::Point(14, 23))] = 947291295306077190LL;
-    black_codes_[index(::baduk::Point(14, 24))] = 1224261176520867504LL;
-    black_codes_[index(::baduk::Point(15, 0))] = 144401790826381350LL;
-    black_codes_[index(::baduk::Point(15, 1))] = 3330467913612159967LL;
-    black_codes_[index(::baduk::Point(15, 2))] = 5667673125693798528LL;
-    black_codes_[index(::baduk::Point(15, 3))] = 353951270059167413LL;
-    black_codes_[index(::baduk::Point(15, 4))] = 8431369814575380107LL;
-    black_codes_[index(::baduk::Point(15, 5))] = 7655623777571231276LL;
-    black_codes_[index(::baduk::Point(15, 6))] = 8638377732706515824LL;
-    black_codes_[index(::baduk::Point(15, 7))] = 1918723362817229528LL;
-    black_codes_[index(::baduk::Point(15, 8))] = 2461669805512777136LL;
-    black_codes_[index(::baduk::Point(15, 9))] = 6653459596890178647LL;
-    black_codes_[index(::baduk::Point(15, 10))] = 922762451087588972LL;
-    black_codes_[index(::baduk::Point(15, 11))] = 4792457809873331058LL;
-    black_codes_[index(::baduk::Point(15, 12))] = 3429394358974234181LL;
-    black_codes_[index(::baduk::Point(15, 13))] = 8960922195342595770LL;
-    black_codes_[index(::baduk::Point(15, 14))] = 7041646228969867296LL;
-    black_codes_[index(::baduk::Point(15, 15))] = 2996258984220396288LL;
-    black_codes_[index(::baduk::Point(15, 16))] = 8552759250781365346LL;
-    black_codes_[index(::baduk::Point(15, 17))] = 5506700128362662745LL;
-    black_codes_[index(::baduk::Point(15, 18))] = 5545258676728528312LL;
-    black_codes_[index(::baduk::Point(15, 19))] = 1629727473413152441LL;
-    black_codes_[index(::baduk::Point(15, 20))] = 5418496493568297798LL;
-    black_codes_[index(::baduk::Point(15, 21))] = 7535575373976494418LL;
-    black_codes_[index(::baduk::Point(15, 22))] = 2519297607433518790LL;
-    black_codes_[index(::baduk::Point(15, 23))] = 6742427182566926538LL;
-    black_codes_[index(::baduk::Point(15, 24))] = 8495024952215076724LL;
-    black_codes_[index(::baduk::Point(16, 0))] = 4037493054275156564LL;
-    black_codes_[index(::baduk::Point(16, 1))] = 7361654968027677636LL;
-    black_codes_[index(::baduk::Point(16, 2))] = 353342502990999036LL;
-    black_codes_[index(::baduk::Point(16, 3))] = 3555507647057261537LL;
-    black_codes_[index(::baduk::Point(16, 4))] = 7189399988656424980LL;
-    black_codes_[index(::baduk::Point(16, 5))] = 4617254118796323970LL;
-    black_codes_[index(::baduk::Point(16, 6))] = 7066442515038285793LL;
-    black_codes_[index(::baduk::Point(16, 7))] = 1151335088956292142LL;
-    black_codes_[index(::baduk::Point(16, 8))] = 1841307014626863021LL;
-    black_codes_[index(::baduk::Point(16, 9))] = 8088982804364748505LL;
-    black_codes_[index(::baduk::Point(16, 10))] = 7739721740425058350LL;
-    black_codes_[index(::baduk::Point(16, 11))] = 4842042812801569253LL;
-    black_codes_[index(::baduk::Point(16, 12))] = 5507498308585020449LL;
-    black_codes_[index(::baduk::Point(16, 13))] = 8942588082906497877LL;
-    black_codes_[index(::baduk::Point(16, 14))] = 3693493643029935165LL;
-    black_codes_[index(::baduk::Point(16, 15))] = 7718670358002916116LL;
-    black_codes_[index(::baduk::Point(16, 16))] = 3325551908494253339LL;
-    black_codes_[index(::baduk::Point(16, 17))] = 6056348368083359289LL;
-    black_codes_[index(::baduk::Point(16, 18))] = 8869755201127055565LL;
-    black_codes_[index(::baduk::Point(16, 19))] = 6674695941544845819LL;
-    black_codes_[index(::baduk::Point(16, 20))] = 6008226098612012171LL;
-    black_codes_[index(::baduk::Point(16, 21))] = 3945149187070775648LL;
-    black_codes_[index(::baduk::Point(16, 22))] = 8000667754046332477LL;
-    black_codes_[index(::baduk::Point(16, 23))] = 7932355031303923172LL;
-    black_codes_[index(::baduk::Point(16, 24))] = 73351765383082216LL;
-    black_codes_[index(::baduk::Point(17, 0))] = 321037943510852264LL;
-    black_codes_[index(::baduk::Point(17, 1))] = 2534741247333077203LL;
-    black_codes_[index(::baduk::Point(17, 2))] = 8201818753643828029LL;
-    black_codes_[index(::baduk::Point(17, 3))] = 7740039950921293799LL;
-    black_codes_[index(::baduk::Point(17, 4))] = 8116052488762759661LL;
-    black_codes_[index(::baduk::Point(17, 5))] = 6011837205630096127LL;
-    black_codes_[index(::baduk::Point(17, 6))] = 7630684338751421127LL;
-    black_codes_[index(::baduk::Point(17, 7))] = 430628290762170220LL;
-    black_codes_[index(::baduk::Point(17, 8))] = 4777041012279780613LL;
-    black_codes_[index(::baduk::Point(17, 9))] = 101676705143789213LL;
-    black_codes_[index(::baduk::Point(17, 10))] = 2824973303027916040LL;
-    black_codes_[index(::baduk::Point(17, 11))] = 397238337142023022LL;
-    black_codes_[index(::baduk::Point(17, 12))] = 7256764650496966923LL;
-    black_codes_[index(::baduk::Point(17, 13))] = 8638432046907180565LL;
-    black_codes_[index(::baduk::Point(17, 14))] = 6722639573495566941LL;
-    black_codes_[index(::baduk::Point(17, 15))] = 2431436243757656052LL;
-    black_codes_[index(::baduk::Point(17, 16))] = 1396549525043529989LL;
-    black_codes_[index(::baduk::Point(17, 17))] = 8147007835088341891LL;
-    black_codes_[index(::baduk::Point(17, 18))] = 7299201624997330023LL;
-    black_codes_[index(::baduk::Point(17, 19))] = 1110200876181905642LL;
-    black_codes_[index(::baduk::Point(17, 20))] = 636150746503235277LL;
-    black_codes_[index(::baduk::Point(17, 21))] = 6502374562493387901LL;
-    black_codes_[index(::baduk::Point(17, 22))] = 556852984422030020LL;
-    black_codes_[index(::baduk::Point(17, 23))] = 8709291114284627596LL;
-    black_codes_[index(::baduk::Point(17, 24))] = 8350176080483342272LL;
-    black_codes_[index(::baduk::Point(18, 0))] = 283680264279344616LL;
-    black_codes_[index(::baduk::Point(18, 1))] = 5589459731165243546LL;
-    black_codes_[index(::baduk::Point(18, 2))] = 6669491666750875833LL;
-    black_codes_[index(::baduk::Point(18, 3))] = 3627795721197864189LL;
-    black_codes_[index(::baduk::Point(18, 4))] = 5884813530026430572LL;
-    black_codes_[index(::baduk::Point(18, 5))] = 4305979756315123878LL;
-    black_codes_[index(::baduk::Point(18, 6))] = 7535163070084755505LL;
-    black_codes_[index(::baduk::Point(18, 7))] = 1903728085690186955LL;
-    black_codes_[index(::baduk::Point(18, 8))] = 3994244423201733913LL;
-    black_codes_[index(::baduk::Point(18, 9))] = 3290651713725924153LL;
-    black_codes_[index(::baduk::Point(18, 10))] = 5216638051763052992LL;
-    black_codes_[index(::baduk::Point(18, 11))] = 4293058410346024072LL;
-    black_codes_[index(::baduk::Point(18, 12))] = 1372028034531581201LL;
-    black_codes_[index(::baduk::Point(18, 13))] = 3273648342800460278LL;
-    black_codes_[index(::baduk::Point(18, 14))] = 8287391887775627268LL;
-    black_codes_[index(::baduk::Point(18, 15))] = 6944004006785442220LL;
-    black_codes_[index(::baduk::Point(18, 16))] = 1271848124679970401LL;
-    black_codes_[index(::baduk::Point(18, 17))] = 8806808567908551533LL;
-    black_codes_[index(::baduk::Point(18, 18))] = 5029100679917961133LL;
-    black_codes_[index(::baduk::Point(18, 19))] = 1613880983863957719LL;
-    black_codes_[index(::baduk::Point(18, 20))] = 4005465083017220821LL;
-    black_codes_[index(::baduk::Point(18, 21))] = 2906518941904244249LL;
-    black_codes_[index(::baduk::Point(18, 22))] = 5551555233657228270LL;
-    black_codes_[index(::baduk::Point(18, 23))] = 3306186717980077155LL;
-    black_codes_[index(::baduk::Point(18, 24))] = 6040220549275256030LL;
-    black_codes_[index(::baduk::Point(19, 0))] = 2728232467680143501LL;
-    black_codes_[index(::baduk::Point(19, 1))] = 781196830473137516LL;
-    black_codes_[index(::baduk::Point(19, 2))] = 6947834659822176226LL;
-    black_codes_[index(::baduk::Point(19, 3))] = 1840774639333312830LL;
-    black_codes_[index(::baduk::Point(19, 4))] = 7934825096658404811LL;
-    black_codes_[index(::baduk::Point(19, 5))] = 4382688415670064725LL;
-    black_codes_[index(::baduk::Point(19, 6))] = 1492749433173915686LL;
-    black_codes_[index(::baduk::Point(19, 7))] = 3383459663429673904LL;
-    black_codes_[index(::baduk::Point(19, 8))] = 4564148729310409849LL;
-    black_codes_[index(::baduk::Point(19, 9))] = 3927518790300054514LL;
-    black_codes_[index(::baduk::Point(19, 10))] = 497119886019925894LL;
-    black_codes_[index(::baduk::Point(19, 11))] = 8642861963683917347LL;
-    black_codes_[index(::baduk::Point(19, 12))] = 8978151821856491060LL;
-    black_codes_[index(::baduk::Point(19, 13))] = 1045894164977268767LL;
-    black_codes_[index(::baduk::Point(19, 14))] = 484839894403394087LL;
-    black_codes_[index(::baduk::Point(19, 15))] = 5065619256800516593LL;
-    black_codes_[index(::baduk::Point(19, 16))] = 1555752431811248401LL;
-    black_codes_[index(::baduk::Point(19, 17))] = 2497694190833710521LL;
-    black_codes_[index(::baduk::Point(19, 18))] = 3021595266587333805LL;
-    black_codes_[index(::baduk::Point(19, 19))] = 8487161712275742296LL;
-    black_codes_[index(::baduk::Point(19, 20))] = 8393677135310820778LL;
-    black_codes_[index(::baduk::Point(19, 21))] = 2866496080075018287LL;
-    black_codes_[index(::baduk::Point(19, 22))] = 2909215611791053453LL;
-    black_codes_[index(::baduk::Point(19, 23))] = 6118278379043974596LL;
-    black_codes_[index(::baduk::Point(19, 24))] = 7334334718837047111LL;
-    black_codes_[index(::baduk::Point(20, 0))] = 5786910409869953054LL;
-    black_codes_[index(::baduk::Point(20, 1))] = 2946324443042972281LL;
-    black_codes_[index(::baduk::Point(20, 2))] = 8357724410492545629LL;
-    black_codes_[index(::baduk::Point(20, 3))] = 4472788394945601306LL;
-    black_codes_[index(::baduk::Point(20, 4))] = 8104688125670046245LL;
-    black_codes_[index(::baduk::Point(20, 5))] = 7403054001950143683LL;
-    black_codes_[index(::baduk::Point(20, 6))] = 5205978960220499555LL;
-    black_codes_[index(::baduk::Point(20, 7))] = 660525738283192404LL;
-    black_codes_[index(::baduk::Point(20, 8))] = 6081426055756428768LL;
-    black_codes_[index(::baduk::Point(20, 9))] = 3572486344554272593LL;
-    black_codes_[index(::baduk::Point(20, 10))] = 8100124906130411117LL;
-    black_codes_[index(::baduk::Point(20, 11))] = 6215273367307936413LL;
-    black_codes_[index(::baduk::Point(20, 12))] = 4013623076348559890LL;
-    black_codes_[index(::baduk::Point(20, 13))] = 8232170477857562139LL;
-    black_codes_[index(::baduk::Point(20, 14))] = 6351929620753002625LL;
-    black_codes_[index(::baduk::Point(20, 15))] = 1227296675108121415LL;
-    black_codes_[index(::baduk::Point(20, 16))] = 292885539040544694LL;
-    black_codes_[index(::baduk::Point(20, 17))] = 9018340847550202981LL;
-    black_codes_[index(::baduk::Point(20, 18))] = 8471534061708601467LL;
-    black_codes_[index(::baduk::Point(20, 19))] = 4604579092191539203LL;
-    black_codes_[index(::baduk::Point(20, 20))] = 2135655880839411381LL;
-    black_codes_[index(::baduk::Point(20, 21))] = 1637407411871156078LL;
-    black_codes_[index(::baduk::Point(20, 22))] = 3062904194056068165LL;
-    black_codes_[index(::baduk::Point(20, 23))] = 5263928249283504526LL;
-    black_codes_[index(::baduk::Point(20, 24))] = 3752718990335541965LL;
-    black_codes_[index(::baduk::Point(21, 0))] = 3817715026519535884LL;
-    black_codes_[index(::baduk::Point(21, 1))] = 2608132581821717125LL;
-    black_codes_[index(::baduk::Point(21, 2))] = 1571065457396476245LL;
-    black_codes_[index(::baduk::Point(21, 3))] = 7708448419858849589LL;
-    black_codes_[index(::baduk::Point(21, 4))] = 1100330243033338551LL;
-    black_codes_[index(::baduk::Point(21, 5))] = 6959748013391548976LL;
-    black_codes_[index(::baduk::Point(21, 6))] = 6434291786417304701LL;
-    black_codes_[index(::baduk::Point(21, 7))] = 8855112844336722208LL;
-    black_codes_[index(::baduk::Point(21, 8))] = 8937805159721890351LL;
-    black_codes_[index(::baduk::Point(21, 9))] = 6306187456301908448LL;
-    black_codes_[index(::baduk::Point(21, 10))] = 675017504425301309LL;
-    black_codes_[index(::baduk::Point(21, 11))] = 1679104815430749202LL;
-    black_codes_[index(::baduk::Point(21, 12))] = 7278364994088327238LL;
-    black_codes_[index(::baduk::Point(21, 13))] = 5496572113694601418LL;
-    black_codes_[index(::baduk::Point(21, 14))] = 895506866656609331LL;
-    black_codes_[index(::baduk::Point(21, 15))] = 1656948237365128424LL;
-    black_codes_[index(::baduk::Point(21, 16))] = 1616603844688210134LL;
-    black_codes_[index(::baduk::Point(21, 17))] = 5201663547529813394LL;
-    black_codes_[index(::baduk::Point(21, 18))] = 8757724625492255652LL;
-    black_codes_[index(::baduk::Point(21, 19))] = 2082107989971656822LL;
-    black_codes_[index(::baduk::Point(21, 20))] = 3754537260090299338LL;
-    black_codes_[index(::baduk::Point(21, 21))] = 8997167865376504440LL;
-    black_codes_[index(::baduk::Point(21, 22))] = 7149626136655998105LL;
-    black_codes_[index(::baduk::Point(21, 23))] = 2892971758768740209LL;
-    black_codes_[index(::baduk::Point(21, 24))] = 1647796379278784567LL;
-    black_codes_[index(::baduk::Point(22, 0))] = 8398761715622615846LL;
-    black_codes_[index(::baduk::Point(22, 1))] = 3025079470679476448LL;
-    black_codes_[index(::baduk::Point(22, 2))] = 6114299016025665423LL;
-    black_codes_[index(::baduk::Point(22, 3))] = 7988022026544746298LL;
-    black_codes_[index(::baduk::Point(22, 4))] = 3840848224456789130LL;
-    black_codes_[index(::baduk::Point(22, 5))] = 6393528063851993131LL;
-    black_codes_[index(::baduk::Point(22, 6))] = 8149146367722546803LL;
-    black_codes_[index(::baduk::Point(22, 7))] = 5701169153478230582LL;
-    black_codes_[index(::baduk::Point(22, 8))] = 5118134808007043267LL;
-    black_codes_[index(::baduk::Point(22, 9))] = 5976960379390309411LL;
-    black_codes_[index(::baduk::Point(22, 10))] = 2040545526011626531LL;
-    black_codes_[index(::baduk::Point(22, 11))] = 2050088664217196725LL;
-    black_codes_[index(::baduk::Point(22, 12))] = 5069631863802083173LL;
-    black_codes_[index(::baduk::Point(22, 13))] = 8558181656338873555LL;
-    black_codes_[index(::baduk::Point(22, 14))] = 6686842776333855434LL;
-    black_codes_[index(::baduk::Point(22, 15))] = 7368461814723443332LL;
-    black_codes_[index(::baduk::Point(22, 16))] = 7727183690455786045LL;
-    black_codes_[index(::baduk::Point(22, 17))] = 2592479090563763578LL;
-    black_codes_[index(::baduk::Point(22, 18))] = 7254065334877504644LL;
-    black_codes_[index(::baduk::Point(22, 19))] = 7953064581841888065LL;
-    black_codes_[index(::baduk::Point(22, 20))] = 5031838649568097432LL;
-    black_codes_[index(::baduk::Point(22, 21))] = 2044900954118955705LL;
-    black_codes_[index(::baduk::Point(22, 22))] = 5321448899087760773LL;
-    black_codes_[index(::baduk::Point(22, 23))] = 848997559944818147LL;
-    black_codes_[index(::baduk::Point(22, 24))] = 1405962185367447634LL;
-    black_codes_[index(::baduk::Point(23, 0))] = 5284739890510471355LL;
-    black_codes_[index(::baduk::Point(23, 1))] = 1052376867868891456LL;
-    black_codes_[index(::baduk::Point(23, 2))] = 4219450766502469324LL;
-    black_codes_[index(::baduk::Point(23, 3))] = 6230875931645247086LL;
-    black_codes_[index(::baduk::Point(23, 4))] = 3770591332381165454LL;
-    black_codes_[index(::baduk::Point(23, 5))] = 3058746657189273969LL;
-    black_codes_[index(::baduk::Point(23, 6))] = 2263317419855088219LL;
-    black_codes_[index(::baduk::Point(23, 7))] = 2489841982743473782LL;
-    black_codes_[index(::baduk::Point(23, 8))] = 1137884538677851861LL;
-    black_codes_[index(::baduk::Point(23, 9))] = 8986011835930571601LL;
-    black_codes_[index(::baduk::Point(23, 10))] = 2399516847852238753LL;
-    black_codes_[index(::baduk::Point(23, 11))] = 942798812276040058LL;
-    black_codes_[index(::baduk::Point(23, 12))] = 896410874477368579LL;
-    black_codes_[index(::baduk::Point(23, 13))] = 296106310177645907LL;
-    black_codes_[index(::baduk::Point(23, 14))] = 573839680999346467LL;
-    black_codes_[index(::baduk::Point(23, 15))] = 2099835636570176531LL;
-    black_codes_[index(::baduk::Point(23, 16))] = 8326413200061559194LL;
-    black_codes_[index(::baduk::Point(23, 17))] = 6563074748133701395LL;
-    black_codes_[index(::baduk::Point(23, 18))] = 4860884520919349639LL;
-    black_codes_[index(::baduk::Point(23, 19))] = 181139891390799597LL;
-    black_codes_[index(::baduk::Point(23, 20))] = 8696569670242982026LL;
-    black_codes_[index(::baduk::Point(23, 21))] = 4638634193184637860LL;
-    black_codes_[index(::baduk::Point(23, 22))] = 4968262095768048205LL;
-    black_codes_[index(::baduk::Point(23, 23))] = 5152591586484041784LL;
-    black_codes_[index(::baduk::Point(23, 24))] = 3487985076879431396LL;
-    black_codes_[index(::baduk::Point(24, 0))] = 5750931592232342509LL;
-    black_codes_[index(::baduk::Point(24, 1))] = 8511872801109269191LL;
-    black_codes_[index(::baduk::Point(24, 2))] = 4269097328741867651LL;
-    black_codes_[index(::baduk::Point(24, 3))] = 2796883577159486598LL;
-    black_codes_[index(::baduk::Point(24, 4))] = 2055799043474049810LL;
-    black_codes_[index(::baduk::Point(24, 5))] = 7548031984708088767LL;
-    black_codes_[index(::baduk::Point(24, 6))] = 8228598933808716736LL;
-    black_codes_[index(::baduk::Point(24, 7))] = 3620758506786840703LL;
-    black_codes_[index(::baduk::Point(24, 8))] = 5942136236060072942LL;
-    black_codes_[index(::baduk::Point(24, 9))] = 688331403879422699LL;
-    black_codes_[index(::baduk::Point(24, 10))] = 7854133081952644359LL;
-    black_codes_[index(::baduk::Point(24, 11))] = 7336829151267375291LL;
-    black_codes_[index(::baduk::Point(24, 12))] = 2789610873212900730LL;
-    black_codes_[index(::baduk::Point(24, 13))] = 1252901161800742628LL;
-    black_codes_[index(::baduk::Point(24, 14))] = 476972643574279882LL;
-    black_codes_[index(::baduk::Point(24, 15))] = 1437644551529087627LL;
-    black_codes_[index(::baduk::Point(24, 16))] = 6329315831110034450LL;
-    black_codes_[index(::baduk::Point(24, 17))] = 5503531156621552162LL;
-    black_codes_[index(::baduk::Point(24, 18))] = 3173337440569891806LL;
-    black_codes_[index(::baduk::Point(24, 19))] = 8458137957705905788LL;
-    black_codes_[index(::baduk::Point(24, 20))] = 21662608527448509LL;
-    black_codes_[index(::baduk::Point(24, 21))] = 7913941866993443242LL;
-    black_codes_[index(::baduk::Point(24, 22))] = 2460820985989664165LL;
-    black_codes_[index(::baduk::Point(24, 23))] = 5645058793865737084LL;
-    black_codes_[index(::baduk::Point(24, 24))] = 8128922889382165908LL;
-    white_codes_.resize(25 * 25);
-    white_codes_[index(::baduk::Point(0, 0))] = 8386342538951923556LL;
-    white_codes_[index(::baduk::Point(0, 1))] = 5694625098829376912LL;
-    white_codes_[index(::baduk::Point(0, 2))] = 2085672594518996615LL;
-    white_codes_[index(::baduk::Point(0, 3))] = 7708937259233421870LL;
-    white_codes_[index(::baduk::Point(0, 4))] = 2115700186208859678LL;
-    white_codes_[index(::baduk::Point(0, 5))] = 1426674871919619576LL;
-    white_codes_[index(::baduk::Point(0, 6))] = 4469107765889080207LL;
-    white_codes_[index(::baduk::Point(0, 7))] = 5318650842624686123LL;
-    white_codes_[index(::baduk::Point(0, 8))] = 8646076206658948711LL;
-    white_codes_[index(::baduk::Point(0, 9))] = 4924077091026109083LL;
-    white_codes_[index(::baduk::Point(0, 10))] = 8097027591217577801LL;
-    white_codes_[index(::baduk::Point(0, 11))] = 7060231605648517350LL;
-    white_codes_[index(::baduk::Point(0, 12))] = 1205004600531041159LL;
-    white_codes_[index(::baduk::Point(0, 13))] = 4629169227208998461LL;
-    white_codes_[index(::baduk::Point(0, 14))] = 5895708494993552807LL;
-    white_codes_[index(::baduk::Point(0, 15))] = 5401768204443013137LL;
-    white_codes_[index(::baduk::Point(0, 16))] = 4510012227396416810LL;
-    white_codes_[index(::baduk::Point(0, 17))] = 3070081248233774079LL;
-    white_codes_[index(::baduk::Point(0, 18))] = 2704500577280108666LL;
-    white_codes_[index(::baduk::Point(0, 19))] = 7774136386499689649LL;
-    white_codes_[index(::baduk::Point(0, 20))] = 2340854904024213252LL;
-    white_codes_[index(::baduk::Point(0, 21))] = 1465712586378801945LL;
-    white_codes_[index(::baduk::Point(0, 22))] = 2316347187592716790LL;
-    white_codes_[index(::baduk::Point(0, 23))] = 3467364240534166383LL;
-    white_codes_[index(::baduk::Point(0, 24))] = 3190213069653924311LL;
-    white_codes_[index(::baduk::Point(1, 0))] = 440631574931794224LL;
-    white_codes_[index(::baduk::Point(1, 1))] = 6008846550771467769LL;
-    white_codes_[index(::baduk::Point(1, 2))] = 1345028143569130995LL;
-    white_codes_[index(::baduk::Point(1, 3))] = 6303039986042605631LL;
-    white_codes_[index(::baduk::Point(1, 4))] = 3314799002678422262LL;
-    white_codes_[index(::baduk::Point(1, 5))] = 709914572077090163LL;
-    white_codes_[index(::baduk::Point(1, 6))] = 7772465602052768149LL;
-    white_codes_[index(::baduk::Point(1, 7))] = 7075774604365727249LL;
-    white_codes_[index(::baduk::Point(1, 8))] = 8725076271681214529LL;
-    white_codes_[index(::baduk::Point(1, 9))] = 347226313345063677LL;
-    white_codes_[index(::baduk::Point(1, 10))] = 3444823277247884610LL;
-    white_codes_[index(::baduk::Point(1, 11))] = 3527127010776112953LL;
-    white_codes_[index(::baduk::Point(1, 12))] = 5385434888881879188LL;
-    white_codes_[index(::baduk::Point(1, 13))] = 4551435499644563007LL;
-    white_codes_[index(::baduk::Point(1, 14))] = 8912699303048767389LL;
-    white_codes_[index(::baduk::Point(1, 15))] = 5259411293139977002LL;
-    white_codes_[index(::baduk::Point(1, 16))] = 8276282861590316564LL;
-    white_codes_[index(::baduk::Point(1, 17))] = 489286856964946716LL;
-    white_codes_[index(::baduk::Point(1, 18))] = 3366204874487769734LL;
-    white_codes_[index(::baduk::Point(1, 19))] = 7025796136132845034LL;
-    white_codes_[index(::baduk::Point(1, 20))] = 797224276099006585LL;
-    white_codes_[index(::baduk::Point(1, 21))] = 8341855272043205711LL;
-    white_codes_[index(::baduk::Point(1, 22))] = 4015635647987669385LL;
-    white_codes_[index(::baduk::Point(1, 23))] = 2088142116374041730LL;
-    white_codes_[index(::baduk::Point(1, 24))] = 1100764769857503429LL;
-    white_codes_[index(::baduk::Point(2, 0))] = 1551441547216559296LL;
-    white_codes_[index(::baduk::Point(2, 1))] = 8925233557253881446LL;
-    white_codes_[index(::baduk::Point(2, 2))] = 3844446429890881258LL;
-    white_codes_[index(::baduk::Point(2, 3))] = 4591437929409194029LL;
-    white_codes_[index(::baduk::Point(2, 4))] = 8651868856813583889LL;
-    white_codes_[index(::baduk::Point(2, 5))] = 5942720742215582325LL;
-    white_codes_[index(::baduk::Point(2, 6))] = 8681254374693911550LL;
-    white_codes_[index(::baduk::Point(2, 7))] = 2617796566504997248LL;
-    white_codes_[index(::baduk::Point(2, 8))] = 305507286156875312LL;
-    white_codes_[index(::baduk::Point(2, 9))] = 6942452672741831193LL;
-    white_codes_[index(::baduk::Point(2, 10))] = 1314262912670009291LL;
-    white_codes_[index(::baduk::Point(2, 11))] = 2714256783155765988LL;
-    white_codes_[index(::baduk::Point(2, 12))] = 6740529998789910542LL;
-    white_codes_[index(::baduk::Point(2, 13))] = 7744776394194336431LL;
-    white_codes_[index(::baduk::Point(2, 14))] = 1170697673895112862LL;
-    white_codes_[index(::baduk::Point(2, 15))] = 6428290918139407794LL;
-    white_codes_[index(::baduk::Point(2, 16))] = 761570720751127748LL;
-    white_codes_[index(::baduk::Point(2, 17))] = 8074745001149414370LL;
-    white_codes_[index(::baduk::Point(2, 18))] = 2217766531685118656LL;
-    white_codes_[index(::baduk::Point(2, 19))] = 7747327048186219698LL;
-    white_codes_[index(::baduk::Point(2, 20))] = 5515863565750060371LL;
-    white_codes_[index(::baduk::Point(2, 21))] = 2548336583426988366LL;
-    white_codes_[index(::baduk::Point(2, 22))] = 681081821310797094LL;
-    white_codes_[index(::baduk::Point(2, 23))] = 6658331583016443812LL;
-    white_codes_[index(::baduk::Point(2, 24))] = 6885555124242546933LL;
-    white_codes_[index(::baduk::Point(3, 0))] = 779474499679755902LL;
-    white_codes_[index(::baduk::Point(3, 1))] = 1943387261313099832LL;
-    white_codes_[index(::baduk::Point(3, 2))] = 4755914927285896600LL;
-    white_codes_[index(::baduk::Point(3, 3))] = 3218914720988314375LL;
-    white_codes_[index(::baduk::Point(3, 4))] = 1894254448789018592LL;
-    white_codes_[index(::baduk::Point(3, 5))] = 8017918590813776616LL;
-    white_codes_[index(::baduk::Point(3, 6))] = 4589456448141104045LL;
-    white_codes_[index(::baduk::Point(3, 7))] = 5033791746336008245LL;
-    white_codes_[index(::baduk::Point(3, 8))] = 8946218361963936659LL;
-    white_codes_[index(::baduk::Point(3, 9))] = 9057951785767955545LL;
-    white_codes_[index(::baduk::Point(3, 10))] = 4998467953129807533LL;
-    white_codes_[index(::baduk::Point(3, 11))] = 3745236156218537712LL;
-    white_codes_[index(::baduk::Point(3, 12))] = 6543272713620358636LL;
-    white_codes_[index(::baduk::Point(3, 13))] = 9099571661209566251LL;
-    white_codes_[index(::baduk::Point(3, 14))] = 1725842901906966298LL;
-    white_codes_[index(::baduk::Point(3, 15))] = 5528028288326207616LL;
-    white_codes_[index(::baduk::Point(3, 16))] = 7798241954781585785LL;
-    white_codes_[index(::baduk::Point(3, 17))] = 5708189555909840540LL;
-    white_codes_[index(::baduk::Point(3, 18))] = 1416487259429417497LL;
-    white_codes_[index(::baduk::Point(3, 19))] = 5460523935904222089LL;
-    white_codes_[index(::baduk::Point(3, 20))] = 4390588731868943790LL;
-    white_codes_[index(::baduk::Point(3, 21))] = 1277932478274408467LL;
-    white_codes_[index(::baduk::Point(3, 22))] = 3204421772279474443LL;
-    white_codes_[index(::baduk::Point(3, 23))] = 7238542895702563236LL;
-    white_codes_[index(::baduk::Point(3, 24))] = 720763646139296536LL;
-    white_codes_[index(::baduk::Point(4, 0))] = 1865678382298705433LL;
-    white_codes_[index(::baduk::Point(4, 1))] = 3817025491924182399LL;
-    white_codes_[index(::baduk::Point(4, 2))] = 2118060844349898960LL;
-    white_codes_[index(::baduk::Point(4, 3))] = 6988807604887830042LL;
-    white_codes_[index(::baduk::Point(4, 4))] = 8810690252308994998LL;
-    white_codes_[index(::baduk::Point(4, 5))] = 588277719716719169LL;
-    white_codes_[index(::baduk::Point(4, 6))] = 2043345707761064679LL;
-    white_codes_[index(::baduk::Point(4, 7))] = 2439049200979956621LL;
-    white_codes_[index(::baduk::Point(4, 8))] = 9049343949232983307LL;
-    white_codes_[index(::baduk::Point(4, 9))] = 2586432473302092278LL;
-    white_codes_[index(::baduk::Point(4, 10))] = 7579159583582144555LL;
-    white_codes_[index(::baduk::Point(4, 11))] = 8470021755613588219LL;
-    white_codes_[index(::baduk::Point(4, 12))] = 5189193208702447072LL;
-    white_codes_[index(::baduk::Point(4, 13))] = 1853068358982096094LL;
-    white_codes_[index(::baduk::Point(4, 14))] = 1950406176880230801LL;
-    white_codes_[index(::baduk::Point(4, 15))] = 8068351386423771906LL;
-    white_codes_[index(::baduk::Point(4, 16))] = 2977698252544986611LL;
-    white_codes_[index(::baduk::Point(4, 17))] = 4553813464117660085LL;
-    white_codes_[index(::baduk::Point(4, 18))] = 3106150569777625659LL;
-    white_codes_[index(::baduk::Point(4, 19))] = 6466351546266878297LL;
-    white_codes_[index(::baduk::Point(4, 20))] = 8016954804635965309LL;
-    white_codes_[index(::baduk::Point(4, 21))] = 1120632173658234557LL;
-    white_codes_[index(::baduk::Point(4, 22))] = 1159713454088070194LL;
-    white_codes_[index(::baduk::Point(4, 23))] = 540298344733186775LL;
-    white_codes_[index(::baduk::Point(4, 24))] = 4703031425407427049LL;
-    white_codes_[index(::baduk::Point(5, 0))] = 4425596394849097372LL;
-    white_codes_[index(::baduk::Point(5, 1))] = 3499733307610708044LL;
-    white_codes_[index(::baduk::Point(5, 2))] = 987877961234745394LL;
-    white_codes_[index(::baduk::Point(5, 3))] = 1206235955868284684LL;
-    white_codes_[index(::baduk::Point(5, 4))] = 7901194126781568632LL;
-    white_codes_[index(::baduk::Point(5, 5))] = 5025816642004501556LL;
-    white_codes_[index(::baduk::Point(5, 6))] = 2849131949108134022LL;
-    white_codes_[index(::baduk::Point(5, 7))] = 9041981823210253172LL;
-    white_codes_[index(::baduk::Point(5, 8))] = 3114945071646744004LL;
-    white_codes_[index(::baduk::Point(5, 9))] = 2810332830104375799LL;
-    white_codes_[index(::baduk::Point(5, 10))] = 7740937683152081027LL;
-    white_codes_[index(::baduk::Point(5, 11))] = 1908385297411567449LL;
-    white_codes_[index(::baduk::Point(5, 12))] = 2008324232500409134LL;
-    white_codes_[index(::baduk::Point(5, 13))] = 3465126433602675677LL;
-    white_codes_[index(::baduk::Point(5, 14))] = 1815998469252229412LL;
-    white_codes_[index(::baduk::Point(5, 15))] = 1333332532333943535LL;
-    white_codes_[index(::baduk::Point(5, 16))] = 7466629026718019616LL;
-    white_codes_[index(::baduk::Point(5, 17))] = 2205725443503704309LL;
-    white_codes_[index(::baduk::Point(5, 18))] = 6054166815475380478LL;
-    white_codes_[index(::baduk::Point(5, 19))] = 3412603831720271339LL;
-    white_codes_[index(::baduk::Point(5, 20))] = 6767582120222441293LL;
-    white_codes_[index(::baduk::Point(5, 21))] = 6099912335551510208LL;
-    white_codes_[index(::baduk::Point(5, 22))] = 5730685849933401753LL;
-    white_codes_[index(::baduk::Point(5, 23))] = 2919138151131660020LL;
-    white_codes_[index(::baduk::Point(5, 24))] = 8910551855724125814LL;
-    white_codes_[index(::baduk::Point(6, 0))] = 2540069181958502671LL;
-    white_codes_[index(::baduk::Point(6, 1))] = 7419184451476540162LL;
-    white_codes_[index(::baduk::Point(6, 2))] = 7257182031009142145LL;
-    white_codes_[index(::baduk::Point(6, 3))] = 1041709854889813703LL;
-    white_codes_[index(::baduk::Point(6, 4))] = 6111776192750214182LL;
-    white_codes_[index(::baduk::Point(6, 5))] = 1315513283988955138LL;
-    white_codes_[index(::baduk::Point(6, 6))] = 4921633770617009664LL;
-    white_codes_[index(::baduk::Point(6, 7))] = 8816283715656576698LL;
-    white_codes_[index(::baduk::Point(6, 8))] = 1813683452043599855LL;
-    white_codes_[index(::baduk::Point(6, 9))] = 2430503964951170789LL;
-    white_codes_[index(::baduk::Point(6, 10))] = 2596204353662956898LL;
-    white_codes_[index(::baduk::Point(6, 11))] = 149334861189651240LL;
-    white_codes_[index(::baduk::Point(6, 12))] = 8069312413786912679LL;
-    white_codes_[index(::baduk::Point(6, 13))] = 3026470347786820992LL;
-    white_codes_[index(::baduk::Point(6, 14))] = 3369758419567311218LL;
-    white_codes_[index(::baduk::Point(6, 15))] = 1890746650424324064LL;
-    white_codes_[index(::baduk::Point(6, 16))] = 2600323672187305213LL;
-    white_codes_[index(::baduk::Point(6, 17))] = 8360515167089632498LL;
-    white_codes_[index(::baduk::Point(6, 18))] = 3366246620140321165LL;
-    white_codes_[index(::baduk::Point(6, 19))] = 8691043998761739686LL;
-    white_codes_[index(::baduk::Point(6, 20))] = 5304950910013633026LL;
-    white_codes_[index(::baduk::Point(6, 21))] = 3877387669834933684LL;
-    white_codes_[index(::baduk::Point(6, 22))] = 2717558479524425706LL;
-    white_codes_[index(::baduk::Point(6, 23))] = 4308264073857541694LL;
-    white_codes_[index(::baduk::Point(6, 24))] = 2900490852402678271LL;
-    white_codes_[index(::baduk::Point(7, 0))] = 7665762503134921443LL;
-    white_codes_[index(::baduk::Point(7, 1))] = 2970481382105623303LL;
-    white_codes_[index(::baduk::Point(7, 2))] = 7052502111877060493LL;
-    white_codes_[index(::baduk::Point(7, 3))] = 7013069376535647458LL;
-    white_codes_[index(::baduk::Point(7, 4))] = 6312985588117658725LL;
-    white_codes_[index(::baduk::Point(7, 5))] = 7048978521171246822LL;
-    white_codes_[index(::baduk::Point(7, 6))] = 4098086478288024281LL;
-    white_codes_[index(::baduk::Point(7, 7))] = 440498969217902422LL;
-    white_codes_[index(::baduk::Point(7, 8))] = 4141097965217763218LL;
-    white_codes_[index(::baduk::Point(7, 9))] = 3436340718154269895LL;
-    white_codes_[index(::baduk::Point(7, 10))] = 9153546138924733105LL;
-    white_codes_[index(::baduk::Point(7, 11))] = 7409088862364646063LL;
-    white_codes_[index(::baduk::Point(7, 12))] = 9189263275488548566LL;
-    white_codes_[index(::baduk::Point(7, 13))] = 5976255829638145224LL;
-    white_codes_[index(::baduk::Point(7, 14))] = 1589031062863019344LL;
-    white_codes_[index(::baduk::Point(7, 15))] = 8961052531277924725LL;
-    white_codes_[index(::baduk::Point(7, 16))] = 3563230632358644701LL;
-    white_codes_[index(::baduk::Point(7, 17))] = 4466789192681836248LL;
-    white_codes_[index(::baduk::Point(7, 18))] = 3804289607096996620LL;
-    white_codes_[index(::baduk::Point(7, 19))] = 3729702979206769766LL;
-    white_codes_[index(::baduk::Point(7, 20))] = 6913087295084902379LL;
-    white_codes_[index(::baduk::Point(7, 21))] = 1433362903486297026LL;
-    white_codes_[index(::baduk::Point(7, 22))] = 2105785035518118049LL;
-    white_codes_[index(::baduk::Point(7, 23))] = 7016801660112563765LL;
-    white_codes_[index(::baduk::Point(7, 24))] = 4156536936081249847LL;
-    white_codes_[index(::baduk::Point(8, 0))] = 1390066783663720907LL;
-    white_codes_[index(::baduk::Point(8, 1))] = 3119159607936518413LL;
-    white_codes_[index(::baduk::Point(8, 2))] = 1598940969587055186LL;
-    white_codes_[index(::baduk::Point(8, 3))] = 8986776415819950426LL;
-    white_codes_[index(::baduk::Point(8, 4))] = 3063307581077246801LL;
-    white_codes_[index(::baduk::Point(8, 5))] = 9081895912265345528LL;
-    white_codes_[index(::baduk::Point(8, 6))] = 3480500138984359308LL;
-    white_codes_[index(::baduk::Point(8, 7))] = 6392256918584727135LL;
-    white_codes_[index(::baduk::Point(8, 8))] = 8276197644853767184LL;
-    white_codes_[index(::baduk::Point(8, 9))] = 1342272151293574796LL;
-    white_codes_[index(::baduk::Point(8, 10))] = 3175249623947420794LL;
-    white_codes_[index(::baduk::Point(8, 11))] = 1914685391211771894LL;
-    white_codes_[index(::baduk::Point(8, 12))] = 5325654130419544556LL;
-    white_codes_[index(::baduk::Point(8, 13))] = 8081808792183164896LL;
-    white_codes_[index(::baduk::Point(8, 14))] = 4944822224111085851LL;
-    white_codes_[index(::baduk::Point(8, 15))] = 1934173252723920868LL;
-    white_codes_[index(::baduk::Point(8, 16))] = 6207092333168884767LL;
-    white_codes_[index(::baduk::Point(8, 17))] = 8841408683708384128LL;
-    white_codes_[index(::baduk::Point(8, 18))] = 7331159316808095590LL;
-    white_codes_[index(::baduk::Point(8, 19))] = 5044681490397079030LL;
-    white_codes_[index(::baduk::Point(8, 20))] = 2339401302351175139LL;
-    white_codes_[index(::baduk::Point(8, 21))] = 7666935972214108254LL;
-    white_codes_[index(::baduk::Point(8, 22))] = 612120189813485073LL;
-    white_codes_[index(::baduk::Point(8, 23))] = 5590622724634165235LL;
-    white_codes_[index(::baduk::Point(8, 24))] = 6687950990760571936LL;
-    white_codes_[index(::baduk::Point(9, 0))] = 1012873880569459194LL;
-    white_codes_[index(::baduk::Point(9, 1))] = 9134360745631618029LL;
-    white_codes_[index(::baduk::Point(9, 2))] = 6862868386385506984LL;
-    white_codes_[index(::baduk::Point(9, 3))] = 3465791407885152834LL;
-    white_codes_[index(::baduk::Point(9, 4))] = 270799597564074394LL;
-    white_codes_[index(::baduk::Point(9, 5))] = 4749578092457950284LL;
-    white_codes_[index(::baduk::Point(9, 6))] = 1439748147939287052LL;
-    white_codes_[index(::baduk::Point(9, 7))] = 2827078873379689637LL;
-    white_codes_[index(::baduk::Point(9, 8))] = 6377569755765653966LL;
-    white_codes_[index(::baduk::Point(9, 9))] = 7802625708643540559LL;
-    white_codes_[index(::baduk::Point(9, 10))] = 917593008538883153LL;
-    white_codes_[index(::baduk::Point(9, 11))] = 4842994336760413365LL;
-    white_codes_[index(::baduk::Point(9, 12))] = 2116950677346621388LL;
-    white_codes_[index(::baduk::Point(9, 13))] = 4517500516332299819LL;
-    white_codes_[index(::baduk::Point(9, 14))] = 2618945614801850556LL;
-    white_codes_[index(::baduk::Point(9, 15))] = 5632250536903307584LL;
-    white_codes_[index(::baduk::Point(9, 16))] = 3469200419288551806LL;
-    white_codes_[index(::baduk::Point(9, 17))] = 5757603450626071933LL;
-    white_codes_[index(::baduk::Point(9, 18))] = 6546704858839823537LL;
-    white_codes_[index(::baduk::Point(9, 19))] = 480273393814082302LL;
-    white_codes_[index(::baduk::Point(9, 20))] = 188942044852695978LL;
-    white_codes_[index(::baduk::Point(9, 21))] = 6824819043395301764LL;
-    white_codes_[index(::baduk::Point(9, 22))] = 6738437842059826932LL;
-    white_codes_[index(::baduk::Point(9, 23))] = 8498743097766169942LL;
-    white_codes_[index(::baduk::Point(9, 24))] = 2579736842740421105LL;
-    white_codes_[index(::baduk::Point(10, 0))] = 464839065962522236LL;
-    white_codes_[index(::baduk::Point(10, 1))] = 1451191563207560916LL;
-    white_codes_[index(::baduk::Point(10, 2))] = 6579929899834720470LL;
-    white_codes_[index(::baduk::Point(10, 3))] = 3363527528730652283LL;
-    white_codes_[index(::baduk::Point(10, 4))] = 4394989043973381071LL;
-    white_codes_[index(::baduk::Point(10, 5))] = 7738014739468172854LL;
-    white_codes_[index(::baduk::Point(10, 6))] = 2311433265090295337LL;
-    white_codes_[index(::baduk::Point(10, 7))] = 2993301633825223092LL;
-    white_codes_[index(::baduk::Point(10, 8))] = 3095289223476156758LL;
-    white_codes_[index(::baduk::Point(10, 9))] = 7472505073580431537LL;
-    white_codes_[index(::baduk::Point(10, 10))] = 9106876043242455604LL;
-    white_codes_[index(::baduk::Point(10, 11))] = 2768757681221762494LL;
-    white_codes_[index(::baduk::Point(10, 12))] = 3165840393711978830LL;
-    white_codes_[index(::baduk::Point(10, 13))] = 4368941632545365235LL;
-    white_codes_[index(::baduk::Point(10, 14))] = 6206017887775974LL;
-    white_codes_[index(::baduk::Point(10, 15))] = 5578620982514079139LL;
-    white_codes_[index(::baduk::Point(10, 16))] = 3861647208570836633LL;
-    white_codes_[index(::baduk::Point(10, 17))] = 1646868680191204679LL;
-    white_codes_[index(::baduk::Point(10, 18))] = 5239764125186087131LL;
-    white_codes_[index(::baduk::Point(10, 19))] = 7710297114752675514LL;
-    white_codes_[index(::baduk::Point(10, 20))] = 5611942862883011421LL;
-    white_codes_[index(::baduk::Point(10, 21))] = 3231649583653520215LL;
-    white_codes_[index(::baduk::Point(10, 22))] = 6120763770415589230LL;
-    white_codes_[index(::baduk::Point(10, 23))] = 480030862588527177LL;
-    white_codes_[index(::baduk::Point(10, 24))] = 6669157454432202586LL;
-    white_codes_[index(::baduk::Point(11, 0))] = 8913140953371262565LL;
-    white_codes_[index(::baduk::Point(11, 1))] = 2760387428527119017LL;
-    white_codes_[index(::baduk::Point(11, 2))] = 8551464585649053847LL;
-    white_codes_[index(::baduk::Point(11, 3))] = 2249592088298880418LL;
-    white_codes_[index(::baduk::Point(11, 4))] = 67639621170378486LL;
-    white_codes_[index(::baduk::Point(11, 5))] = 8351674861266048924LL;
-    white_codes_[index(::baduk::Point(11, 6))] = 6880444610479992658LL;
-    white_codes_[index(::baduk::Point(11, 7))] = 2112589144239599251LL;
-    white_codes_[index(::baduk::Point(11, 8))] = 8865006262389262353LL;
-    white_codes_[index(::baduk::Point(11, 9))] = 8331088031785691957LL;
-    white_codes_[index(::baduk::Point(11, 10))] = 1322730643075478762LL;
-    white_codes_[index(::baduk::Point(11, 11))] = 8826719832740091528LL;
-    white_codes_[index(::baduk::Point(11, 12))] = 4714316078594987958LL;
-    white_codes_[index(::baduk::Point(11, 13))] = 6800632360148391199LL;
-    white_codes_[index(::baduk::Point(11, 14))] = 8235823603804703816LL;
-    white_codes_[index(::baduk::Point(11, 15))] = 2112393618820546488LL;
-    white_codes_[index(::baduk::Point(11, 16))] = 500496637375618914LL;
-    white_codes_[index(::baduk::Point(11, 17))] = 1903817779872460619LL;
-    white_codes_[index(::baduk::Point(11, 18))] = 2094702536437359676LL;
-    white_codes_[index(::baduk::Point(11, 19))] = 8180245653106340209LL;
-    white_codes_[index(::baduk::Point(11, 20))] = 552708969426237615LL;
-    white_codes_[index(::baduk::Point(11, 21))] = 8911388401037158456LL;
-    white_codes_[index(::baduk::Point(11, 22))] = 6144155420135266596LL;
-    white_codes_[index(::baduk::Point(11, 23))] = 9094341765689829230LL;
-    white_codes_[index(::baduk::Point(11, 24))] = 8849420266574013669LL;
-    white_codes_[index(::baduk::Point(12, 0))] = 8829620995044198373LL;
-    white_codes_[index(::baduk::Point(12, 1))] = 9092573490469749450LL;
-    white_codes_[index(::baduk::Point(12, 2))] = 1830770301702815869LL;
-    white_codes_[index(::baduk::Point(12, 3))] = 7738540524281293660LL;
-    white_codes_[index(::baduk::Point(12, 4))] = 3092535536184894621LL;
-    white_codes_[index(::baduk::Point(12, 5))] = 4601610598713297675LL;
-    white_codes_[index(::baduk::Point(12, 6))] = 3092950140215217465LL;
-    white_codes_[index(::baduk::Point(12, 7))] = 6943114570360555140LL;
-    white_codes_[index(::baduk::Point(12, 8))] = 18121739652205859LL;
-    white_codes_[index(::baduk::Point(12, 9))] = 5776092070445311684LL;
-    white_codes_[index(::baduk::Point(12, 10))] = 3288336937362531033LL;
-    white_codes_[index(::baduk::Point(12, 11))] = 3506030430237688123LL;
-    white_codes_[index(::baduk::Point(12, 12))] = 4222659670401396865LL;
-    white_codes_[index(::baduk::Point(12, 13))] = 7328589908135578961LL;
-    white_codes_[index(::baduk::Point(12, 14))] = 8213274644481211978LL;
-    white_codes_[index(::baduk::Point(12, 15))] = 3653079239649683835LL;
-    white_codes_[index(::baduk::Point(12, 16))] = 1547083912073197046LL;
-    white_codes_[index(::baduk::Point(12, 17))] = 3021194967179844408LL;
-    white_codes_[index(::baduk::Point(12, 18))] = 2698504684269586484LL;
-    white_codes_[index(::baduk::Point(12, 19))] = 3673017893459670318LL;
-    white_codes_[index(::baduk::Point(12, 20))] = 3994532142988195339LL;
-    white_codes_[index(::baduk::Point(12, 21))] = 5207945477360160387LL;
-    white_codes_[index(::baduk::Point(12, 22))] = 5715413133940368456LL;
-    white_codes_[index(::baduk::Point(12, 23))] = 7452598454173761792LL;
-    white_codes_[index(::baduk::Point(12, 24))] = 6009376370973517855LL;
-    white_codes_[index(::baduk::Point(13, 0))] = 368360272473017973LL;
-    white_codes_[index(::baduk::Point(13, 1))] = 6392045818391448096LL;
-    white_codes_[index(::baduk::Point(13, 2))] = 7952384921656164307LL;
-    white_codes_[index(::baduk::Point(13, 3))] = 814953967366581997LL;
-    white_codes_[index(::baduk::Point(13, 4))] = 6975546424521598720LL;
-    white_codes_[index(::baduk::Point(13, 5))] = 508721143645978666LL;
-    white_codes_[index(::baduk::Point(13, 6))] = 8063185970812202482LL;
-    white_codes_[index(::baduk::Point(13, 7))] = 1415613785781796434LL;
-    white_codes_[index(::baduk::Point(13, 8))] = 7387855186939542817LL;
-    white_codes_[index(::baduk::Point(13, 9))] = 8500597338290918394LL;
-    white_codes_[index(::baduk::Point(13, 10))] = 2034424728396582927LL;
-    white_codes_[index(::baduk::Point(13, 11))] = 7859992793810275057LL;
-    white_codes_[index(::baduk::Point(13, 12))] = 4711905173893098553LL;
-    white_codes_[index(::baduk::Point(13, 13))] = 1566734406742850733LL;
-    white_codes_[index(::baduk::Point(13, 14))] = 3111792031210119271LL;
-    white_codes_[index(::baduk::Point(13, 15))] = 4761323370131606599LL;
-    white_codes_[index(::baduk::Point(13, 16))] = 3801204990140417120LL;
-    white_codes_[index(::baduk::Point(13, 17))] = 7620297116394618546LL;
-    white_codes_[index(::baduk::Point(13, 18))] = 532106902853021298LL;
-    white_codes_[index(::baduk::Point(13, 19))] = 7215614765458095567LL;
-    white_codes_[index(::baduk::Point(13, 20))] = 4516194756867011764LL;
-    white_codes_[index(::baduk::Point(13, 21))] = 606697099154428328LL;
-    white_codes_[index(::baduk::Point(13, 22))] = 8498709424833127180LL;
-    white_codes_[index(::baduk::Point(13, 23))] = 2048467992535175192LL;
-    white_codes_[index(::baduk::Point(13, 24))] = 9199800596054186530LL;
-    white_codes_[index(::baduk::Point(14, 0))] = 343151420636506517LL;
-    white_codes_[index(::baduk::Point(14, 1))] = 7436880154497769071LL;
-    white_codes_[index(::baduk::Point(14, 2))] = 3490849187142501579LL;
-    white_codes_[index(::baduk::Point(14, 3))] = 3146226261685672125LL;
-    white_codes_[index(::baduk::Point(14, 4))] = 6359753067589068152LL;
-    white_codes_[index(::baduk::Point(14, 5))] = 6707818008401251656LL;
-    white_codes_[index(::baduk::Point(14, 6))] = 291883374454031201LL;
-    white_codes_[index(::baduk::Point(14, 7))] = 6659339764516563734LL;
-    white_codes_[index(::baduk::Point(14, 8))] = 4337872097355881024LL;
-    white_codes_[index(::baduk::Point(14, 9))] = 2142777607565585939LL;
-    white_codes_[index(::baduk::Point(14, 10))] = 7227561489334569953LL;
-    white_codes_[index(::baduk::Point(14, 11))] = 3266200683347812807LL;
-    white_codes_[index(::baduk::Point(14, 12))] = 6227493661232796732LL;
-    white_codes_[index(::baduk::Point(14, 13))] = 3062138209301532740LL;
-    white_codes_[index(::baduk::Point(14, 14))] = 3612322229401478739LL;
-    white_codes_[index(::baduk::Point(14, 15))] = 6850468635532222796LL;
-    white_codes_[index(::baduk::Point(14, 16))] = 1795097904763571003LL;
-    white_codes_[index(::baduk::Point(14, 17))] = 4729969557718692492LL;
-    white_codes_[index(::baduk::Point(14, 18))] = 7877656501458119527LL;
-    white_codes_[index(::baduk::Point(14, 19))] = 7998702345622538607LL;
-    white_codes_[index(::baduk::Point(14, 20))] = 7494374624194033141LL;
-    white_codes_[index(::baduk::Point(14, 21))] = 15459259520127300LL;
-    white_codes_[index(::baduk::Point(14, 22))] = 1383906498132162949LL;
-    white_codes_[index(::baduk::Point(14, 23))] = 2131925053333584346LL;
-    white_codes_[index(::baduk::Point(14, 24))] = 4471117538706827895LL;
-    white_codes_[index(::baduk::Point(15, 0))] = 7500752145396836932LL;
-    white_codes_[index(::baduk::Point(15, 1))] = 5992574438679438345LL;
-    white_codes_[index(::baduk::Point(15, 2))] = 1006928625035753198LL;
-    white_codes_[index(::baduk::Point(15, 3))] = 7602244088903589435LL;
-    white_codes_[index(::baduk::Point(15, 4))] = 1899786462917516810LL;
-    white_codes_[index(::baduk::Point(15, 5))] = 819875622410559257LL;
-    white_codes_[index(::baduk::Point(15, 6))] = 7357278503595694753LL;
-    white_codes_[index(::baduk::Point(15, 7))] = 9060082027414981878LL;
-    white_codes_[index(::baduk::Point(15, 8))] = 5184880058180660582LL;
-    white_codes_[index(::baduk::Point(15, 9))] = 4922517959218852624LL;
-    white_codes_[index(::baduk::Point(15, 10))] = 3008079426400527754LL;
-    white_codes_[index(::baduk::Point(15, 11))] = 6616876484142185872LL;
-    white_codes_[index(::baduk::Point(15, 12))] = 2067145108069847228LL;
-    white_codes_[index(::baduk::Point(15, 13))] = 2646184819742439451LL;
-    white_codes_[index(::baduk::Point(15, 14))] = 4845543458481644929LL;
-    white_codes_[index(::baduk::Point(15, 15))] = 7022675167430883222LL;
-    white_codes_[index(::baduk::Point(15, 16))] = 8523934732225396828LL;
-    white_codes_[index(::baduk::Point(15, 17))] = 7969493251430013056LL;
-    white_codes_[index(::baduk::Point(15, 18))] = 7111940793793673367LL;
-    white_codes_[index(::baduk::Point(15, 19))] = 3045283891524683816LL;
-    white_codes_[index(::baduk::Point(15, 20))] = 7507833898349185391LL;
-    white_codes_[index(::baduk::Point(15, 21))] = 6277466546934620769LL;
-    white_codes_[index(::baduk::Point(15, 22))] = 2591543901198949818LL;
-    white_codes_[index(::baduk::Point(15, 23))] = 1639172774727017595LL;
-    white_codes_[index(::baduk::Point(15, 24))] = 6750466118014678872LL;
-    white_codes_[index(::baduk::Point(16, 0))] = 2939870231702721275LL;
-    white_codes_[index(::baduk::Point(16, 1))] = 8706202916748577888LL;
-    white_codes_[index(::baduk::Point(16, 2))] = 2963812807017570765LL;
-    white_codes_[index(::baduk::Point(16, 3))] = 2336008800973214891LL;
-    white_codes_[index(::baduk::Point(16, 4))] = 367479541327995911LL;
-    white_codes_[index(::baduk::Point(16, 5))] = 9028980640072641357LL;
-    white_codes_[index(::baduk::Point(16, 6))] = 8766994725771737367LL;
-    white_codes_[index(::baduk::Point(16, 7))] = 6700596002384400046LL;
-    white_codes_[index(::baduk::Point(16, 8))] = 8827038632373230439LL;
-    white_codes_[index(::baduk::Point(16, 9))] = 7246710409583403466LL;
-    white_codes_[index(::baduk::Point(16, 10))] = 7645039743777965002LL;
-    white_codes_[index(::baduk::Point(16, 11))] = 5217296561940019214LL;
-    white_codes_[index(::baduk::Point(16, 12))] = 2753564212823090200LL;
-    white_codes_[index(::baduk::Point(16, 13))] = 4473221471592551716LL;
-    white_codes_[index(::baduk::Point(16, 14))] = 1128155612394229060LL;
-    white_codes_[index(::baduk::Point(16, 15))] = 9136028785385405286LL;
-    white_codes_[index(::baduk::Point(16, 16))] = 6221857746246483926LL;
-    white_codes_[index(::baduk::Point(16, 17))] = 4723289852712223552LL;
-    white_codes_[index(::baduk::Point(16, 18))] = 935724313573399718LL;
-    white_codes_[index(::baduk::Point(16, 19))] = 4085358902987086747LL;
-    white_codes_[index(::baduk::Point(16, 20))] = 8391390766373961466LL;
-    white_codes_[index(::baduk::Point(16, 21))] = 2112961153295224184LL;
-    white_codes_[index(::baduk::Point(16, 22))] = 1128261792553539607LL;
-    white_codes_[index(::baduk::Point(16, 23))] = 5392918703822796369LL;
-    white_codes_[index(::baduk::Point(16, 24))] = 7514408772659920363LL;
-    white_codes_[index(::baduk::Point(17, 0))] = 1849958741339163208LL;
-    white_codes_[index(::baduk::Point(17, 1))] = 4615015018128265612LL;
-    white_codes_[index(::baduk::Point(17, 2))] = 3085624591376066972LL;
-    white_codes_[index(::baduk::Point(17, 3))] = 1868075188892038827LL;
-    white_codes_[index(::baduk::Point(17, 4))] = 8530110189399872558LL;
-    white_codes_[index(::baduk::Point(17, 5))] = 7783476023026305674LL;
-    white_codes_[index(::baduk::Point(17, 6))] = 4698810945018575868LL;
-    white_codes_[index(::baduk::Point(17, 7))] = 1640025130808140388LL;
-    white_codes_[index(::baduk::Point(17, 8))] = 9088522158091578298LL;
-    white_codes_[index(::baduk::Point(17, 9))] = 5552826563275682310LL;
-    white_codes_[index(::baduk::Point(17, 10))] = 6503461099232487981LL;
-    white_codes_[index(::baduk::Point(17, 11))] = 6561792984815328606LL;
-    white_codes_[index(::baduk::Point(17, 12))] = 4843421748173505985LL;
-    white_codes_[index(::baduk::Point(17, 13))] = 4094057473648241077LL;
-    white_codes_[index(::baduk::Point(17, 14))] = 6378379435053771646LL;
-    white_codes_[index(::baduk::Point(17, 15))] = 1382652052835537496LL;
-    white_codes_[index(::baduk::Point(17, 16))] = 7365647179305080289LL;
-    white_codes_[index(::baduk::Point(17, 17))] = 6365791726019061819LL;
-    white_codes_[index(::baduk::Point(17, 18))] = 7415828953124912770LL;
-    white_codes_[index(::baduk::Point(17, 19))] = 8751335168352607141LL;
-    white_codes_[index(::baduk::Point(17, 20))] = 8384372196689589313LL;
-    white_codes_[index(::baduk::Point(17, 21))] = 4510171170057011860LL;
-    white_codes_[index(::baduk::Point(17, 22))] = 1713540824226993864LL;
-    white_codes_[index(::baduk::Point(17, 23))] = 6867418745787070098LL;
-    white_codes_[index(::baduk::Point(17, 24))] = 2197062226823150698LL;
-    white_codes_[index(::baduk::Point(18, 0))] = 6089783447265138471LL;
-    white_codes_[index(::baduk::Point(18, 1))] = 6235311757317509378LL;
-    white_codes_[index(::baduk::Point(18, 2))] = 27113185659826765LL;
-    white_codes_[index(::baduk::Point(18, 3))] = 8459677587614279999LL;
-    white_codes_[index(::baduk::Point(18, 4))] = 3764399881344052718LL;
-    white_codes_[index(::baduk::Point(18, 5))] = 3027844326193596327LL;
-    white_codes_[index(::baduk::Point(18, 6))] = 5702823416937558458LL;
-    white_codes_[index(::baduk::Point(18, 7))] = 103339993834596354LL;
-    white_codes_[index(::baduk::Point(18, 8))] = 86581272248325686LL;
-    white_codes_[index(::baduk::Point(18, 9))] = 6844453357822103505LL;
-    white_codes_[index(::baduk::Point(18, 10))] = 2711537413632052685LL;
-    white_codes_[index(::baduk::Point(18, 11))] = 3561896576746844804LL;
-    white_codes_[index(::baduk::Point(18, 12))] = 2719700829137844029LL;
-    white_codes_[index(::baduk::Point(18, 13))] = 2064078247670413964LL;
-    white_codes_[index(::baduk::Point(18, 14))] = 7708886286794952668LL;
-    white_codes_[index(::baduk::Point(18, 15))] = 5205176080599035349LL;
-    white_codes_[index(::baduk::Point(18, 16))] = 8153077119942065412LL;
-    white_codes_[index(::baduk::Point(18, 17))] = 4176976627234077224LL;
-    white_codes_[index(::baduk::Point(18, 18))] = 3577506557455841347LL;
-    white_codes_[index(::baduk::Point(18, 19))] = 7658541571619032620LL;
-    white_codes_[index(::baduk::Point(18, 20))] = 1083957723443154701LL;
-    white_codes_[index(::baduk::Point(18, 21))] = 8349101932606962954LL;
-    white_codes_[index(::baduk::Point(18, 22))] = 1460333966348638355LL;
-    white_codes_[index(::baduk::Point(18, 23))] = 1745593166056736198LL;
-    white_codes_[index(::baduk::Point(18, 24))] = 3818562082547826433LL;
-    white_codes_[index(::baduk::Point(19, 0))] = 2706544884062130081LL;
-    white_codes_[index(::baduk::Point(19, 1))] = 3419924757862641243LL;
-    white_codes_[index(::baduk::Point(19, 2))] = 7575410953789382830LL;
-    white_codes_[index(::baduk::Point(19, 3))] = 7699023524818586778LL;
-    white_codes_[index(::baduk::Point(19, 4))] = 1634976245332164834LL;
-    white_codes_[index(::baduk::Point(19, 5))] = 6654207756640056857LL;
-    white_codes_[index(::baduk::Point(19, 6))] = 7374898757503972936LL;
-    white_codes_[index(::baduk::Point(19, 7))] = 2091445576213544954LL;
-    white_codes_[index(::baduk::Point(19, 8))] = 3785821242662972468LL;
-    white_codes_[index(::baduk::Point(19, 9))] = 4007242748224553748LL;
-    white_codes_[index(::baduk::Point(19, 10))] = 2216493691148233698LL;
-    white_codes_[index(::baduk::Point(19, 11))] = 6901264392216769440LL;
-    white_codes_[index(::baduk::Point(19, 12))] = 6527289276897243267LL;
-    white_codes_[index(::baduk::Point(19, 13))] = 5487373226360765253LL;
-    white_codes_[index(::baduk::Point(19, 14))] = 4896597301144756481LL;
-    white_codes_[index(::baduk::Point(19, 15))] = 6014957397809886250LL;
-    white_codes_[index(::baduk::Point(19, 16))] = 4556030987526467167LL;
-    white_codes_[index(::baduk::Point(19, 17))] = 7779193674871877872LL;
-    white_codes_[index(::baduk::Point(19, 18))] = 3329351172073801866LL;
-    white_codes_[index(::baduk::Point(19, 19))] = 2430302734747447846LL;
-    white_codes_[index(::baduk::Point(19, 20))] = 2968656820519143219LL;
-    white_codes_[index(::baduk::Point(19, 21))] = 448406520692684855LL;
-    white_codes_[index(::baduk::Point(19, 22))] = 8400515407526955150LL;
-    white_codes_[index(::baduk::Point(19, 23))] = 4061726710280049443LL;
-    white_codes_[index(::baduk::Point(19, 24))] = 3203664393957704064LL;
-    white_codes_[index(::baduk::Point(20, 0))] = 2006021995430613135LL;
-    white_codes_[index(::baduk::Point(20, 1))] = 5620659097754453486LL;
-    white_codes_[index(::baduk::Point(20, 2))] = 5308964057255030183LL;
-    white_codes_[index(::baduk::Point(20, 3))] = 7590453326219316706LL;
-    white_codes_[index(::baduk::Point(20, 4))] = 415301897862733375LL;
-    white_codes_[index(::baduk::Point(20, 5))] = 5384376228398723214LL;
-    white_codes_[index(::baduk::Point(20, 6))] = 4308364963621507744LL;
-    white_codes_[index(::baduk::Point(20, 7))] = 2402010267740464226LL;
-    white_codes_[index(::baduk::Point(20, 8))] = 5708503958770827612LL;
-    white_codes_[index(::baduk::Point(20, 9))] = 7589229730590697847LL;
-    white_codes_[index(::baduk::Point(20, 10))] = 3764792355187053783LL;
-    white_codes_[index(::baduk::Point(20, 11))] = 4560034177872447611LL;
-    white_codes_[index(::baduk::Point(20, 12))] = 6910058844891165289LL;
-    white_codes_[index(::baduk::Point(20, 13))] = 5462867161236068526LL;
-    white_codes_[index(::baduk::Point(20, 14))] = 7725271824200406343LL;
-    white_codes_[index(::baduk::Point(20, 15))] = 7038777170954470372LL;
-    white_codes_[index(::baduk::Point(20, 16))] = 8692481977055204934LL;
-    white_codes_[index(::baduk::Point(20, 17))] = 5505734893354808022LL;
-    white_codes_[index(::baduk::Point(20, 18))] = 1118764933168106271LL;
-    white_codes_[index(::baduk::Point(20, 19))] = 3408197675911958539LL;
-    white_codes_[index(::baduk::Point(20, 20))] = 1473036731123083757LL;
-    white_codes_[index(::baduk::Point(20, 21))] = 4560219586433946185LL;
-    white_codes_[index(::baduk::Point(20, 22))] = 3387249013271294032LL;
-    white_codes_[index(::baduk::Point(20, 23))] = 3568638123063163104LL;
-    white_codes_[index(::baduk::Point(20, 24))] = 8200124060992686600LL;
-    white_codes_[index(::baduk::Point(21, 0))] = 6780506732094306102LL;
-    white_codes_[index(::baduk::Point(21, 1))] = 5497925529570093164LL;
-    white_codes_[index(::baduk::Point(21, 2))] = 5782085401979125694LL;
-    white_codes_[index(::baduk::Point(21, 3))] = 7169057876185057634LL;
-    white_codes_[index(::baduk::Point(21, 4))] = 3847754614505176073LL;
-    white_codes_[index(::baduk::Point(21, 5))] = 9131313679344886349LL;
-    white_codes_[index(::baduk::Point(21, 6))] = 1616517404650111858LL;
-    white_codes_[index(::baduk::Point(21, 7))] = 6246142817927305812LL;
-    white_codes_[index(::baduk::Point(21, 8))] = 6555499785290068885LL;
-    white_codes_[index(::baduk::Point(21, 9))] = 3071114751607904827LL;
-    white_codes_[index(::baduk::Point(21, 10))] = 2014667046231130700LL;
-    white_codes_[index(::baduk::Point(21, 11))] = 333007498845242922LL;
-    white_codes_[index(::baduk::Point(21, 12))] = 15608727926112556LL;
-    white_codes_[index(::baduk::Point(21, 13))] = 1996591725616878855LL;
-    white_codes_[index(::baduk::Point(21, 14))] = 6160466624295836765LL;
-    white_codes_[index(::baduk::Point(21, 15))] = 1397157092418732561LL;
-    white_codes_[index(::baduk::Point(21, 16))] = 7959106044476388428LL;
-    white_codes_[index(::baduk::Point(21, 17))] = 7533394466278461213LL;
-    white_codes_[index(::baduk::Point(21, 18))] = 3397339237514876574LL;
-    white_codes_[index(::baduk::Point(21, 19))] = 6828883310675981265LL;
-    white_codes_[index(::baduk::Point(21, 20))] = 1694524027299880166LL;
-    white_codes_[index(::baduk::Point(21, 21))] = 3952408171542435132LL;
-    white_codes_[index(::baduk::Point(21, 22))] = 8582661696797484843LL;
-    white_codes_[index(::baduk::Point(21, 23))] = 6676523971004201490LL;
-    white_codes_[index(::baduk::Point(21, 24))] = 3578563505617034471LL;
-    white_codes_[index(::baduk::Point(22, 0))] = 693781795539180832LL;
-    white_codes_[index(::baduk::Point(22, 1))] = 6866389243902266307LL;
-    white_codes_[index(::baduk::Point(22, 2))] = 8617371587998188584LL;
-    white_codes_[index(::baduk::Point(22, 3))] = 4950581229780442229LL;
-    white_codes_[index(::baduk::Point(22, 4))] = 65203463501202691LL;
-    white_codes_[index(::baduk::Point(22, 5))] = 1323203400899298915LL;
-    white_codes_[index(::baduk::Point(22, 6))] = 5321828125247973352LL;
-    white_codes_[index(::baduk::Point(22, 7))] = 8537474663283166803LL;
-    white_codes_[index(::baduk::Point(22, 8))] = 52967335290644994LL;
-    white_codes_[index(::baduk::Point(22, 9))] = 8522409193000097092LL;
-    white_codes_[index(::baduk::Point(22, 10))] = 5792501874421370157LL;
-    white_codes_[index(::baduk::Point(22, 11))] = 1254986175347883560LL;
-    white_codes_[index(::baduk::Point(22, 12))] = 1569002878232213833LL;
-    white_codes_[index(::baduk::Point(22, 13))] = 8537450153942198528LL;
-    white_codes_[index(::baduk::Point(22, 14))] = 2914380195823897311LL;
-    white_codes_[index(::baduk::Point(22, 15))] = 432720097527943389LL;
-    white_codes_[index(::baduk::Point(22, 16))] = 5885494533660778421LL;
-    white_codes_[index(::baduk::Point(22, 17))] = 4548782867343309057LL;
-    white_codes_[index(::baduk::Point(22, 18))] = 3683853395545840046LL;
-    white_codes_[index(::baduk::Point(22, 19))] = 5198298170129856724LL;
-    white_codes_[index(::baduk::Point(22, 20))] = 4535936361908956892LL;
-    white_codes_[index(::baduk::Point(22, 21))] = 8817849195113140740LL;
-    white_codes_[index(::baduk::Point(22, 22))] = 2578770012289117540LL;
-    white_codes_[index(::baduk::Point(22, 23))] = 201349571592117838LL;
-    white_codes_[index(::baduk::Point(22, 24))] = 6744401417496202658LL;
-    white_codes_[index(::baduk::Point(23, 0))] = 2988823146715109221LL;
-    white_codes_[index(::baduk::Point(23, 1))] = 8664274081067831985LL;
-    white_codes_[index(::baduk::Point(23, 2))] = 9180208255634418440LL;
-    white_codes_[index(::baduk::Point(23, 3))] = 8141595236355806263LL;
-    white_codes_[index(::baduk::Point(23, 4))] = 2547434903128358961LL;
-    white_codes_[index(::baduk::Point(23, 5))] = 9131084368791406834LL;
-    white_codes_[index(::baduk::Point(23, 6))] = 1951802611596554498LL;
-    white_codes_[index(::baduk::Point(23, 7))] = 6779464825737648817LL;
-    white_codes_[index(::baduk::Point(23, 8))] = 3022028285257025021LL;
-    white_codes_[index(::baduk::Point(23, 9))] = 5464836338202741050LL;
-    white_codes_[index(::baduk::Point(23, 10))] = 3681914514422718525LL;
-    white_codes_[index(::baduk::Point(23, 11))] = 564593036072274889LL;
-    white_codes_[index(::baduk::Point(23, 12))] = 2429012970467456738LL;
-    white_codes_[index(::baduk::Point(23, 13))] = 3341440477994128410LL;
-    white_codes_[index(::baduk::Point(23, 14))] = 7876839380687889826LL;
-    white_codes_[index(::baduk::Point(23, 15))] = 3510125150758134574LL;
-    white_codes_[index(::baduk::Point(23, 16))] = 1973516907180378670LL;
-    white_codes_[index(::baduk::Point(23, 17))] = 3806761503419456041LL;
-    white_codes_[index(::baduk::Point(23, 18))] = 6469771774225459235LL;
-    white_codes_[index(::baduk::Point(23, 19))] = 2828074722627555668LL;
-    white_codes_[index(::baduk::Point(23, 20))] = 7993129318053654935LL;
-    white_codes_[index(::baduk::Point(23, 21))] = 1676193627085179410LL;
-    white_codes_[index(::baduk::Point(23, 22))] = 8867929468762713944LL;
-    white_codes_[index(::baduk::Point(23, 23))] = 7387570690508323160LL;
-    white_codes_[index(::baduk::Point(23, 24))] = 6937327992252813903LL;
-    white_codes_[index(::baduk::Point(24, 0))] = 6479525974208027494LL;
-    white_codes_[index(::baduk::Point(24, 1))] = 8121603542049179986LL;
-    white_codes_[index(::baduk::Point(24, 2))] = 7230568438995265487LL;
-    white_codes_[index(::baduk::Point(24, 3))] = 5923918616493234144LL;
-    white_codes_[index(::baduk::Point(24, 4))] = 4538143808099806671LL;
-    white_codes_[index(::baduk::Point(24, 5))] = 5372895464825083262LL;
-    white_codes_[index(::baduk::Point(24, 6))] = 1067532190710195673LL;
-    white_codes_[index(::baduk::Point(24, 7))] = 6662813202710011201LL;
-    white_codes_[index(::baduk::Point(24, 8))] = 1833316026125211838LL;
-    white_codes_[index(::baduk::Point(24, 9))] = 4334618014999321233LL;
-    white_codes_[index(::baduk::Point(24, 10))] = 6941597908702183181LL;
-    white_codes_[index(::baduk::Point(24, 11))] = 8364581379592171512LL;
-    white_codes_[index(::baduk::Point(24, 12))] = 8607691202491369358LL;
-    white_codes_[index(::baduk::Point(24, 13))] = 3840542875290068385LL;
-    white_codes_[index(::baduk::Point(24, 14))] = 6571924857797951611LL;
-    white_codes_[index(::baduk::Point(24, 15))] = 3917343614626295237LL;
-    white_codes_[index(::baduk::Point(24, 16))] = 4820700301797446926LL;
-    white_codes_[index(::baduk::Point(24, 17))] = 731713164565928756LL;
-    white_codes_[index(::baduk::Point(24, 18))] = 2382994316744620978LL;
-    white_codes_[index(::baduk::Point(24, 19))] = 6161165266061100291LL;
-    white_codes_[index(::baduk::Point(24, 20))] = 8813980604098431503LL;
-    white_codes_[index(::baduk::Point(24, 21))] = 2545268270598638948LL;
-    white_codes_[index(::baduk::Point(24, 22))] = 7708138658298258265LL;
-    white_codes_[index(::baduk::Point(24, 23))] = 5856920386333301453LL;
-    white_codes_[index(::baduk::Point(24, 24))] = 1885978606782072921LL;
-    empty_board_ = 1539006079307850324LL;
-}
-
-}
-}
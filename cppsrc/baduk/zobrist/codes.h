@@ -0,0 +1,1296 @@
+// Generated by generate_zobrist_cpp.py; do not edit.
+#ifndef incl_BADUK_ZOBRIST_CODES_H__
+#define incl_BADUK_ZOBRIST_CODES_H__
+
+#include <array>
+
+namespace baduk {
+namespace zobrist {
+
+// One code per point, indexed by 25 * row + col.
+using CodeTable = std::array<unsigned long long, 625>;
+
+// Indexed by [stone][point].
+inline constexpr std::array<CodeTable, 2> STONE_CODES = {{
+    {{
+        4801006839845007102ULL, 8729333300053970668ULL, 7291446025369429485ULL,
+        2064159871141917690ULL, 4815314694197402709ULL, 368288133150249442ULL,
+        6450858749229900473ULL, 9166279396475002614ULL, 3486773895677199154ULL,
+        4991634597603546469ULL, 8513485244075931413ULL, 6261708319162450992ULL,
+        7871879667692656592ULL, 7253378017523154011ULL, 8317453906480284647ULL,
+        657141029303911258ULL, 5258506664693386712ULL, 2129567688385901408ULL,
+        3807345982298434593ULL, 1157481502684108550ULL, 4439104979861914134ULL,
+        6890533118118296489ULL, 1132913825948109121ULL, 8339636894986536111ULL,
+        5053616333110678800ULL, 6049327618754585925ULL, 1582898811434812687ULL,
+        4547756197799141486ULL, 351577665643402522ULL, 4691495827820483378ULL,
+        7603617927332601652ULL, 6510908438089344617ULL, 6603736219691119161ULL,
+        9014380994531522460ULL, 8989744329833919323ULL, 3562646889652594913ULL,
+        142525165614994060ULL, 2544059874099184342ULL, 1686034125711312679ULL,
+        4278571880584203028ULL, 4585143090228544450ULL, 7160466324112611064ULL,
+        7197775241243735642ULL, 3142229449024762262ULL, 8046370285609011583ULL,
+        8283034336791963223ULL, 6593539476275765435ULL, 4234415624830341859ULL,
+        281624121691332075ULL, 1393674647031500887ULL, 904928876511191719ULL,
+        1453902140363654836ULL, 2846217927370861181ULL, 6771619367031817272ULL,
+        4925560335021961787ULL, 2120802941561138821ULL, 3626155749846415428ULL,
+        5229912467671050686ULL, 5863073002752511398ULL, 5628231190687511447ULL,
+        5910127654661789808ULL, 3287481736492250600ULL, 3449156277025433917ULL,
+        4310241861503341884ULL, 331223527372681487ULL, 507501796283512434ULL,
+        4126746766603787743ULL, 4388664824128440157ULL, 4451344372808359419ULL,
+        8122101877261638830ULL, 3991689078855994139ULL, 1261271447826848278ULL,
+        4388476657925624525ULL, 12842047366742900ULL, 2186872249034807172ULL,
+        6096141353127632ULL, 5392226940404757338ULL, 4765794555636302253ULL,
+        6152684708417218188ULL, 1848588290024147261ULL, 5316604763177985671ULL,
+        8548755960539763253ULL, 3589827809240604066ULL, 488468001801167057ULL,
+        1076733132816502628ULL, 9030428389877598749ULL, 6439126968824901161ULL,
+        3321207564019468261ULL, 1610230856486919718ULL, 1673010555612300474ULL,
+        145921119495295025ULL, 603920886092761868ULL, 7081167444006893346ULL,
+        3050761848312772020ULL, 4542118678761443854ULL, 612582372693359236ULL,
+        8446089062226007398ULL, 1998755220700251772ULL, 3030278058872973683ULL,
+        8650488039617839093ULL, 8850483036900319567ULL, 811712884879947401ULL,
+        2306048045846231170ULL, 411952219051262610ULL, 2410286211423845320ULL,
+        8867844445550164118ULL, 8092535821596640837ULL, 5368065757427387498ULL,
+        211821917146082185ULL, 1517979601622473374ULL, 7696506068507069506ULL,
+        3634420930834620215ULL, 604461375435895862ULL, 1695848575327542425ULL,
+        7524046766992390252ULL, 6860076596836793301ULL, 2161613270306742867ULL,
+        931458720101386415ULL, 7241708170301431734ULL, 1977477333773701976ULL,
+        5086437914542673213ULL, 2112092186290038414ULL, 900262557809501765ULL,
+        3899902354550320155ULL, 1968669734883120739ULL, 4022382474586296809ULL,
+        7026516191735313162ULL, 5228644826725033278ULL, 4368359636113726277ULL,
+        6677638257627496115ULL, 1720337200229175466ULL, 3714736207016838732ULL,
+        1934081818737377276ULL, 7663304303539432118ULL, 7121051425642973725ULL,
+        1959909415337076394ULL, 6378212927062911780ULL, 4334144775199875394ULL,
+        5424879681021215287ULL, 2835646714989461321ULL, 7521986253258685754ULL,
+        3028454839917722708ULL, 4268560285614740481ULL, 5639551995951465017ULL,
+        1813924866957334138ULL, 688439151129628543ULL, 7354850246998839550ULL,
+        6329259817782211526ULL, 6459186954724208667ULL, 5575400291320398594ULL,
+        3420325938253135748ULL, 6987609491483972077ULL, 793529379860118672ULL,
+        3504951498285241611ULL, 9124937914320348776ULL, 1491924739263828120ULL,
+        8523573100859665160ULL, 8325753970464961515ULL, 8471310100210193299ULL,
+        465911546276816786ULL, 6522593671049257946ULL, 1892456214319543769ULL,
+        2485869526343604701ULL, 1956517781367696065ULL, 6877393069337255670ULL,
+        9164210214219941014ULL, 3457277579014368720ULL, 2873234478667748597ULL,
+        7084906894765115960ULL, 4321282120674927701ULL, 1207311323666387177ULL,
+        7078149668789523358ULL, 4316455722733049758ULL, 7241667031238114121ULL,
+        1790079430798413363ULL, 3593347847216723661ULL, 1446686950683645214ULL,
+        665747446837356282ULL, 7773905612994497883ULL, 4506824184634211288ULL,
+        473406275241802816ULL, 5213607122248544298ULL, 8068252477250733591ULL,
+        7265457189903450435ULL, 7915635520564219568ULL, 7193677186652485836ULL,
+        6685710549102207038ULL, 4760286610940503666ULL, 6508772357414750625ULL,
+        8704985093108649340ULL, 5572681662733844015ULL, 5497832874035549716ULL,
+        2858797082533460611ULL, 8808318434053901981ULL, 4200173719606920068ULL,
+        6108508257091269013ULL, 539548725532803030ULL, 2034298087791572037ULL,
+        702877412254693234ULL, 197339590916877712ULL, 645926719851231511ULL,
+        6873574090693701017ULL, 7300454561538740809ULL, 4956618673223177653ULL,
+        8470118080207022267ULL, 3517889347138053310ULL, 5110296461217698907ULL,
+        1947600607318043942ULL, 6130234872922191719ULL, 7291546417598722609ULL,
+        3518618357068532634ULL, 393349501444675584ULL, 3602578890839258247ULL,
+        3871792898332568882ULL, 2268728694030288726ULL, 2845505343341162196ULL,
+        8581359236020652680ULL, 8305752055467413586ULL, 4216403788394710196ULL,
+        3473311223529498019ULL, 1158427148254691857ULL, 3899072487230345432ULL,
+        1362545451319316884ULL, 4734706466004189239ULL, 2794226715564571911ULL,
+        7109150640999153284ULL, 8962018899229636085ULL, 5735790214799384307ULL,
+        3831038378769999795ULL, 1762575808632919017ULL, 8689823379334930577ULL,
+        7711248234172263898ULL, 4978532608384880381ULL, 7847646669817434689ULL,
+        7603292243848591490ULL, 4762739485552162643ULL, 4924410739379446404ULL,
+        1397570616026586646ULL, 2115257736411235045ULL, 6742400939214383473ULL,
+        3533665139518703429ULL, 1096550367914626402ULL, 560148001470350647ULL,
+        2159114244248457864ULL, 1892447424105782147ULL, 3472862243654511368ULL,
+        7230573168036078227ULL, 7180274711046132077ULL, 8709198305102904684ULL,
+        2072453489892754189ULL, 7035331930253889942ULL, 7533279690822164562ULL,
+        2794829796405989142ULL, 2099907633409894934ULL, 4577403109915545848ULL,
+        3054252239540877734ULL, 8931620695992386233ULL, 8767704250489769056ULL,
+        1783358491485775014ULL, 1337288109957332230ULL, 4241495388826570331ULL,
+        810436780278871254ULL, 7167469869016631557ULL, 858783324475479119ULL,
+        8555382998289594464ULL, 3454551921934684353ULL, 2372267904008339436ULL,
+        1070131740134773437ULL, 3592884673233071750ULL, 982150351063689208ULL,
+        6791921305965738165ULL, 6412535344267866115ULL, 6213370958021378077ULL,
+        5155333909435220102ULL, 1478264698604985205ULL, 2158098028193593690ULL,
+        2920242474165984158ULL, 5272164378015304653ULL, 4755010486846625158ULL,
+        5973191247531021323ULL, 6130946196060392604ULL, 1939906071185930603ULL,
+        1351609060771222353ULL, 6889416973831626484ULL, 3485071284912826543ULL,
+        8429007054775109916ULL, 716856825427062659ULL, 8336812343896082537ULL,
+        5524579218993126000ULL, 9039994988132845317ULL, 8704836267602278652ULL,
+        7289071954304731267ULL, 4220729316398875560ULL, 7600126403477464450ULL,
+        9186426307950600607ULL, 6123573489210846454ULL, 4211392291642490267ULL,
+        2119994498839422004ULL, 900178788758615861ULL, 2665244972098714597ULL,
+        8082238459527270702ULL, 5433446596564068484ULL, 8814350719237827182ULL,
+        3924297351972874637ULL, 7779428691265570285ULL, 8153946563757748970ULL,
+        7976170832396108869ULL, 8005963403454012268ULL, 2592262130917342079ULL,
+        2404182286580980475ULL, 282304406713751367ULL, 427219216054507361ULL,
+        1882246714060425498ULL, 7099803786794744352ULL, 2620253239302997106ULL,
+        659283090266318282ULL, 5584545628617097626ULL, 3834886810655757188ULL,
+        9096229625016852791ULL, 5525621608201525802ULL, 9024326360098610676ULL,
+        7625091695454819683ULL, 4094477113205310782ULL, 6026476853795338052ULL,
+        1785411094317961947ULL, 7067430411963401746ULL, 1103587303996743186ULL,
+        2504813616719002529ULL, 4694742329704812990ULL, 3486845140987580861ULL,
+        154498544568522039ULL, 732234123854564402ULL, 1316760921663138990ULL,
+        619873016987045669ULL, 1724515332151656083ULL, 6467858153817129085ULL,
+        45071117596217560ULL, 2309502448560836667ULL, 1876611771545844215ULL,
+        3736124669719135756ULL, 5734991556974147396ULL, 6434729106185183641ULL,
+        7901546730921118586ULL, 4300102975700375707ULL, 1368777964149002368ULL,
+        1827611548634507241ULL, 2057292829156916130ULL, 5416655859466955961ULL,
+        2261682865856262751ULL, 8736107272340421877ULL, 1454054538239277057ULL,
+        6410618530896608291ULL, 891390251645616948ULL, 3720187197827100855ULL,
+        940265691598663442ULL, 394024827292375598ULL, 7852625123532919757ULL,
+        7478798667990050958ULL, 210471772290959744ULL, 8644879169460636455ULL,
+        2418317160979372713ULL, 461437478174840835ULL, 7096977895080867114ULL,
+        4718472729258169575ULL, 6525424211931248796ULL, 6707407793960384619ULL,
+        2530294114670363961ULL, 1668654081656059589ULL, 3487011187360061761ULL,
+        9058317087248694792ULL, 3792816592599247805ULL, 5819598665691027313ULL,
+        3934979813465588637ULL, 947291295306077190ULL, 1224261176520867504ULL,
+        144401790826381350ULL, 3330467913612159967ULL, 5667673125693798528ULL,
+        353951270059167413ULL, 8431369814575380107ULL, 7655623777571231276ULL,
+        8638377732706515824ULL, 1918723362817229528ULL, 2461669805512777136ULL,
+        6653459596890178647ULL, 922762451087588972ULL, 4792457809873331058ULL,
+        3429394358974234181ULL, 8960922195342595770ULL, 7041646228969867296ULL,
+        2996258984220396288ULL, 8552759250781365346ULL, 5506700128362662745ULL,
+        5545258676728528312ULL, 1629727473413152441ULL, 5418496493568297798ULL,
+        7535575373976494418ULL, 2519297607433518790ULL, 6742427182566926538ULL,
+        8495024952215076724ULL, 4037493054275156564ULL, 7361654968027677636ULL,
+        353342502990999036ULL, 3555507647057261537ULL, 7189399988656424980ULL,
+        4617254118796323970ULL, 7066442515038285793ULL, 1151335088956292142ULL,
+        1841307014626863021ULL, 8088982804364748505ULL, 7739721740425058350ULL,
+        4842042812801569253ULL, 5507498308585020449ULL, 8942588082906497877ULL,
+        3693493643029935165ULL, 7718670358002916116ULL, 3325551908494253339ULL,
+        6056348368083359289ULL, 8869755201127055565ULL, 6674695941544845819ULL,
+        6008226098612012171ULL, 3945149187070775648ULL, 8000667754046332477ULL,
+        7932355031303923172ULL, 73351765383082216ULL, 321037943510852264ULL,
+        2534741247333077203ULL, 8201818753643828029ULL, 7740039950921293799ULL,
+        8116052488762759661ULL, 6011837205630096127ULL, 7630684338751421127ULL,
+        430628290762170220ULL, 4777041012279780613ULL, 101676705143789213ULL,
+        2824973303027916040ULL, 397238337142023022ULL, 7256764650496966923ULL,
+        8638432046907180565ULL, 6722639573495566941ULL, 2431436243757656052ULL,
+        1396549525043529989ULL, 8147007835088341891ULL, 7299201624997330023ULL,
+        1110200876181905642ULL, 636150746503235277ULL, 6502374562493387901ULL,
+        556852984422030020ULL, 8709291114284627596ULL, 8350176080483342272ULL,
+        283680264279344616ULL, 5589459731165243546ULL, 6669491666750875833ULL,
+        3627795721197864189ULL, 5884813530026430572ULL, 4305979756315123878ULL,
+        7535163070084755505ULL, 1903728085690186955ULL, 3994244423201733913ULL,
+        3290651713725924153ULL, 5216638051763052992ULL, 4293058410346024072ULL,
+        1372028034531581201ULL, 3273648342800460278ULL, 8287391887775627268ULL,
+        6944004006785442220ULL, 1271848124679970401ULL, 8806808567908551533ULL,
+        5029100679917961133ULL, 1613880983863957719ULL, 4005465083017220821ULL,
+        2906518941904244249ULL, 5551555233657228270ULL, 3306186717980077155ULL,
+        6040220549275256030ULL, 2728232467680143501ULL, 781196830473137516ULL,
+        6947834659822176226ULL, 1840774639333312830ULL, 7934825096658404811ULL,
+        4382688415670064725ULL, 1492749433173915686ULL, 3383459663429673904ULL,
+        4564148729310409849ULL, 3927518790300054514ULL, 497119886019925894ULL,
+        8642861963683917347ULL, 8978151821856491060ULL, 1045894164977268767ULL,
+        484839894403394087ULL, 5065619256800516593ULL, 1555752431811248401ULL,
+        2497694190833710521ULL, 3021595266587333805ULL, 8487161712275742296ULL,
+        8393677135310820778ULL, 2866496080075018287ULL, 2909215611791053453ULL,
+        6118278379043974596ULL, 7334334718837047111ULL, 5786910409869953054ULL,
+        2946324443042972281ULL, 8357724410492545629ULL, 4472788394945601306ULL,
+        8104688125670046245ULL, 7403054001950143683ULL, 5205978960220499555ULL,
+        660525738283192404ULL, 6081426055756428768ULL, 3572486344554272593ULL,
+        8100124906130411117ULL, 6215273367307936413ULL, 4013623076348559890ULL,
+        8232170477857562139ULL, 6351929620753002625ULL, 1227296675108121415ULL,
+        292885539040544694ULL, 9018340847550202981ULL, 8471534061708601467ULL,
+        4604579092191539203ULL, 2135655880839411381ULL, 1637407411871156078ULL,
+        3062904194056068165ULL, 5263928249283504526ULL, 3752718990335541965ULL,
+        3817715026519535884ULL, 2608132581821717125ULL, 1571065457396476245ULL,
+        7708448419858849589ULL, 1100330243033338551ULL, 6959748013391548976ULL,
+        6434291786417304701ULL, 8855112844336722208ULL, 8937805159721890351ULL,
+        6306187456301908448ULL, 675017504425301309ULL, 1679104815430749202ULL,
+        7278364994088327238ULL, 5496572113694601418ULL, 895506866656609331ULL,
+        1656948237365128424ULL, 1616603844688210134ULL, 5201663547529813394ULL,
+        8757724625492255652ULL, 2082107989971656822ULL, 3754537260090299338ULL,
+        8997167865376504440ULL, 7149626136655998105ULL, 2892971758768740209ULL,
+        1647796379278784567ULL, 8398761715622615846ULL, 3025079470679476448ULL,
+        6114299016025665423ULL, 7988022026544746298ULL, 3840848224456789130ULL,
+        6393528063851993131ULL, 8149146367722546803ULL, 5701169153478230582ULL,
+        5118134808007043267ULL, 5976960379390309411ULL, 2040545526011626531ULL,
+        2050088664217196725ULL, 5069631863802083173ULL, 8558181656338873555ULL,
+        6686842776333855434ULL, 7368461814723443332ULL, 7727183690455786045ULL,
+        2592479090563763578ULL, 7254065334877504644ULL, 7953064581841888065ULL,
+        5031838649568097432ULL, 2044900954118955705ULL, 5321448899087760773ULL,
+        848997559944818147ULL, 1405962185367447634ULL, 5284739890510471355ULL,
+        1052376867868891456ULL, 4219450766502469324ULL, 6230875931645247086ULL,
+        3770591332381165454ULL, 3058746657189273969ULL, 2263317419855088219ULL,
+        2489841982743473782ULL, 1137884538677851861ULL, 8986011835930571601ULL,
+        2399516847852238753ULL, 942798812276040058ULL, 896410874477368579ULL,
+        296106310177645907ULL, 573839680999346467ULL, 2099835636570176531ULL,
+        8326413200061559194ULL, 6563074748133701395ULL, 4860884520919349639ULL,
+        181139891390799597ULL, 8696569670242982026ULL, 4638634193184637860ULL,
+        4968262095768048205ULL, 5152591586484041784ULL, 3487985076879431396ULL,
+        5750931592232342509ULL, 8511872801109269191ULL, 4269097328741867651ULL,
+        2796883577159486598ULL, 2055799043474049810ULL, 7548031984708088767ULL,
+        8228598933808716736ULL, 3620758506786840703ULL, 5942136236060072942ULL,
+        688331403879422699ULL, 7854133081952644359ULL, 7336829151267375291ULL,
+        2789610873212900730ULL, 1252901161800742628ULL, 476972643574279882ULL,
+        1437644551529087627ULL, 6329315831110034450ULL, 5503531156621552162ULL,
+        3173337440569891806ULL, 8458137957705905788ULL, 21662608527448509ULL,
+        7913941866993443242ULL, 2460820985989664165ULL, 5645058793865737084ULL,
+        8128922889382165908ULL,
+    }},
+    {{
+        8386342538951923556ULL, 5694625098829376912ULL, 2085672594518996615ULL,
+        7708937259233421870ULL, 2115700186208859678ULL, 1426674871919619576ULL,
+        4469107765889080207ULL, 5318650842624686123ULL, 8646076206658948711ULL,
+        4924077091026109083ULL, 8097027591217577801ULL, 7060231605648517350ULL,
+        1205004600531041159ULL, 4629169227208998461ULL, 5895708494993552807ULL,
+        5401768204443013137ULL, 4510012227396416810ULL, 3070081248233774079ULL,
+        2704500577280108666ULL, 7774136386499689649ULL, 2340854904024213252ULL,
+        1465712586378801945ULL, 2316347187592716790ULL, 3467364240534166383ULL,
+        3190213069653924311ULL, 440631574931794224ULL, 6008846550771467769ULL,
+        1345028143569130995ULL, 6303039986042605631ULL, 3314799002678422262ULL,
+        709914572077090163ULL, 7772465602052768149ULL, 7075774604365727249ULL,
+        8725076271681214529ULL, 347226313345063677ULL, 3444823277247884610ULL,
+        3527127010776112953ULL, 5385434888881879188ULL, 4551435499644563007ULL,
+        8912699303048767389ULL, 5259411293139977002ULL, 8276282861590316564ULL,
+        489286856964946716ULL, 3366204874487769734ULL, 7025796136132845034ULL,
+        797224276099006585ULL, 8341855272043205711ULL, 4015635647987669385ULL,
+        2088142116374041730ULL, 1100764769857503429ULL, 1551441547216559296ULL,
+        8925233557253881446ULL, 3844446429890881258ULL, 4591437929409194029ULL,
+        8651868856813583889ULL, 5942720742215582325ULL, 8681254374693911550ULL,
+        2617796566504997248ULL, 305507286156875312ULL, 6942452672741831193ULL,
+        1314262912670009291ULL, 2714256783155765988ULL, 6740529998789910542ULL,
+        7744776394194336431ULL, 1170697673895112862ULL, 6428290918139407794ULL,
+        761570720751127748ULL, 8074745001149414370ULL, 2217766531685118656ULL,
+        7747327048186219698ULL, 5515863565750060371ULL, 2548336583426988366ULL,
+        681081821310797094ULL, 6658331583016443812ULL, 6885555124242546933ULL,
+        779474499679755902ULL, 1943387261313099832ULL, 4755914927285896600ULL,
+        3218914720988314375ULL, 1894254448789018592ULL, 8017918590813776616ULL,
+        4589456448141104045ULL, 5033791746336008245ULL, 8946218361963936659ULL,
+        9057951785767955545ULL, 4998467953129807533ULL, 3745236156218537712ULL,
+        6543272713620358636ULL, 9099571661209566251ULL, 1725842901906966298ULL,
+        5528028288326207616ULL, 7798241954781585785ULL, 5708189555909840540ULL,
+        1416487259429417497ULL, 5460523935904222089ULL, 4390588731868943790ULL,
+        1277932478274408467ULL, 3204421772279474443ULL, 7238542895702563236ULL,
+        720763646139296536ULL, 1865678382298705433ULL, 3817025491924182399ULL,
+        2118060844349898960ULL, 6988807604887830042ULL, 8810690252308994998ULL,
+        588277719716719169ULL, 2043345707761064679ULL, 2439049200979956621ULL,
+        9049343949232983307ULL, 2586432473302092278ULL, 7579159583582144555ULL,
+        8470021755613588219ULL, 5189193208702447072ULL, 1853068358982096094ULL,
+        1950406176880230801ULL, 8068351386423771906ULL, 2977698252544986611ULL,
+        4553813464117660085ULL, 3106150569777625659ULL, 6466351546266878297ULL,
+        8016954804635965309ULL, 1120632173658234557ULL, 1159713454088070194ULL,
+        540298344733186775ULL, 4703031425407427049ULL, 4425596394849097372ULL,
+        3499733307610708044ULL, 987877961234745394ULL, 1206235955868284684ULL,
+        7901194126781568632ULL, 5025816642004501556ULL, 2849131949108134022ULL,
+        9041981823210253172ULL, 3114945071646744004ULL, 2810332830104375799ULL,
+        7740937683152081027ULL, 1908385297411567449ULL, 2008324232500409134ULL,
+        3465126433602675677ULL, 1815998469252229412ULL, 1333332532333943535ULL,
+        7466629026718019616ULL, 2205725443503704309ULL, 6054166815475380478ULL,
+        3412603831720271339ULL, 6767582120222441293ULL, 6099912335551510208ULL,
+        5730685849933401753ULL, 2919138151131660020ULL, 8910551855724125814ULL,
+        2540069181958502671ULL, 7419184451476540162ULL, 7257182031009142145ULL,
+        1041709854889813703ULL, 6111776192750214182ULL, 1315513283988955138ULL,
+        4921633770617009664ULL, 8816283715656576698ULL, 1813683452043599855ULL,
+        2430503964951170789ULL, 2596204353662956898ULL, 149334861189651240ULL,
+        8069312413786912679ULL, 3026470347786820992ULL, 3369758419567311218ULL,
+        1890746650424324064ULL, 2600323672187305213ULL, 8360515167089632498ULL,
+        3366246620140321165ULL, 8691043998761739686ULL, 5304950910013633026ULL,
+        3877387669834933684ULL, 2717558479524425706ULL, 4308264073857541694ULL,
+        2900490852402678271ULL, 7665762503134921443ULL, 2970481382105623303ULL,
+        7052502111877060493ULL, 7013069376535647458ULL, 6312985588117658725ULL,
+        7048978521171246822ULL, 4098086478288024281ULL, 440498969217902422ULL,
+        4141097965217763218ULL, 3436340718154269895ULL, 9153546138924733105ULL,
+        7409088862364646063ULL, 9189263275488548566ULL, 5976255829638145224ULL,
+        1589031062863019344ULL, 8961052531277924725ULL, 3563230632358644701ULL,
+        4466789192681836248ULL, 3804289607096996620ULL, 3729702979206769766ULL,
+        6913087295084902379ULL, 1433362903486297026ULL, 2105785035518118049ULL,
+        7016801660112563765ULL, 4156536936081249847ULL, 1390066783663720907ULL,
+        3119159607936518413ULL, 1598940969587055186ULL, 8986776415819950426ULL,
+        3063307581077246801ULL, 9081895912265345528ULL, 3480500138984359308ULL,
+        6392256918584727135ULL, 8276197644853767184ULL, 1342272151293574796ULL,
+        3175249623947420794ULL, 1914685391211771894ULL, 5325654130419544556ULL,
+        8081808792183164896ULL, 4944822224111085851ULL, 1934173252723920868ULL,
+        6207092333168884767ULL, 8841408683708384128ULL, 7331159316808095590ULL,
+        5044681490397079030ULL, 2339401302351175139ULL, 7666935972214108254ULL,
+        612120189813485073ULL, 5590622724634165235ULL, 6687950990760571936ULL,
+        1012873880569459194ULL, 9134360745631618029ULL, 6862868386385506984ULL,
+        3465791407885152834ULL, 270799597564074394ULL, 4749578092457950284ULL,
+        1439748147939287052ULL, 2827078873379689637ULL, 6377569755765653966ULL,
+        7802625708643540559ULL, 917593008538883153ULL, 4842994336760413365ULL,
+        2116950677346621388ULL, 4517500516332299819ULL, 2618945614801850556ULL,
+        5632250536903307584ULL, 3469200419288551806ULL, 5757603450626071933ULL,
+        6546704858839823537ULL, 480273393814082302ULL, 188942044852695978ULL,
+        6824819043395301764ULL, 6738437842059826932ULL, 8498743097766169942ULL,
+        2579736842740421105ULL, 464839065962522236ULL, 1451191563207560916ULL,
+        6579929899834720470ULL, 3363527528730652283ULL, 4394989043973381071ULL,
+        7738014739468172854ULL, 2311433265090295337ULL, 2993301633825223092ULL,
+        3095289223476156758ULL, 7472505073580431537ULL, 9106876043242455604ULL,
+        2768757681221762494ULL, 3165840393711978830ULL, 4368941632545365235ULL,
+        6206017887775974ULL, 5578620982514079139ULL, 3861647208570836633ULL,
+        1646868680191204679ULL, 5239764125186087131ULL, 7710297114752675514ULL,
+        5611942862883011421ULL, 3231649583653520215ULL, 6120763770415589230ULL,
+        480030862588527177ULL, 6669157454432202586ULL, 8913140953371262565ULL,
+        2760387428527119017ULL, 8551464585649053847ULL, 2249592088298880418ULL,
+        67639621170378486ULL, 8351674861266048924ULL, 6880444610479992658ULL,
+        2112589144239599251ULL, 8865006262389262353ULL, 8331088031785691957ULL,
+        1322730643075478762ULL, 8826719832740091528ULL, 4714316078594987958ULL,
+        6800632360148391199ULL, 8235823603804703816ULL, 2112393618820546488ULL,
+        500496637375618914ULL, 1903817779872460619ULL, 2094702536437359676ULL,
+        8180245653106340209ULL, 552708969426237615ULL, 8911388401037158456ULL,
+        6144155420135266596ULL, 9094341765689829230ULL, 8849420266574013669ULL,
+        8829620995044198373ULL, 9092573490469749450ULL, 1830770301702815869ULL,
+        7738540524281293660ULL, 3092535536184894621ULL, 4601610598713297675ULL,
+        3092950140215217465ULL, 6943114570360555140ULL, 18121739652205859ULL,
+        5776092070445311684ULL, 3288336937362531033ULL, 3506030430237688123ULL,
+        4222659670401396865ULL, 7328589908135578961ULL, 8213274644481211978ULL,
+        3653079239649683835ULL, 1547083912073197046ULL, 3021194967179844408ULL,
+        2698504684269586484ULL, 3673017893459670318ULL, 3994532142988195339ULL,
+        5207945477360160387ULL, 5715413133940368456ULL, 7452598454173761792ULL,
+        6009376370973517855ULL, 368360272473017973ULL, 6392045818391448096ULL,
+        7952384921656164307ULL, 814953967366581997ULL, 6975546424521598720ULL,
+        508721143645978666ULL, 8063185970812202482ULL, 1415613785781796434ULL,
+        7387855186939542817ULL, 8500597338290918394ULL, 2034424728396582927ULL,
+        7859992793810275057ULL, 4711905173893098553ULL, 1566734406742850733ULL,
+        3111792031210119271ULL, 4761323370131606599ULL, 3801204990140417120ULL,
+        7620297116394618546ULL, 532106902853021298ULL, 7215614765458095567ULL,
+        4516194756867011764ULL, 606697099154428328ULL, 8498709424833127180ULL,
+        2048467992535175192ULL, 9199800596054186530ULL, 343151420636506517ULL,
+        7436880154497769071ULL, 3490849187142501579ULL, 3146226261685672125ULL,
+        6359753067589068152ULL, 6707818008401251656ULL, 291883374454031201ULL,
+        6659339764516563734ULL, 4337872097355881024ULL, 2142777607565585939ULL,
+        7227561489334569953ULL, 3266200683347812807ULL, 6227493661232796732ULL,
+        3062138209301532740ULL, 3612322229401478739ULL, 6850468635532222796ULL,
+        1795097904763571003ULL, 4729969557718692492ULL, 7877656501458119527ULL,
+        7998702345622538607ULL, 7494374624194033141ULL, 15459259520127300ULL,
+        1383906498132162949ULL, 2131925053333584346ULL, 4471117538706827895ULL,
+        7500752145396836932ULL, 5992574438679438345ULL, 1006928625035753198ULL,
+        7602244088903589435ULL, 1899786462917516810ULL, 819875622410559257ULL,
+        7357278503595694753ULL, 9060082027414981878ULL, 5184880058180660582ULL,
+        4922517959218852624ULL, 3008079426400527754ULL, 6616876484142185872ULL,
+        2067145108069847228ULL, 2646184819742439451ULL, 4845543458481644929ULL,
+        7022675167430883222ULL, 8523934732225396828ULL, 7969493251430013056ULL,
+        7111940793793673367ULL, 3045283891524683816ULL, 7507833898349185391ULL,
+        6277466546934620769ULL, 2591543901198949818ULL, 1639172774727017595ULL,
+        6750466118014678872ULL, 2939870231702721275ULL, 8706202916748577888ULL,
+        2963812807017570765ULL, 2336008800973214891ULL, 367479541327995911ULL,
+        9028980640072641357ULL, 8766994725771737367ULL, 6700596002384400046ULL,
+        8827038632373230439ULL, 7246710409583403466ULL, 7645039743777965002ULL,
+        5217296561940019214ULL, 2753564212823090200ULL, 4473221471592551716ULL,
+        1128155612394229060ULL, 9136028785385405286ULL, 6221857746246483926ULL,
+        4723289852712223552ULL, 935724313573399718ULL, 4085358902987086747ULL,
+        8391390766373961466ULL, 2112961153295224184ULL, 1128261792553539607ULL,
+        5392918703822796369ULL, 7514408772659920363ULL, 1849958741339163208ULL,
+        4615015018128265612ULL, 3085624591376066972ULL, 1868075188892038827ULL,
+        8530110189399872558ULL, 7783476023026305674ULL, 4698810945018575868ULL,
+        1640025130808140388ULL, 9088522158091578298ULL, 5552826563275682310ULL,
+        6503461099232487981ULL, 6561792984815328606ULL, 4843421748173505985ULL,
+        4094057473648241077ULL, 6378379435053771646ULL, 1382652052835537496ULL,
+        7365647179305080289ULL, 6365791726019061819ULL, 7415828953124912770ULL,
+        8751335168352607141ULL, 8384372196689589313ULL, 4510171170057011860ULL,
+        1713540824226993864ULL, 6867418745787070098ULL, 2197062226823150698ULL,
+        6089783447265138471ULL, 6235311757317509378ULL, 27113185659826765ULL,
+        8459677587614279999ULL, 3764399881344052718ULL, 3027844326193596327ULL,
+        5702823416937558458ULL, 103339993834596354ULL, 86581272248325686ULL,
+        6844453357822103505ULL, 2711537413632052685ULL, 3561896576746844804ULL,
+        2719700829137844029ULL, 2064078247670413964ULL, 7708886286794952668ULL,
+        5205176080599035349ULL, 8153077119942065412ULL, 4176976627234077224ULL,
+        3577506557455841347ULL, 7658541571619032620ULL, 1083957723443154701ULL,
+        8349101932606962954ULL, 1460333966348638355ULL, 1745593166056736198ULL,
+        3818562082547826433ULL, 2706544884062130081ULL, 3419924757862641243ULL,
+        7575410953789382830ULL, 7699023524818586778ULL, 1634976245332164834ULL,
+        6654207756640056857ULL, 7374898757503972936ULL, 2091445576213544954ULL,
+        3785821242662972468ULL, 4007242748224553748ULL, 2216493691148233698ULL,
+        6901264392216769440ULL, 6527289276897243267ULL, 5487373226360765253ULL,
+        4896597301144756481ULL, 6014957397809886250ULL, 4556030987526467167ULL,
+        7779193674871877872ULL, 3329351172073801866ULL, 2430302734747447846ULL,
+        2968656820519143219ULL, 448406520692684855ULL, 8400515407526955150ULL,
+        4061726710280049443ULL, 3203664393957704064ULL, 2006021995430613135ULL,
+        5620659097754453486ULL, 5308964057255030183ULL, 7590453326219316706ULL,
+        415301897862733375ULL, 5384376228398723214ULL, 4308364963621507744ULL,
+        2402010267740464226ULL, 5708503958770827612ULL, 7589229730590697847ULL,
+        3764792355187053783ULL, 4560034177872447611ULL, 6910058844891165289ULL,
+        5462867161236068526ULL, 7725271824200406343ULL, 7038777170954470372ULL,
+        8692481977055204934ULL, 5505734893354808022ULL, 1118764933168106271ULL,
+        3408197675911958539ULL, 1473036731123083757ULL, 4560219586433946185ULL,
+        3387249013271294032ULL, 3568638123063163104ULL, 8200124060992686600ULL,
+        6780506732094306102ULL, 5497925529570093164ULL, 5782085401979125694ULL,
+        7169057876185057634ULL, 3847754614505176073ULL, 9131313679344886349ULL,
+        1616517404650111858ULL, 6246142817927305812ULL, 6555499785290068885ULL,
+        3071114751607904827ULL, 2014667046231130700ULL, 333007498845242922ULL,
+        15608727926112556ULL, 1996591725616878855ULL, 6160466624295836765ULL,
+        1397157092418732561ULL, 7959106044476388428ULL, 7533394466278461213ULL,
+        3397339237514876574ULL, 6828883310675981265ULL, 1694524027299880166ULL,
+        3952408171542435132ULL, 8582661696797484843ULL, 6676523971004201490ULL,
+        3578563505617034471ULL, 693781795539180832ULL, 6866389243902266307ULL,
+        8617371587998188584ULL, 4950581229780442229ULL, 65203463501202691ULL,
+        1323203400899298915ULL, 5321828125247973352ULL, 8537474663283166803ULL,
+        52967335290644994ULL, 8522409193000097092ULL, 5792501874421370157ULL,
+        1254986175347883560ULL, 1569002878232213833ULL, 8537450153942198528ULL,
+        2914380195823897311ULL, 432720097527943389ULL, 5885494533660778421ULL,
+        4548782867343309057ULL, 3683853395545840046ULL, 5198298170129856724ULL,
+        4535936361908956892ULL, 8817849195113140740ULL, 2578770012289117540ULL,
+        201349571592117838ULL, 6744401417496202658ULL, 2988823146715109221ULL,
+        8664274081067831985ULL, 9180208255634418440ULL, 8141595236355806263ULL,
+        2547434903128358961ULL, 9131084368791406834ULL, 1951802611596554498ULL,
+        6779464825737648817ULL, 3022028285257025021ULL, 5464836338202741050ULL,
+        3681914514422718525ULL, 564593036072274889ULL, 2429012970467456738ULL,
+        3341440477994128410ULL, 7876839380687889826ULL, 3510125150758134574ULL,
+        1973516907180378670ULL, 3806761503419456041ULL, 6469771774225459235ULL,
+        2828074722627555668ULL, 7993129318053654935ULL, 1676193627085179410ULL,
+        8867929468762713944ULL, 7387570690508323160ULL, 6937327992252813903ULL,
+        6479525974208027494ULL, 8121603542049179986ULL, 7230568438995265487ULL,
+        5923918616493234144ULL, 4538143808099806671ULL, 5372895464825083262ULL,
+        1067532190710195673ULL, 6662813202710011201ULL, 1833316026125211838ULL,
+        4334618014999321233ULL, 6941597908702183181ULL, 8364581379592171512ULL,
+        8607691202491369358ULL, 3840542875290068385ULL, 6571924857797951611ULL,
+        3917343614626295237ULL, 4820700301797446926ULL, 731713164565928756ULL,
+        2382994316744620978ULL, 6161165266061100291ULL, 8813980604098431503ULL,
+        2545268270598638948ULL, 7708138658298258265ULL, 5856920386333301453ULL,
+        1885978606782072921ULL,
+    }},
+}};
+
+inline constexpr CodeTable EMPTY_CODES = {{
+    3585600138055221254ULL, 8124587972890615857ULL, 8263392243105302934ULL,
+    6503207118146915764ULL, 7921397879887992570ULL, 817907097906826117ULL,
+    353013120859504215ULL, 6373085944173749704ULL, 5351186294823349692ULL,
+    7881266402939002988ULL, 2806541085859545552ULL, 2320964994793311589ULL,
+    125493801020170958ULL, 7539723779833777351ULL, 2457409816221652613ULL,
+    2037553193986069569ULL, 7185752698487015966ULL, 4427355967064674433ULL,
+    1434205958596016703ULL, 3150257612049730443ULL, 1220123700029692942ULL,
+    4533965901535448400ULL, 5266603404206810148ULL, 5450964861605245679ULL,
+    8436767532202279115ULL, 7760869206835468584ULL, 6387397021714165312ULL,
+    8726497926412174048ULL, 587890582172698326ULL, 7715997925499721416ULL,
+    1743562011189485593ULL, 3234114492143803356ULL, 7530939190955631479ULL,
+    3964629821229440616ULL, 3386885422656199506ULL, 6097620987455956893ULL,
+    5807145452924129918ULL, 6247193136664291525ULL, 4884935637258243063ULL,
+    2324430586455296421ULL, 5727888829743968437ULL, 6289389495884229858ULL,
+    5896291913964840637ULL, 1652949141547635287ULL, 447160202995561927ULL,
+    1404984876860585849ULL, 3787340584371158086ULL, 9144251203607206159ULL,
+    4045917069183655960ULL, 4889350040150423209ULL, 918128384689680506ULL,
+    7486953876158886477ULL, 1059284342836605357ULL, 711945423734779049ULL,
+    1444689020075054218ULL, 4614958907698841134ULL, 5400493838112677443ULL,
+    8205747836369911986ULL, 1842872842522273586ULL, 4921938083314012114ULL,
+    1390146055924809879ULL, 1543700884305803708ULL, 6054078557214293011ULL,
+    6317463161970432148ULL, 4448315712018918324ULL, 7277252066100846293ULL,
+    4964828697491673454ULL, 4675481527225255103ULL, 3628961053222813023ULL,
+    7233065107626843832ULL, 5939707955763516403ULL, 708106281537369314ULL,
+    1770082109523879091ULL, 2785788499802885510ULL, 7422243717946429692ULL,
+    2164249059831910191ULL, 415499734940385904ULL, 1818840891318856929ULL,
+    6459238462234081286ULL, 3444464190932451902ULL, 8213040306272763286ULL,
+    5385999510319421839ULL, 745444049443391705ULL, 7327840057615989614ULL,
+    1307987550680482585ULL, 7847112244450281088ULL, 4916389833627466799ULL,
+    1169521847100272821ULL, 5311494035134783247ULL, 4956249607497983414ULL,
+    2086881710671325557ULL, 4225692073644779583ULL, 3108796594284602890ULL,
+    4764820668930635186ULL, 4415260171884023497ULL, 7490848489901337216ULL,
+    1458038691866860228ULL, 8203380276357716781ULL, 4757069998309967704ULL,
+    5713256817493373692ULL, 7857117774098027550ULL, 4679141340270815255ULL,
+    2787327604113043110ULL, 5012061019687181816ULL, 2003212712570062778ULL,
+    1598803714940593018ULL, 6059566119984546882ULL, 3916324102446745520ULL,
+    3980827874196403062ULL, 3540379722224766825ULL, 2510822245762151838ULL,
+    1926519843196044980ULL, 4668234885632679397ULL, 8859939138198416011ULL,
+    8346821890689561528ULL, 1852686474736878377ULL, 7228547622229848876ULL,
+    8881110804267976912ULL, 2620070780692297253ULL, 3863841397539670834ULL,
+    7658003753792646546ULL, 5912873618788417126ULL, 2468126788890268439ULL,
+    6040903873826004753ULL, 3232759658823277051ULL, 6144188246103882173ULL,
+    6306926152280659742ULL, 634549168309226409ULL, 2953458797845402104ULL,
+    6939297327344990690ULL, 2222886470794222228ULL, 2269368687898042400ULL,
+    3435676890665260497ULL, 7469011514732645352ULL, 6296672368615143181ULL,
+    4730720517202403982ULL, 3865084772231701851ULL, 4314331711508180792ULL,
+    3995608484175132408ULL, 3193262142434912495ULL, 3967348299705378752ULL,
+    8835167863222072870ULL, 2280394490098062129ULL, 7490444455461072302ULL,
+    1512659780921203350ULL, 7109755410349401842ULL, 1241305615398001966ULL,
+    5544710323716670480ULL, 8098699855028703101ULL, 7763708182647423437ULL,
+    8109605161313245898ULL, 2116268018316476451ULL, 7364989143465457255ULL,
+    7874481275951487823ULL, 3566064826826959341ULL, 7309293522189362443ULL,
+    1049872864771578487ULL, 5646352648070435983ULL, 3805742992844265758ULL,
+    5146332641958147695ULL, 8279473022649136482ULL, 7918098311961085395ULL,
+    1647970682911322935ULL, 1690837146332901123ULL, 4800971880494378642ULL,
+    5563180987171410318ULL, 225728750917562812ULL, 5354582975447047277ULL,
+    8544953445129127338ULL, 3139414663921444421ULL, 1947238639830029949ULL,
+    8915225211944227743ULL, 6985509443676474014ULL, 8024448300779576554ULL,
+    4217951216002814706ULL, 6094952851283609984ULL, 6908173032469098368ULL,
+    315998682721121510ULL, 1541081080471926728ULL, 4637028840244770086ULL,
+    4923089496508063722ULL, 5591573308387528926ULL, 8939428973510356685ULL,
+    5533391743658744182ULL, 9108381668852909925ULL, 3205007261606325310ULL,
+    6066180664739430196ULL, 5363764773910714764ULL, 3495579960702420336ULL,
+    7555110821718280593ULL, 3658615796725127465ULL, 2174798497878056061ULL,
+    5663060519771808455ULL, 1138553622462609741ULL, 624498015551847183ULL,
+    6744111109498511181ULL, 4815192833447055916ULL, 8399433480721198860ULL,
+    7979806217252736268ULL, 5040225366082886791ULL, 829110319175281145ULL,
+    8362493178824453346ULL, 3974445661034289815ULL, 4928795325734049954ULL,
+    460364475319939620ULL, 2671796703519182439ULL, 7143367658933172712ULL,
+    614161820343027720ULL, 6892174491912114032ULL, 1863845472529929898ULL,
+    3464565751744353556ULL, 147322359888426386ULL, 7853867687209798887ULL,
+    1017751521902496960ULL, 1166394975656447031ULL, 2707782103383565891ULL,
+    8689813260795725746ULL, 4754841152194611440ULL, 3449640410786801499ULL,
+    5080618187379024613ULL, 5209757290924094838ULL, 5758519197346451815ULL,
+    5589055474765057416ULL, 6152465514723636820ULL, 8998299876339982093ULL,
+    5205905465723568717ULL, 4715854361605027940ULL, 1332104997770872194ULL,
+    4246847351305060101ULL, 747707807345639160ULL, 8665085402367353702ULL,
+    4132046982688228494ULL, 4457139219872279631ULL, 5959884894883449185ULL,
+    3293749883302529924ULL, 7808445058192894488ULL, 3997914453032047766ULL,
+    5277197667356452164ULL, 3594057923126361856ULL, 2492984311741001030ULL,
+    6184349321191728064ULL, 468519189170000387ULL, 2473077946382686798ULL,
+    5912682188623978993ULL, 2272116329128107899ULL, 6329150762266122253ULL,
+    7533313986209834582ULL, 4706526870514309354ULL, 7126137473817968580ULL,
+    1331523838181655339ULL, 2962974937423054674ULL, 1190270215337658517ULL,
+    7126779398033311472ULL, 9007374586585759129ULL, 6840118227734524497ULL,
+    8635382413065310527ULL, 8318559016580857958ULL, 8141771154163882339ULL,
+    2103145462451693035ULL, 1888049456345468059ULL, 25402245264716441ULL,
+    9116832762375132102ULL, 7492320478527471537ULL, 1661308910656975327ULL,
+    7058164250618640918ULL, 1547169229226361366ULL, 7821171514706321879ULL,
+    142278496284590088ULL, 923336321816770896ULL, 1220488552346588776ULL,
+    8608245865025150524ULL, 306560339465409741ULL, 529019249341934844ULL,
+    3619934868810027744ULL, 4697571785659529444ULL, 1329502672191635985ULL,
+    4948935980733019941ULL, 3311096287205292369ULL, 456655480645951990ULL,
+    7870359293703687257ULL, 1787133139589769363ULL, 1181478239014628512ULL,
+    2549687242600189407ULL, 2088276264342246563ULL, 4217370833123625922ULL,
+    2633272992037044076ULL, 2595666125244578051ULL, 2741939538983254581ULL,
+    3489080775592904121ULL, 4192981682801701901ULL, 8673990414423533840ULL,
+    1258198541123834386ULL, 449364372411323234ULL, 7194918088434662369ULL,
+    5262037095041700858ULL, 1345175726098534809ULL, 4243723861469621035ULL,
+    950032477345309115ULL, 7928815727262428336ULL, 8287827291790563170ULL,
+    940039385106446709ULL, 5130508519535829389ULL, 1973443815725001169ULL,
+    7407640221094851713ULL, 3195875211877425399ULL, 160794314203416909ULL,
+    3084434037040760132ULL, 1657213943400087798ULL, 3561399280178249677ULL,
+    3429585930370947513ULL, 5959312455709469455ULL, 2348688216946873578ULL,
+    4895564168840127501ULL, 5545913937415231832ULL, 3200664365033775158ULL,
+    5096099226476325649ULL, 416573620395640141ULL, 5652437246386797611ULL,
+    7423629217027636560ULL, 3200848219401263761ULL, 699552832678605926ULL,
+    3116756379140773988ULL, 8059450100834532993ULL, 7464073277091139060ULL,
+    7745961628562105422ULL, 6281549449403579849ULL, 4184506759654242040ULL,
+    5158399697327474371ULL, 6764758167961003937ULL, 6608756468796408314ULL,
+    7363243374438200158ULL, 3615915249446815171ULL, 755749583674737664ULL,
+    8463575288748810004ULL, 7774131328108774732ULL, 2102647625196767285ULL,
+    422844107191538700ULL, 8325586243902467805ULL, 3212910845149975534ULL,
+    3091346437632854938ULL, 2253767898992269895ULL, 4981445689717394155ULL,
+    6787072992619769517ULL, 5075590907601221196ULL, 1749616408436009800ULL,
+    6142279569544876826ULL, 4557083828433600141ULL, 8282974493593332972ULL,
+    123515464319531272ULL, 9171118649953986682ULL, 4268374946946334778ULL,
+    6891487541197719710ULL, 2796400180575463789ULL, 5589765429127876610ULL,
+    1745994481773691783ULL, 872763135275459439ULL, 9137410966365577469ULL,
+    6287483311934668543ULL, 5499668318158279059ULL, 3489968035721999917ULL,
+    6181708653147822803ULL, 1705711983252688142ULL, 5156619803651748801ULL,
+    6818579955544945561ULL, 1964812093999843391ULL, 2991090900291884500ULL,
+    1937565383711101282ULL, 8424553877600253104ULL, 8732270361056947485ULL,
+    3882009273258795478ULL, 4279021394406328794ULL, 2486661134726709379ULL,
+    49095881260195715ULL, 5642431590197308102ULL, 4165961597648575748ULL,
+    1832434842911471413ULL, 7742563809787888381ULL, 6781787671332435267ULL,
+    1639513826628757721ULL, 4202809285522355163ULL, 1182410417433174328ULL,
+    9078530937414685871ULL, 4657235268685110374ULL, 8830737637093833291ULL,
+    1831521463084156254ULL, 7922348809249296205ULL, 6059525093715646794ULL,
+    6002771636505378958ULL, 6136492820360703658ULL, 3738740370397734859ULL,
+    6223511105254941362ULL, 3926167126650977749ULL, 638519415348308649ULL,
+    4185404327283123523ULL, 4171100118610568154ULL, 8779092529906226322ULL,
+    5586466893681572121ULL, 8179837709568995613ULL, 1161965128787124171ULL,
+    2899069523634352298ULL, 9020615903479641323ULL, 491698449455540062ULL,
+    3607767193790567041ULL, 1382758430562893034ULL, 5456569041621404326ULL,
+    190350304691839565ULL, 1779415230898672724ULL, 5797208900401760370ULL,
+    4272012469886309349ULL, 6166882071747900038ULL, 312287533030514020ULL,
+    1034080010699041793ULL, 9183115804175144245ULL, 9190156569192506099ULL,
+    1041715561203574886ULL, 9132569549989471726ULL, 2918029061695030459ULL,
+    818844806403096033ULL, 4025179879539481686ULL, 4881766429694326ULL,
+    3026963213298017127ULL, 8602860356656211829ULL, 1906296391528476922ULL,
+    6464914894265974393ULL, 6021827216847042047ULL, 4783409368148107582ULL,
+    3232535339117095793ULL, 3222816267280396652ULL, 8433095299775993872ULL,
+    6945853289446406681ULL, 91389359835530211ULL, 6336686934965691751ULL,
+    5165853663422641628ULL, 5195360834017707904ULL, 9154875760054075797ULL,
+    3451921177498193734ULL, 300373781836547551ULL, 3758068572801190085ULL,
+    8288292326121689675ULL, 2392477352309437314ULL, 5247705949360922719ULL,
+    4974192508482586513ULL, 7716397554945687614ULL, 4725729684865320018ULL,
+    4895289142877719224ULL, 1020172432345783947ULL, 2652292091980610054ULL,
+    48946436502263083ULL, 798067591251291514ULL, 6155372586816722493ULL,
+    219823297667130725ULL, 3542302124215730415ULL, 4877063358773760535ULL,
+    6645866486144117685ULL, 2925365251200466646ULL, 5789659275005821862ULL,
+    8580459147527716396ULL, 8275355217817362275ULL, 4222259663162258625ULL,
+    2810053244784075565ULL, 145840289828795320ULL, 4525131347740625484ULL,
+    5242501251433661576ULL, 5974874130136536057ULL, 3426601891584199814ULL,
+    3465349057181778364ULL, 5106701938983371382ULL, 3653952820656055385ULL,
+    6933567308678567023ULL, 5185408538940659026ULL, 6157347320042088161ULL,
+    786244207799556251ULL, 2176207309664103123ULL, 8908908967916018577ULL,
+    7575571848312458413ULL, 7613553675248494359ULL, 7557827786775030214ULL,
+    1466937341689440520ULL, 6746597262294964049ULL, 3590455593575873993ULL,
+    8490134117195578244ULL, 2669203671387961283ULL, 7404445801019516444ULL,
+    2668926330596706534ULL, 4597508238348284091ULL, 6717091091679914338ULL,
+    8002876052756061083ULL, 8018641589765355975ULL, 2663716998370108204ULL,
+    4199784141695142452ULL, 3359075229663231037ULL, 6388824404365231604ULL,
+    1523347589944520002ULL, 832730959929930551ULL, 8599679930043706126ULL,
+    3792572570793711889ULL, 4192582566641793234ULL, 5165951573682947888ULL,
+    2242062296523290388ULL, 7030674746501093393ULL, 1525104995207027250ULL,
+    325838682380903664ULL, 8945428988212600528ULL, 8677597938007937404ULL,
+    626117657714963189ULL, 948555693388267389ULL, 2917994475196491353ULL,
+    441744683636051563ULL, 5888445153184083693ULL, 5587109843507956545ULL,
+    3785283403605306590ULL, 6939987865968188887ULL, 6213515148586603960ULL,
+    3860444003718476687ULL, 2301200831864644456ULL, 1904982346658927415ULL,
+    5149999376451367754ULL, 3854314733638052083ULL, 7351933428215798280ULL,
+    8121923611539809229ULL, 1443695272979300858ULL, 2391852334455250637ULL,
+    5972146085467155061ULL, 6105583601223820371ULL, 2758839174164934727ULL,
+    7308185674249170694ULL, 5243292561809912155ULL, 4661136862023996862ULL,
+    7301011434175267885ULL, 4774160095893585116ULL, 216399473105901814ULL,
+    7176280332521508281ULL, 2111364710369456766ULL, 4532838753708432857ULL,
+    5382764376937814747ULL, 7448976828665001426ULL, 8957474234624030166ULL,
+    8725669274822556233ULL, 2252988953711080255ULL, 257257475790882614ULL,
+    7916369257833135665ULL, 5400031169461667081ULL, 2580273410654919401ULL,
+    4269373960281687308ULL, 7675066155650394776ULL, 8677154312602820611ULL,
+    69203698187959061ULL, 1915636181675625888ULL, 2745539295278547940ULL,
+    7948876731365364643ULL, 7579153580676257564ULL, 5772774467616920656ULL,
+    1052377374431732053ULL, 8933519215721299408ULL, 5422429554912853834ULL,
+    6418733137418935181ULL, 1437101864551963546ULL, 5680508661325771566ULL,
+    8627545841421650317ULL, 9132618314235310288ULL, 3458045971226122132ULL,
+    1917015523164358635ULL, 5328666491479361847ULL, 820647757658390076ULL,
+    4985168184111831723ULL, 6825036314194373956ULL, 6235597057649968455ULL,
+    2325367872975255208ULL, 8866280670394264244ULL, 8631342063649226815ULL,
+    8457770872526457604ULL, 1174886069936041221ULL, 6640581678080926652ULL,
+    6223318430913820208ULL, 965710861441010219ULL, 860314007437903251ULL,
+    5260035428028332193ULL, 1612454609944562634ULL, 2091911221173541917ULL,
+    7595056861765375087ULL, 2888057843729278722ULL, 2750083324960419061ULL,
+    3353711429520973338ULL, 3602580409077788645ULL, 1643844490742724694ULL,
+    5676326827051250644ULL, 3261785330332577073ULL, 8844053425302074383ULL,
+    3100021095107296727ULL, 4923434790083277743ULL, 2906051527601670214ULL,
+    6529569055027863396ULL, 4781458711505685314ULL, 9105842818787165297ULL,
+    5428483597992588250ULL, 3791085680357915427ULL, 1401482117866453591ULL,
+    411502057466180921ULL, 4347674662094512896ULL, 8842746693188885693ULL,
+    7205090207275689995ULL, 7382188840069040668ULL, 3945328090323460861ULL,
+    2310157113919139639ULL, 4993202646618520737ULL, 4693521968178086414ULL,
+    8661447672948497547ULL, 8010957973010249205ULL, 2186921897840243437ULL,
+    950748374602491836ULL, 8536655108575031359ULL, 936280453323835952ULL,
+    3715323924969913298ULL, 8923183547076473152ULL, 8205096655358469692ULL,
+    840277538782002916ULL, 6932946719401193912ULL, 4238877321334888894ULL,
+    7038729941009808887ULL, 5083214860760669647ULL, 1881397881922579657ULL,
+    7589642173187634149ULL, 3249742513316607708ULL, 8557627684381475600ULL,
+    5917111332883744484ULL,
+}};
+
+inline constexpr unsigned long long EMPTY_BOARD = 1539006079307850324ULL;
+
+// Indexed by [stone][point].
+inline constexpr std::array<CodeTable, 2> STONE_CODES_HIGH = {{
+    {{
+        6429030668825730553ULL, 7495474984457177894ULL, 8535245770755927609ULL,
+        8394911505631703538ULL, 5849773488046958082ULL, 1679089852350626425ULL,
+        3958368208345103709ULL, 6238782538731543011ULL, 5867578196209269522ULL,
+        5227976229254129947ULL, 8795470403218002053ULL, 2853090820837625001ULL,
+        2742651337816671954ULL, 8587297768567877920ULL, 3250265231547505095ULL,
+        6799193369654390638ULL, 2656123401430815116ULL, 3064993677962884367ULL,
+        2177378590953200620ULL, 6259587084378290499ULL, 9076792589168419245ULL,
+        8179644017791679239ULL, 944704948622236567ULL, 5678874763226006397ULL,
+        7248802742960543047ULL, 841457647932660233ULL, 2265675827431065749ULL,
+        2656742175011306330ULL, 5712537910821022556ULL, 2156601508711456071ULL,
+        2130798020877657177ULL, 7535460557906683988ULL, 7404186827592900153ULL,
+        4796145472853498610ULL, 3196826284667680497ULL, 5611225278379633829ULL,
+        1009211171559208241ULL, 6786741996534298535ULL, 2505771884655264614ULL,
+        8843339465040470691ULL, 2198856021809112205ULL, 4030601947675421816ULL,
+        950110598191574911ULL, 1177309583766874701ULL, 7679490520987766312ULL,
+        4277624349620838507ULL, 7914313837721469304ULL, 1587854907090434221ULL,
+        8128983436108461191ULL, 3272223878079218252ULL, 5891229863771524936ULL,
+        6825011061962849863ULL, 5814251915217743375ULL, 4954762368166915213ULL,
+        3413853565831407602ULL, 6409237926179493805ULL, 3338063819755629448ULL,
+        2716584973320419702ULL, 3176703376924390604ULL, 4117160992891350366ULL,
+        3293418276020908542ULL, 2823785058099192619ULL, 8215230363734552483ULL,
+        6111520279827350318ULL, 579601726725898892ULL, 18063282535809800ULL,
+        8252564290461065258ULL, 500289334895007596ULL, 786568037941308040ULL,
+        1291768943909131807ULL, 7952157913524765728ULL, 2081314479294537963ULL,
+        5112191675721951413ULL, 1648905710150122048ULL, 7475673907457641442ULL,
+        225136950795275099ULL, 3042363565965369205ULL, 1189315064639225127ULL,
+        6837510554788352649ULL, 9036417206693073394ULL, 8260673327607036201ULL,
+        3851492867932238439ULL, 8904939275016518688ULL, 4886880656033569995ULL,
+        8804326445936755563ULL, 8328007291071950669ULL, 3453142044487751151ULL,
+        6612169482950132295ULL, 1142503255170296771ULL, 5539946158552048908ULL,
+        7196567597997548253ULL, 2423246289339544721ULL, 5537908557564155368ULL,
+        7671751690378800614ULL, 4179750538716598774ULL, 7434044520576389690ULL,
+        3791785663627218174ULL, 4259268310049422705ULL, 1164555994667407024ULL,
+        4785316453760071201ULL, 1317124416106915304ULL, 4949532491730811407ULL,
+        5711332387796820194ULL, 4337369884497928059ULL, 5133451537443929889ULL,
+        1687531960342944717ULL, 8829826869658565555ULL, 8107699710121503525ULL,
+        3126934648883447470ULL, 3472137013390070665ULL, 1943761954333700440ULL,
+        7061986118007681323ULL, 7947528783387644363ULL, 4281584111118968697ULL,
+        3494832600748514271ULL, 6563124558020446559ULL, 1709097068201795632ULL,
+        3963802042137439564ULL, 8665945354852755853ULL, 241111385863035714ULL,
+        1291008472044295699ULL, 3044781069804497013ULL, 7059994453016137406ULL,
+        8765433513375222112ULL, 6695432308661167652ULL, 583517379839221249ULL,
+        3931997894843409265ULL, 6694392089052504823ULL, 3072576987349473175ULL,
+        7373746803896959640ULL, 4058683907747620819ULL, 3259804558215155595ULL,
+        932883079783246518ULL, 8637601260569830138ULL, 918914999981237440ULL,
+        8541449863395647399ULL, 8530302422311433819ULL, 7736672317194208898ULL,
+        5766764014281623463ULL, 5497457641458803763ULL, 3525554109257512302ULL,
+        971299249515122448ULL, 3535410541095621259ULL, 3170857401419159727ULL,
+        6510667350135554217ULL, 607591259305639094ULL, 1593281019181532224ULL,
+        5912501379085092791ULL, 2753489572606683094ULL, 163469592461521696ULL,
+        3387987265998464855ULL, 226831160645599109ULL, 8789594605773565486ULL,
+        6169108256369679581ULL, 4630969050853534126ULL, 5655106266981646131ULL,
+        946151315073076802ULL, 2814327451539205443ULL, 7545334718687779818ULL,
+        4062522218267655640ULL, 1828627870778754799ULL, 7034149827377395842ULL,
+        7467330710577739028ULL, 153327911721935656ULL, 941659792367776632ULL,
+        1111331650071831817ULL, 6462874303876871298ULL, 7931761821509425233ULL,
+        202643999343953361ULL, 508943122207699867ULL, 8470775936900603617ULL,
+        5719993535643100491ULL, 3144734850026941058ULL, 2953488623783729882ULL,
+        6836020546081465511ULL, 7431847005305582351ULL, 1236599585061585257ULL,
+        23567687870381433ULL, 1481614903228619312ULL, 5769994548205989661ULL,
+        4077792335326085299ULL, 6627297458692548470ULL, 1460262394913420464ULL,
+        2049186613027580138ULL, 8762811726142515359ULL, 4302655432133810207ULL,
+        3699508019684744327ULL, 4391283212343144460ULL, 9205021465694775970ULL,
+        581998794496760820ULL, 2009232317292038422ULL, 918843823565365644ULL,
+        798236248430706701ULL, 891831473666712988ULL, 3575174091843317787ULL,
+        180537400594692893ULL, 8436223190222360961ULL, 6917626562372726739ULL,
+        862972626503667314ULL, 3026573149831514184ULL, 4837589536271851560ULL,
+        7394511805673733962ULL, 6799887910333555747ULL, 8147895111542622110ULL,
+        4767201029178386581ULL, 5706048247007344173ULL, 9084340119361986033ULL,
+        2378493527968173360ULL, 6893927566467030689ULL, 1589345214343408375ULL,
+        6518804273829001743ULL, 7862702771274555942ULL, 2696771425156803529ULL,
+        7903646791198137172ULL, 8133459402510208651ULL, 5579308033362865587ULL,
+        6050526455591347763ULL, 4987572985789271065ULL, 63687757790352999ULL,
+        8236539906951655813ULL, 1664773724882632174ULL, 7689886735918956891ULL,
+        652836035578030845ULL, 8586899451021963574ULL, 1303630676803323870ULL,
+        2331227635521558769ULL, 5005585395680886609ULL, 1181105823155570210ULL,
+        4412820994246770942ULL, 8189993403923322417ULL, 585191071092130186ULL,
+        7911107305508041641ULL, 2520906222277985929ULL, 5129436808846829511ULL,
+        8042228183364983857ULL, 9091002233559333247ULL, 3174517043754817109ULL,
+        8240340088763737035ULL, 3301755773597187929ULL, 8108213288541722996ULL,
+        3742284026022604363ULL, 6844457785148879859ULL, 8575125847894741180ULL,
+        7985180746901425008ULL, 8533990708345976318ULL, 6491700214725890855ULL,
+        7112381020379795856ULL, 947381345044384798ULL, 3437419558727465424ULL,
+        8627087100555343502ULL, 3757400759898216079ULL, 7172618782692512954ULL,
+        5600378589714320784ULL, 3826852366220101460ULL, 9191002778725096476ULL,
+        354198320936039589ULL, 7729910840057866877ULL, 6457922074330298119ULL,
+        8755283565074052088ULL, 8072041298587887714ULL, 5532612006590240871ULL,
+        1468947682317369734ULL, 3707355791778054511ULL, 2797131600889127405ULL,
+        7587812073617471207ULL, 6213987697798541178ULL, 2511556076656733772ULL,
+        1195529584012615019ULL, 4145552437541340502ULL, 8977809673935285785ULL,
+        5988099676646461726ULL, 9058235390766726365ULL, 3367945242063813432ULL,
+        884473134312195815ULL, 6605249318990881722ULL, 2726259035174371035ULL,
+        4212420030407193662ULL, 2714747982185787724ULL, 7214863726954451884ULL,
+        1530650677187250062ULL, 4320575269944216927ULL, 5906739716634247451ULL,
+        4183516523886196689ULL, 7742890260229424649ULL, 3390959102216267118ULL,
+        8407114630987559551ULL, 1610900394626574576ULL, 1231913258259659923ULL,
+        8138652799858210645ULL, 2740796168141101724ULL, 4975477041452012889ULL,
+        4111229978524720140ULL, 6231601045587901906ULL, 5255777829620306779ULL,
+        3642148193699099519ULL, 8724748880120973690ULL, 448657180146706127ULL,
+        5985703833411352696ULL, 1882758783203823752ULL, 5904600287300008220ULL,
+        7265292852733139670ULL, 3179780928526069438ULL, 991808726566780768ULL,
+        1773642908178395717ULL, 7284654487814090644ULL, 5464950493982302102ULL,
+        3600418252469446870ULL, 2771153506147749584ULL, 4404118853054126591ULL,
+        8018007548351767067ULL, 3556510654849399063ULL, 2662158626542595055ULL,
+        3942398196437504242ULL, 8111683947751780453ULL, 8208322927395396940ULL,
+        9043225615367927874ULL, 5071001413638861767ULL, 1989768873320195852ULL,
+        3695468209402999394ULL, 1659504692867129332ULL, 2526526492268934787ULL,
+        644712975765618941ULL, 2285993284538154683ULL, 5600508393738049205ULL,
+        4664869768937689459ULL, 1136924064865128640ULL, 7571369437495228882ULL,
+        638984349463356807ULL, 3355590111049722403ULL, 6263877483835173136ULL,
+        8399475677765211992ULL, 6296748226818409786ULL, 4739528370510460672ULL,
+        3637562543576397104ULL, 7159486697571405447ULL, 6412083763194425288ULL,
+        552360767292171547ULL, 911010467569494266ULL, 7658157089270694118ULL,
+        4274728359189539755ULL, 4088818013641446463ULL, 2723604078070373647ULL,
+        6677449930720571171ULL, 5747347568305253074ULL, 4545217607477291318ULL,
+        2220678887229873568ULL, 1676249119591094144ULL, 4070641653133760722ULL,
+        4563682164074404450ULL, 6005812429435599164ULL, 4248836650827467090ULL,
+        1744599147014441797ULL, 5771574290301695028ULL, 8163121790930234351ULL,
+        7784022184657717145ULL, 1752921422099454719ULL, 6647446351737449656ULL,
+        871171524878928627ULL, 3529016019876418632ULL, 3434286451102867941ULL,
+        3149242821866932635ULL, 4547939259145622859ULL, 6727249088925983400ULL,
+        3197078808005307671ULL, 8608282882630704203ULL, 7996703535175784898ULL,
+        223512345817680855ULL, 5359436578749379553ULL, 7833599299080176151ULL,
+        1720422123784479165ULL, 8807823458123991015ULL, 7236051168537708743ULL,
+        3890121809311871425ULL, 3545850393422212862ULL, 456156949433038707ULL,
+        4840809939053031060ULL, 623374494678322702ULL, 8010519836797169878ULL,
+        5242688158847868772ULL, 2825500725485697126ULL, 7587871348271969042ULL,
+        7976786016458798220ULL, 3831663532506742604ULL, 2971203008721935998ULL,
+        1382350957307220817ULL, 1914388924787931487ULL, 150039204441712345ULL,
+        7039889116327416799ULL, 5119351678818080485ULL, 2781779484843872769ULL,
+        6059297207230745524ULL, 8997558510181363054ULL, 7367732556157249407ULL,
+        5568897690986346011ULL, 276918025271509579ULL, 503534498812902596ULL,
+        7577444529472294911ULL, 4006725547670950853ULL, 4039231959149044054ULL,
+        78191513796609392ULL, 3670034631895758022ULL, 5699952106299926634ULL,
+        7435208776512913045ULL, 4364506856181212639ULL, 4192198781592825046ULL,
+        2884681824727847255ULL, 2876718997225610363ULL, 5939194246177607731ULL,
+        7542839583919938046ULL, 7341521296443666180ULL, 4717571682857324890ULL,
+        7044294824840844602ULL, 5196626520016000418ULL, 5633379102401839985ULL,
+        2671358990851883787ULL, 3565347597200978588ULL, 835316328291273257ULL,
+        6478586401488190514ULL, 2029854656422079331ULL, 8914897628946714725ULL,
+        5756805155381216896ULL, 1420608223420943582ULL, 3571101115271457825ULL,
+        1864516563036542371ULL, 3803141517803938413ULL, 8256414612767862982ULL,
+        2822150777763178968ULL, 3052397251693704053ULL, 5332032135133610906ULL,
+        6739625575312714661ULL, 8202030418534139962ULL, 5370804333239365947ULL,
+        8136719583830266702ULL, 3301209303768519262ULL, 6666878681228103600ULL,
+        7530770516835126677ULL, 960936676505539206ULL, 467773813491199571ULL,
+        5572515325616842694ULL, 2726050058313345097ULL, 2951792451352053037ULL,
+        5161301238268513696ULL, 1196668668832348283ULL, 5008003431924995583ULL,
+        8718781821978350278ULL, 9018451807313828843ULL, 1180383496413333011ULL,
+        3964534684231565186ULL, 397813979908895648ULL, 6457572012414066907ULL,
+        4058684198282696329ULL, 1105075885757835259ULL, 2675329394118260775ULL,
+        8882775417849355386ULL, 4223422561889164602ULL, 2373263280205114179ULL,
+        2705586051058740610ULL, 6759576049369611059ULL, 7370423256848383154ULL,
+        4117392817406183170ULL, 7894547372004184422ULL, 3101005837933845071ULL,
+        8724882273954053331ULL, 4925820548711387056ULL, 1646223996786808974ULL,
+        6691461510620493147ULL, 5895107450206323994ULL, 8528505454792894305ULL,
+        2415239309438337787ULL, 5793660420663904545ULL, 8983093173664067622ULL,
+        8716122333428754754ULL, 8726275980292180233ULL, 4655034868200920167ULL,
+        6074737387218327833ULL, 4779813527699471663ULL, 7402222139602138256ULL,
+        5151936181369594024ULL, 4181288528410445390ULL, 8782736906790954293ULL,
+        6113455221526202512ULL, 7128934807747990754ULL, 8901704534122735780ULL,
+        6397268964368181025ULL, 7781896897156035823ULL, 7669007938499246138ULL,
+        7184163767611491310ULL, 4888961310823701530ULL, 6145705680589383980ULL,
+        3451429271217128229ULL, 3398012002837047042ULL, 7839014277130056738ULL,
+        4733912604456635525ULL, 3033774352104082776ULL, 4731245351171717482ULL,
+        5887755101015789078ULL, 5690978724175742862ULL, 5576517819641899498ULL,
+        8595209122399583756ULL, 7856749981799761747ULL, 4400297959527837267ULL,
+        1105574683251013685ULL, 6121292220402532204ULL, 1011358718993777412ULL,
+        3592678742376787880ULL, 8554880363401628491ULL, 3184248638534667658ULL,
+        7475040755096781988ULL, 2296239521335665119ULL, 6182778403129112958ULL,
+        3618149595234735038ULL, 1382555424443672510ULL, 6729559092297790398ULL,
+        1837581255895327218ULL, 7141180911605972640ULL, 1024400882325335378ULL,
+        7878302514686207316ULL, 2353804961870401920ULL, 1764040905252678272ULL,
+        66542352880527170ULL, 5574188632547246267ULL, 4221721354386963881ULL,
+        4970142076594822812ULL, 1111130860405075338ULL, 2851916347303023837ULL,
+        7177297034576404693ULL, 2762859486578280938ULL, 7694516205361751380ULL,
+        1017843779229763157ULL, 214586247321145692ULL, 4755321299628340670ULL,
+        1225530463722871453ULL, 3949944326576097441ULL, 4750817929297104228ULL,
+        3733654481423442690ULL, 8495160119242333503ULL, 4544145267994762475ULL,
+        6969771364315975766ULL, 5401865305313582952ULL, 7914882983321191814ULL,
+        5683568030155312663ULL, 7611545533232435818ULL, 7159965021479682884ULL,
+        3536949046972015987ULL, 5276211897727063891ULL, 269641233287029560ULL,
+        1159057186589994053ULL, 6291257385882073760ULL, 5595191496837629476ULL,
+        3246324758432417732ULL, 8451579130799255415ULL, 2901150136026442366ULL,
+        5105549147407401106ULL, 2313904499067377317ULL, 6974424483054212457ULL,
+        8869375896197251978ULL, 2115693672650299213ULL, 874708352648764286ULL,
+        5840321902934490778ULL, 825031434427478757ULL, 7670615157463084390ULL,
+        6388585848239651819ULL, 1760855901512348257ULL, 6714704656745371263ULL,
+        520829358052590946ULL, 7809745875571658651ULL, 74173875966303218ULL,
+        875420303214863719ULL, 1322133882281634584ULL, 6090278978024941364ULL,
+        6499209222749691058ULL, 8462018926556460823ULL, 3878514867664248028ULL,
+        6150794735694257791ULL, 4279068741347759687ULL, 8844351786536085975ULL,
+        689394879200376302ULL, 404850488907443356ULL, 3193873752003981370ULL,
+        4636966852159969130ULL, 982960658915501991ULL, 2447117896226477624ULL,
+        6879165777062161009ULL, 5899232062019704936ULL, 3297247582561725757ULL,
+        8723645115393288001ULL, 4234123875964101440ULL, 7541776174351451213ULL,
+        8551492090614995472ULL, 5021383510600664219ULL, 4178174430816934194ULL,
+        7978066284362253391ULL, 5069159081057523415ULL, 648532554990791208ULL,
+        601041372449100301ULL, 5163624178610756978ULL, 615247028093851326ULL,
+        6810209910080142625ULL, 3882833542157269461ULL, 4824303458541540782ULL,
+        873888233103715790ULL, 4071253160845620374ULL, 6557912465683969170ULL,
+        83825561945591096ULL, 7309407938917559938ULL, 6193145987591799195ULL,
+        6779492020886082160ULL, 3277574775204521628ULL, 3406212169729791424ULL,
+        8274015559470436167ULL, 6118581457748279728ULL, 4622463799261784857ULL,
+        2549428913367328310ULL, 3891600032698249242ULL, 6711649076716541222ULL,
+        2842804312953091070ULL, 35599743268522221ULL, 4006543319774601905ULL,
+        6201568111138247253ULL, 5186401736238788215ULL, 5698203125907960075ULL,
+        7285375770905969166ULL, 5490896214837211505ULL, 575369099639905272ULL,
+        6721652358910452907ULL,
+    }},
+    {{
+        5688261162572708332ULL, 676571095016997714ULL, 8835705212777522027ULL,
+        1019640516645808582ULL, 6710338172167757495ULL, 2527976808309660872ULL,
+        8260013235068283640ULL, 4150044471955021218ULL, 6547013307826148366ULL,
+        3349608887047393891ULL, 265987796624889668ULL, 690776328369565292ULL,
+        1682833490664046868ULL, 5119457890836252747ULL, 1295677212677476876ULL,
+        1390663672086872893ULL, 797970426853226105ULL, 1935600749719107441ULL,
+        4110328238522498561ULL, 6889607629340908953ULL, 8108265329402085915ULL,
+        6878607622410509423ULL, 8948431964973009290ULL, 84862743739544477ULL,
+        4713440207263917055ULL, 7715130321626551825ULL, 5524648223277293706ULL,
+        5650656526819953226ULL, 7064351876763764167ULL, 2034576248633713284ULL,
+        4973477398231613022ULL, 3016541355929430129ULL, 8104798495193125711ULL,
+        2290141773567182136ULL, 4972744379746363400ULL, 931360233199177158ULL,
+        6606294672716647096ULL, 3745236427863235760ULL, 8295022824043268874ULL,
+        6840037359604822167ULL, 3918600288421590691ULL, 2540338753408755960ULL,
+        1750733866307538978ULL, 4688104963245717081ULL, 5732720226588573468ULL,
+        9065062842758194508ULL, 2029329215986250580ULL, 4536955449765241153ULL,
+        5098468246124188525ULL, 4763023073921577850ULL, 8771424716464424082ULL,
+        7878366608741516531ULL, 7175245913754875549ULL, 3129952309700864725ULL,
+        3394600852949821006ULL, 11776374332510174ULL, 5078241591038549696ULL,
+        9051965820016986734ULL, 727120354252577730ULL, 997352971957261059ULL,
+        1604629403810666999ULL, 7203843058252910628ULL, 2544325940016138379ULL,
+        8690682847559829851ULL, 6346916714754955574ULL, 3338973038927974426ULL,
+        6617456307444593781ULL, 5518914677274130269ULL, 846844275223610617ULL,
+        1071853802210900298ULL, 5449765361937700270ULL, 364653698424235061ULL,
+        8556307743347033207ULL, 4508563582805233323ULL, 937957095036400557ULL,
+        4989375658334271377ULL, 1345869252581040761ULL, 38641384079235359ULL,
+        3216786680372630828ULL, 7933083099600756940ULL, 1980681616132241471ULL,
+        1570299342308396347ULL, 7036973049023560710ULL, 2463614036775065279ULL,
+        5222703317653284399ULL, 4525161858187219634ULL, 8042795339996988367ULL,
+        3101074489314366651ULL, 2087168110206062588ULL, 4207405260127963791ULL,
+        2903721878326788072ULL, 86063505182919474ULL, 1207453232670111890ULL,
+        920870542113731871ULL, 9014915623869694478ULL, 2669968608737593286ULL,
+        1258121178713254989ULL, 3083113173426903346ULL, 2019559028627279902ULL,
+        6830649394044071132ULL, 6090801077712316901ULL, 6660032027146307158ULL,
+        2787256737712091565ULL, 6571504918545102419ULL, 3050955147723039668ULL,
+        7197781322377104921ULL, 7372925590549088905ULL, 3999355130297489729ULL,
+        5102740460478768304ULL, 7446099369880048112ULL, 8453033942926205298ULL,
+        2216684267667510227ULL, 1881703612587273256ULL, 2523798822786248601ULL,
+        4268617083304449089ULL, 5906580771321434360ULL, 308849317188042803ULL,
+        8216814884602059207ULL, 8895308224409060691ULL, 5107237853259016935ULL,
+        2451227393362547822ULL, 8933973235292746431ULL, 5022476988966711524ULL,
+        3679977740283990151ULL, 3159721862720976796ULL, 5671698367417902560ULL,
+        8400582403810117331ULL, 7995257064621983654ULL, 6414966392511346618ULL,
+        7742712600874756498ULL, 1166210906073285368ULL, 8291383352323505228ULL,
+        230529967479725978ULL, 8619607185745581702ULL, 4897899464696215364ULL,
+        3720977034215646382ULL, 7232103761990980086ULL, 5362861609127662278ULL,
+        8761259887012178669ULL, 3759622797086148861ULL, 3400248754816871125ULL,
+        8818379142445967158ULL, 6469846626363111525ULL, 6399966181539085320ULL,
+        2025595452630469012ULL, 7639318189117264618ULL, 5254220981067229986ULL,
+        3844561895004285262ULL, 6561724719857630949ULL, 4470598260891078808ULL,
+        5231717244739858681ULL, 6763777265126079993ULL, 6987856074622738684ULL,
+        236949186140160845ULL, 1633227230721765436ULL, 4829593940276246426ULL,
+        1389085253155617697ULL, 1576773125221377983ULL, 285971736386299357ULL,
+        150838884916989613ULL, 8338688004837803973ULL, 8982399051076426922ULL,
+        6873590317432983866ULL, 7813481483588680170ULL, 4006539269622009720ULL,
+        5746428313674255069ULL, 134046309188373523ULL, 965801555575219642ULL,
+        6549009086136996818ULL, 8243423631946535585ULL, 2410705002152474103ULL,
+        5491404501594015304ULL, 1800643089503242924ULL, 6010283157715286676ULL,
+        2590551857615622660ULL, 3386465184531877078ULL, 5172059473118566156ULL,
+        3593137191803995714ULL, 751535437778188220ULL, 2934112684129607994ULL,
+        5358290745795302655ULL, 6365014163477287326ULL, 7717821613669947199ULL,
+        5902470971092281524ULL, 759059417740069157ULL, 6259735469739612647ULL,
+        7882676083296720978ULL, 68801965386232941ULL, 8566288993512222881ULL,
+        213345619751056160ULL, 3988321903062811407ULL, 1077173914040764958ULL,
+        5224550448530083466ULL, 798379581615160033ULL, 8065121917706880513ULL,
+        5406446436422853756ULL, 3486756015638349312ULL, 2980090453926553695ULL,
+        909128664468619979ULL, 8282699328058133256ULL, 6340873010093695057ULL,
+        8195417634420764882ULL, 3775748578277446282ULL, 2222035704064178039ULL,
+        4500159851653497742ULL, 1307351996077389282ULL, 7239841807751098412ULL,
+        3514486600234391428ULL, 4441506253906040843ULL, 7900545401984610614ULL,
+        8230209632640902645ULL, 7509020034353665585ULL, 5537715163837352705ULL,
+        4769118601044318983ULL, 4865902758418962633ULL, 1293674780149019924ULL,
+        2805412789842154268ULL, 2153902200112832825ULL, 332655855607144607ULL,
+        4182962263083694000ULL, 4443614702125796793ULL, 8725028721282163221ULL,
+        5554375419013190804ULL, 717344967946897866ULL, 4914097187953722787ULL,
+        6152453341500646681ULL, 8479383167818039715ULL, 8149561017162766052ULL,
+        85278116686851648ULL, 3923802993753105200ULL, 1439190481805668118ULL,
+        3199078681827876855ULL, 2020788184119713056ULL, 4948978138596188811ULL,
+        6193965879397436438ULL, 3853162639224341061ULL, 2921141419725794985ULL,
+        3448437236393995803ULL, 9075496757765086994ULL, 4981021267299562647ULL,
+        6313316624179481414ULL, 1504415734619035298ULL, 3983002305062205304ULL,
+        550754955253110707ULL, 4683459882638964606ULL, 9201646543954915850ULL,
+        6148459199654416684ULL, 6263067202145295910ULL, 2849741447195831554ULL,
+        4322360122399428543ULL, 8289399765775783061ULL, 6630113564990002021ULL,
+        6960507869030737824ULL, 1439750492741790976ULL, 5801125290175162691ULL,
+        1466159232945396165ULL, 1242830234671266616ULL, 6184525591157616620ULL,
+        430493268892025457ULL, 5816264812520679120ULL, 1980131737303492646ULL,
+        337343086426842610ULL, 886223518881604089ULL, 9184187510572355181ULL,
+        2270482511407246576ULL, 3854607056040323271ULL, 2659798738459693750ULL,
+        7918387623535202572ULL, 6516457404115984977ULL, 8039894544692181110ULL,
+        6858331367918325372ULL, 8402155382965730550ULL, 3349460333806674888ULL,
+        1786042444316331627ULL, 8902282520123589084ULL, 6208467774538695201ULL,
+        1154723702125372161ULL, 7210901710698988299ULL, 7513869558923808121ULL,
+        860871259933063099ULL, 8459623176237836354ULL, 3364086975245767725ULL,
+        8544741531952186411ULL, 8637306782562555261ULL, 7879656268332578499ULL,
+        8851976087538389957ULL, 7577491341156670038ULL, 4788730011056145752ULL,
+        196231657908427895ULL, 1653306970592673514ULL, 3578033953164384472ULL,
+        7717643098061106424ULL, 9093127896201421185ULL, 7613849928615610373ULL,
+        304524338248869394ULL, 830804391758668508ULL, 2068827427090722399ULL,
+        6465115471031755840ULL, 5056638621426305918ULL, 1893994480754004278ULL,
+        8369285887579865030ULL, 3970258948764673567ULL, 330020227389789414ULL,
+        969082322774920651ULL, 7723136789778633143ULL, 5004459803975905500ULL,
+        4378443572091718168ULL, 4929111036535239882ULL, 6445952113670536221ULL,
+        7196095597825967139ULL, 8948893928262038841ULL, 3264715800039886660ULL,
+        8894708230753279728ULL, 244243888901891654ULL, 7550829041314826089ULL,
+        8298886330221852354ULL, 6277856794341894910ULL, 8889914091717444041ULL,
+        4615216381852015061ULL, 8764092899411060950ULL, 3077042069523412977ULL,
+        1069946335449683317ULL, 2197990879057869497ULL, 24398174028162760ULL,
+        5275629908515327352ULL, 750115188044406145ULL, 5303589323675920637ULL,
+        3452665113290906220ULL, 3573831837670525151ULL, 1720095175784270061ULL,
+        1245271907691736033ULL, 3205372663762345264ULL, 7736485540576867980ULL,
+        3440655874046189562ULL, 1408682049169449368ULL, 8927924556104266479ULL,
+        5995524025187083135ULL, 7484416937043046755ULL, 6717591367215114831ULL,
+        391694609410840194ULL, 1049873562248323823ULL, 7811341990227115325ULL,
+        4935616532874466484ULL, 9032228604991843639ULL, 35423797237253628ULL,
+        2680541050170561384ULL, 6744556323182201085ULL, 1945301680630851492ULL,
+        2663529284889129364ULL, 914145249701271565ULL, 7411317241176616586ULL,
+        1712926162232083734ULL, 4138064682874175338ULL, 8911411930713396750ULL,
+        217389640067095451ULL, 5541237768132596356ULL, 1348761682130109212ULL,
+        5508925708903101630ULL, 1477467345653420634ULL, 6561266100610447218ULL,
+        6776456577955112033ULL, 1203170551425141520ULL, 3745320258266465867ULL,
+        1507907385363924284ULL, 2869538078606223750ULL, 3048105618767096912ULL,
+        2229222032504682956ULL, 7113567983362628721ULL, 2720177528013197104ULL,
+        6985111355049966713ULL, 2565477536776676851ULL, 2368491391958994077ULL,
+        2714200113236957518ULL, 4444228413355172470ULL, 1305819236706046482ULL,
+        95301778798542931ULL, 4132205437263344984ULL, 8088256856301194335ULL,
+        5486199355808155991ULL, 3525433165967789682ULL, 4443813768610605041ULL,
+        7159431496789649359ULL, 3515383721249434799ULL, 2739312913811675763ULL,
+        7757319871348015798ULL, 1756936637873525388ULL, 6284300315455150022ULL,
+        3971920566943112466ULL, 6989607236656466137ULL, 4472336567865890298ULL,
+        7395133154877826998ULL, 599772779558086406ULL, 3395638106483630883ULL,
+        3495852128316631350ULL, 453777756325977316ULL, 3277552852392607510ULL,
+        6923314299646930353ULL, 8929426661445024513ULL, 4537388646588666566ULL,
+        5810826742839109337ULL, 8762383977307011519ULL, 2474023458057495057ULL,
+        7918501407837927951ULL, 5997769922992803147ULL, 1526308190567792797ULL,
+        7919798579553460219ULL, 8696857964548126651ULL, 2759121188066444784ULL,
+        101263460459260533ULL, 4771160376694976976ULL, 1488229369195621269ULL,
+        349160246341698300ULL, 4478960370690315939ULL, 6362524325478995476ULL,
+        1973340101641089208ULL, 2510376674712791880ULL, 273440945916052977ULL,
+        8516371045121991536ULL, 3897553500316341693ULL, 4376679229137963392ULL,
+        2447589668414157162ULL, 5428424760959400854ULL, 4694488641696042054ULL,
+        8175225766515172830ULL, 8228006286965068731ULL, 3365496281690038801ULL,
+        4520263306440509309ULL, 8411473177790059380ULL, 7164496047285581719ULL,
+        2809147775027965984ULL, 1012302698063518544ULL, 4768880234458854979ULL,
+        6947396760666636689ULL, 5723436495849955968ULL, 4518174808423852611ULL,
+        2875892287980250887ULL, 5330103165201409834ULL, 1922195760971924721ULL,
+        80981626149510333ULL, 3179476542771260619ULL, 2025641232585553513ULL,
+        6179154461751516841ULL, 3351935468833298039ULL, 6274480496177610510ULL,
+        7961459724363855067ULL, 7871168697363704788ULL, 5804579954535676688ULL,
+        7642886024869391074ULL, 2749783393299241972ULL, 7843370617295582699ULL,
+        7120773974832769049ULL, 1486033045232808954ULL, 7353689241819933884ULL,
+        8062984933215041644ULL, 3665931263074757999ULL, 5321597818997699829ULL,
+        3032384210731543578ULL, 7500759414479402184ULL, 8716969026187252290ULL,
+        2150171249083477003ULL, 7872039438330176988ULL, 2507516038712700113ULL,
+        2018975079200100980ULL, 6498210991393713006ULL, 7614542999442451037ULL,
+        6488494818289817467ULL, 5081044043216550972ULL, 2039844071009668266ULL,
+        5148477520915722782ULL, 2740651230331057242ULL, 1676919162899529947ULL,
+        4870325238037179969ULL, 3097908099853114691ULL, 3053775003910949149ULL,
+        2798136135577487693ULL, 132729912744499201ULL, 7564296671921845676ULL,
+        4140905433297611055ULL, 192622478812410990ULL, 5328961258396817089ULL,
+        2696602819169009819ULL, 7677956085424821031ULL, 5881505168928419890ULL,
+        4753773936645233389ULL, 6042816117202943914ULL, 5546162845272026800ULL,
+        1948367511333624924ULL, 8374522579081762575ULL, 2809349379945513365ULL,
+        48998023633643886ULL, 8954347355532897009ULL, 5764910830982868025ULL,
+        4628248536730342412ULL, 6114822095055353896ULL, 7671691931519593400ULL,
+        7548585462170174751ULL, 1735010964670448642ULL, 5777934091723813453ULL,
+        135197573038713818ULL, 3139006740814058797ULL, 7734119993156431857ULL,
+        5300846732521166501ULL, 3847737859275722384ULL, 434893781604506573ULL,
+        594671711823617614ULL, 3667064180795007353ULL, 6702965304408057814ULL,
+        8397627081739136000ULL, 5453389056590852633ULL, 1065825370208494939ULL,
+        1192582723568426782ULL, 9116514412112247270ULL, 6753604883609926147ULL,
+        1111962012931867025ULL, 7805224359075584680ULL, 616734697817153020ULL,
+        7476623619751388122ULL, 8593379631036312395ULL, 3536690768849931197ULL,
+        7459873226029810970ULL, 6068248968115154214ULL, 2689956391136245979ULL,
+        3057121066444996124ULL, 8575538275614763555ULL, 7111849430046208271ULL,
+        5049981031891790896ULL, 5124062766320765321ULL, 5668769961505191313ULL,
+        9210847265096874574ULL, 2377119977853738765ULL, 3623409505678530630ULL,
+        3616016844603313809ULL, 2222341840148552914ULL, 5985683568334546008ULL,
+        7585249083155553300ULL, 3279956251256311373ULL, 1528009082884467590ULL,
+        306328308919441563ULL, 1513348954548021513ULL, 883951634888668351ULL,
+        4710841605995855226ULL, 7630984029259757483ULL, 6906224274633544592ULL,
+        279946160530305613ULL, 3578045137411501781ULL, 5607589266804821706ULL,
+        473130117778392234ULL, 8733950003013853102ULL, 3128150188745138385ULL,
+        4294309193738607600ULL, 5664901929467941140ULL, 3692097501157406146ULL,
+        807484178259536681ULL, 1653673522351590700ULL, 6380572634222651080ULL,
+        8366644429284565555ULL, 3025925985696630405ULL, 3679257253112916510ULL,
+        3791542673521410825ULL, 5679715652166309245ULL, 2363423883590789530ULL,
+        2040601488547457072ULL, 5189638397079153766ULL, 4712614593018845983ULL,
+        6812793477304517041ULL, 169046031471372107ULL, 6333556956747740795ULL,
+        8646594564010612827ULL, 160645984521681051ULL, 3231209341921362283ULL,
+        4717415105318437085ULL, 766360666258877483ULL, 8940447885080742073ULL,
+        3940236951449517629ULL, 2815941574545781098ULL, 2593758312799992073ULL,
+        8549639329241945888ULL, 2766459236162683944ULL, 212903071579850893ULL,
+        8771131053987731603ULL, 1538008321371992096ULL, 5746513198290876701ULL,
+        8909329226547853645ULL, 4330025798376255028ULL, 7888501680041594117ULL,
+        1960259421996471364ULL, 4559573970151158031ULL, 4584493170835314286ULL,
+        1369264215434261953ULL, 3549777755873019321ULL, 6262238286386202604ULL,
+        4322077359428535378ULL, 4666003682777900541ULL, 33489220846692638ULL,
+        6578543094504371152ULL, 9034331304785199747ULL, 6798979452546517982ULL,
+        2302947576059791508ULL, 9028979647966583013ULL, 5683931201323427781ULL,
+        3497214043641078111ULL, 8673477983503351509ULL, 7537664263122324845ULL,
+        1825697247932998768ULL, 6378416446250163357ULL, 6929221660206690430ULL,
+        136266857111976950ULL, 1283184763863787363ULL, 4215137412232808813ULL,
+        1702637245298901552ULL, 4391934215082407973ULL, 7112019032846097174ULL,
+        6644294183338085302ULL, 268147698302089838ULL, 8833022905748023982ULL,
+        276637843060617330ULL, 2674286172701762245ULL, 3429274246844268417ULL,
+        8190203285536641861ULL, 949354901966510623ULL, 8909434533721296005ULL,
+        6262663818727445948ULL, 5856175124381501081ULL, 6527082421784444111ULL,
+        2431743476210106631ULL,
+    }},
+}};
+
+inline constexpr CodeTable EMPTY_CODES_HIGH = {{
+    3402482765558156403ULL, 928651228689757196ULL, 4779311172075488092ULL,
+    2987329841995924688ULL, 406202347876396402ULL, 5609810935789896536ULL,
+    2095084075095095127ULL, 7061511972084783197ULL, 4959046902724777895ULL,
+    1809693830996339219ULL, 6460053021593058602ULL, 4254571250030250886ULL,
+    25652765831035982ULL, 7207918179428546164ULL, 2391341468672627353ULL,
+    6866616586692463790ULL, 5469965987790880727ULL, 7395589003244560049ULL,
+    8360810726083633409ULL, 2934767742844147771ULL, 2187304700220670212ULL,
+    118181913237724725ULL, 6974642876937439318ULL, 3844778190978061849ULL,
+    2787040180076085903ULL, 1793133321381728850ULL, 6024523615306020347ULL,
+    2565888037179840884ULL, 7120395099865587751ULL, 812243213118859147ULL,
+    5752716313013934332ULL, 4196440188162508920ULL, 7001735289736944884ULL,
+    3319712420692402890ULL, 3131167603218059711ULL, 5989985210108462080ULL,
+    7851712939149828042ULL, 8168540778217820253ULL, 3583792384501532272ULL,
+    8396199851941069304ULL, 6788429490329568522ULL, 7174224735040601643ULL,
+    4385904774555057479ULL, 2820233098337162517ULL, 9189847203993342390ULL,
+    2505547683844786554ULL, 1072075034022416079ULL, 4543185678464781305ULL,
+    5697348877758943550ULL, 8063985408511707375ULL, 886270128410474063ULL,
+    7260117171178379289ULL, 7719702749954558418ULL, 6027452217534035539ULL,
+    2105129180099382534ULL, 5461543808677177313ULL, 1448644188067962202ULL,
+    682790346797349102ULL, 7432841803480724493ULL, 6683151388581065402ULL,
+    2934454013620861292ULL, 9010020329855232891ULL, 2881784779574435171ULL,
+    8407076778131411827ULL, 4353915817648846675ULL, 535374396526872394ULL,
+    2147490098668744296ULL, 3594046478916678318ULL, 8533741625181983934ULL,
+    2185319989685651583ULL, 8349163275816947200ULL, 1762168657640601743ULL,
+    1542488171473782945ULL, 2100911883612181745ULL, 5156331328155703360ULL,
+    2936382530470431561ULL, 5023435205043256379ULL, 1322267206434930366ULL,
+    2579155571448511474ULL, 5159828427322348026ULL, 1241286028773686096ULL,
+    3527449273625239044ULL, 2145382054633623781ULL, 2148750632733973840ULL,
+    914702005938967458ULL, 6731269201239016984ULL, 6189492167105413134ULL,
+    7877565236672127168ULL, 6732312841251152036ULL, 4989954063511040332ULL,
+    5472535879799088998ULL, 5300035683443196463ULL, 2322357746589679780ULL,
+    7391823785753131571ULL, 5477595284225002015ULL, 8123760644695216031ULL,
+    6143889788913500332ULL, 4445648039495482902ULL, 2933781416403718341ULL,
+    5262563247664483749ULL, 3097356432596939095ULL, 1661804794813853446ULL,
+    3175428894675447706ULL, 7014263778478036414ULL, 1139883714813405567ULL,
+    2293950772707950863ULL, 283586419638423357ULL, 6182422072622018191ULL,
+    5869426057554590070ULL, 3851241516279835023ULL, 5596411403380479043ULL,
+    5296158090789997423ULL, 1125456990741993177ULL, 218590407383231178ULL,
+    26456178272905056ULL, 5039280078883201375ULL, 8105683576046909210ULL,
+    1734595333508967261ULL, 2500588931016301231ULL, 6556881322684464464ULL,
+    8375012215926920091ULL, 1218034269994257811ULL, 1191238961775337755ULL,
+    7740624968461321828ULL, 2881296096081640610ULL, 587617394059092588ULL,
+    7915646933976818883ULL, 4226508514156510397ULL, 8911844407818156168ULL,
+    6600012238658852427ULL, 8602783243529775304ULL, 3689126994049121488ULL,
+    8319987004899322785ULL, 1253733717288413509ULL, 4887203108681523388ULL,
+    717170831650785768ULL, 6616715704219604589ULL, 8502752555827334375ULL,
+    5086912771556270669ULL, 2836812808584047886ULL, 2678813721540222696ULL,
+    4197182646224931518ULL, 3680504637440840899ULL, 1130996681991234548ULL,
+    2145809663712426000ULL, 797183361731681702ULL, 4321699215051634330ULL,
+    8116604606257748571ULL, 3689405496297256660ULL, 1624992115419199315ULL,
+    176024345546711141ULL, 3429595193896057407ULL, 3428522665374971867ULL,
+    9143704490484069203ULL, 4861215374827589293ULL, 6602732204587746256ULL,
+    5251685151366348544ULL, 6069241243671803684ULL, 5472358275425562818ULL,
+    237298325258591402ULL, 6655845837635949147ULL, 2457710587477893186ULL,
+    6336556403323574277ULL, 2707862549336070224ULL, 5135318792667715276ULL,
+    6316334259069550554ULL, 1149863578355865005ULL, 7109579472199114934ULL,
+    3084538697448311524ULL, 2266112459970642974ULL, 3479601685661171432ULL,
+    3799632458072542910ULL, 5228003825266695168ULL, 9137283130719431918ULL,
+    4350338564057349677ULL, 8409151519972527900ULL, 9164906961878477812ULL,
+    8206738226660955750ULL, 5306226788645133047ULL, 5802278894224826073ULL,
+    8088823321055032257ULL, 3720244966493918471ULL, 6341591289809644359ULL,
+    883759766431423300ULL, 1895571500352564667ULL, 6163847025330899039ULL,
+    2200502725869511936ULL, 1088209203774050929ULL, 7297498960886110938ULL,
+    4110483096399491618ULL, 7248381050846962160ULL, 3255224735473236867ULL,
+    6915830984117433383ULL, 3467746717222927182ULL, 2974558925593633613ULL,
+    219915270841053691ULL, 9175191055382894791ULL, 8799548185987062604ULL,
+    9113576455155324067ULL, 867376561945840329ULL, 2982073054972405042ULL,
+    6901687763677180687ULL, 741785197905250562ULL, 2001310964531136786ULL,
+    1591454102984568957ULL, 195871789220544242ULL, 4450906084077156722ULL,
+    3670811050803790070ULL, 3639001537542869050ULL, 7933654374348097928ULL,
+    6935977619192022024ULL, 6764322648134008964ULL, 2687136793395581082ULL,
+    2637900453483447592ULL, 4678427469404290099ULL, 6027282274094395715ULL,
+    4809225528685653151ULL, 7898870529484955269ULL, 8176198628846295551ULL,
+    7439332479839255804ULL, 1555440836269578062ULL, 6861718958340621640ULL,
+    5961420762436601496ULL, 7766033717156917022ULL, 8490631165129255408ULL,
+    5381113103239010561ULL, 1102505539639528884ULL, 1821796306066908301ULL,
+    8653546886548162523ULL, 8060898982085972823ULL, 7849748039038407505ULL,
+    4213354092230179833ULL, 2918721524758504460ULL, 7771020270516991851ULL,
+    1791689871804368801ULL, 2323279655641308671ULL, 5534717597990639553ULL,
+    697081091447449200ULL, 7877355788858772881ULL, 662271916044443229ULL,
+    3027361025129557378ULL, 6649792869538192783ULL, 8219108038772745634ULL,
+    1833782481412169296ULL, 7405352879122523015ULL, 659622663290057470ULL,
+    6762542609541219898ULL, 6908778081228587158ULL, 8390293768783932309ULL,
+    5164404024226190412ULL, 1323861052943246752ULL, 323016637396565418ULL,
+    3060358213136652148ULL, 4327527740223005060ULL, 4419788195103040905ULL,
+    3476462365521622288ULL, 4706370381027861884ULL, 6494231194597479187ULL,
+    3264915962480620958ULL, 2315481907604740729ULL, 6671063272370235553ULL,
+    815538995725130472ULL, 8550848637664918810ULL, 7190912612155933041ULL,
+    1398256862815301336ULL, 392079405313107691ULL, 5311533386548438862ULL,
+    752288518555571805ULL, 6108611703129306078ULL, 444128895690902022ULL,
+    2691807001655088503ULL, 4034674228260416444ULL, 1449863099863091050ULL,
+    3617602120016988181ULL, 3306805381758971983ULL, 7770988123319514597ULL,
+    8056621746960611009ULL, 8676038159145771398ULL, 8845380939684366645ULL,
+    4530431783350824867ULL, 3597531215282953228ULL, 8844767464035904835ULL,
+    9122300433708259680ULL, 721728586680675613ULL, 3240681490556298041ULL,
+    4945138322803913066ULL, 7505987494471766878ULL, 6060763693863327876ULL,
+    8679661591113611043ULL, 8442618722896102302ULL, 290761028359157405ULL,
+    2795372059051294363ULL, 3424793840273423460ULL, 5451155605297648725ULL,
+    3324406980716847413ULL, 5690457822031893923ULL, 8821749047858735385ULL,
+    2258667698753171402ULL, 268812496906682316ULL, 4987376624974794814ULL,
+    1723421583858817514ULL, 8470401477827634165ULL, 6413552200609680878ULL,
+    8414596255413982822ULL, 8642859225096154781ULL, 1899713253430759501ULL,
+    3814688187102044261ULL, 6524825680332037640ULL, 5043176451705493224ULL,
+    7170823246704778101ULL, 5628907585460365347ULL, 6957285077337857404ULL,
+    1384074536282764270ULL, 3709379647562320572ULL, 3757734371203401441ULL,
+    4524132982346890816ULL, 681446510070167830ULL, 1068904252518765357ULL,
+    180524560153039240ULL, 8434479139306361675ULL, 6042942337520459286ULL,
+    6375668724507574068ULL, 1198129608355532697ULL, 283563474096099494ULL,
+    4501805925816162651ULL, 3063580708390107733ULL, 3775441484255219822ULL,
+    7835429254020067356ULL, 8498110138608846765ULL, 6149655454152422083ULL,
+    7230343041080335418ULL, 7651134980377654371ULL, 3451926664617187560ULL,
+    1188154038910693759ULL, 2771628265481414728ULL, 9107462879866943984ULL,
+    6724542343919699716ULL, 6459830910911995205ULL, 4556068605404599223ULL,
+    2076096365396622275ULL, 580466596854669802ULL, 8434625085832394643ULL,
+    6893288767699829800ULL, 8104448083773232065ULL, 8520615275426757421ULL,
+    688464693603165875ULL, 1402260904651631172ULL, 7902147247376915950ULL,
+    2496214494284767766ULL, 1466982059302624822ULL, 6221478955444993875ULL,
+    3380637642776461756ULL, 1479628868626208097ULL, 5915443239690850985ULL,
+    8266173388341783546ULL, 369783112189908361ULL, 3968372341924173960ULL,
+    7367157524960284082ULL, 8503704443543634972ULL, 8840414864380124688ULL,
+    8652870851209358373ULL, 5168092727858944463ULL, 7823930494455350560ULL,
+    1968337520921948173ULL, 8848521748912498776ULL, 5304646050437859319ULL,
+    5693131355206558423ULL, 5846604926142584920ULL, 3487968667693069044ULL,
+    4902729344916794072ULL, 6965092215399442701ULL, 932286195506493128ULL,
+    5985637685818074624ULL, 6844174982052323011ULL, 4720257722161355114ULL,
+    3614434757619170237ULL, 360181555636296489ULL, 3056925031290347380ULL,
+    1083537959937338450ULL, 8942101699753354711ULL, 5432718022890814251ULL,
+    4286345340930253899ULL, 825488802263077002ULL, 3006178650585527419ULL,
+    2324289405721340164ULL, 215796727564117037ULL, 8209522240925710999ULL,
+    5575682029170252226ULL, 8739998891729482343ULL, 5634075655136610735ULL,
+    7266622407718491586ULL, 2969019543867398198ULL, 3868779650872969773ULL,
+    2774229973673321777ULL, 268980184917330681ULL, 8085412411049437934ULL,
+    8036278804647424746ULL, 5424827805037206786ULL, 8036310152623576288ULL,
+    2467114949194887848ULL, 4781353284796355502ULL, 4071511529295832835ULL,
+    5226687269747148366ULL, 7800818382889800951ULL, 6434994843306634678ULL,
+    2773072064812535871ULL, 6863171380558429948ULL, 2621146846752272574ULL,
+    1395899481787345174ULL, 1951302708471798734ULL, 6707002790337889374ULL,
+    401140769638235197ULL, 6831741714406302639ULL, 7519701130102401324ULL,
+    3361411785648894237ULL, 7489415758704834465ULL, 5974287377900988969ULL,
+    4363027554531398682ULL, 5201291057866389398ULL, 3920555719810665899ULL,
+    849511394629150805ULL, 7426159507577964717ULL, 1370952995079303661ULL,
+    6712321063896438244ULL, 5271036835732495569ULL, 4690620421662155067ULL,
+    166093087328340228ULL, 4068443994726493244ULL, 8787563752336179652ULL,
+    7836666879427310659ULL, 2396584636061021757ULL, 3817388682295040083ULL,
+    1918805050614485007ULL, 7959661547581742326ULL, 7584253902320735751ULL,
+    420987813292976855ULL, 2472512350652029762ULL, 3991392051168260063ULL,
+    1475973312856458367ULL, 941429494350467939ULL, 3033455355525229811ULL,
+    5065669319777244662ULL, 4725555423856148083ULL, 6483547207539875086ULL,
+    6658070057043439935ULL, 6040970038848217177ULL, 5582406145984429447ULL,
+    1420249213246684768ULL, 5969120084500559353ULL, 700310558506890996ULL,
+    5204195399607230839ULL, 8633255561976044628ULL, 3856173376971033286ULL,
+    5157446577965591485ULL, 1702095277478327334ULL, 4457653622195290670ULL,
+    959426098009840199ULL, 1014540154963593814ULL, 4080311531597791257ULL,
+    1854796978307947889ULL, 4988542732295515029ULL, 2723915954055681142ULL,
+    3167696967701323970ULL, 3080222888130330729ULL, 2645634781045083614ULL,
+    4408521534602563899ULL, 4269368182186264724ULL, 7628039280437408735ULL,
+    4929480348323107333ULL, 2388579109967967842ULL, 9128318512380030051ULL,
+    5735944688663591541ULL, 7702896215409541478ULL, 2737224630531296206ULL,
+    4375161985466309408ULL, 8962878040033753831ULL, 8658426752020504502ULL,
+    7796876638965317057ULL, 847445060274198363ULL, 6529772815974238087ULL,
+    6649079757636557187ULL, 543883057138483513ULL, 6830435225513160620ULL,
+    779375444261953070ULL, 3781824161776856700ULL, 7566946933540815298ULL,
+    5442254124212158763ULL, 8753960446102672968ULL, 971246629617341640ULL,
+    1956501394067957261ULL, 5596060565966006202ULL, 1482586726696314663ULL,
+    7337023198789416680ULL, 7016925168180675125ULL, 195634360110784832ULL,
+    7990055724619185379ULL, 8964094009777193075ULL, 2368998367630545979ULL,
+    3324540765833546162ULL, 1406360962419936136ULL, 1068186762672765539ULL,
+    6951332441952558626ULL, 3853784500566320584ULL, 2604888510055764970ULL,
+    564411982811941153ULL, 1102826057442691791ULL, 8131895372249642031ULL,
+    5286025553078513824ULL, 1250825117549800110ULL, 7143261880971028454ULL,
+    3870989068393550194ULL, 5167756785049619352ULL, 761585039189665875ULL,
+    9001813057401726348ULL, 8569030158494162671ULL, 4750162392606762610ULL,
+    7878589134296648925ULL, 131446362813996072ULL, 53608006385070521ULL,
+    7607852689510379462ULL, 7609569083612051701ULL, 5839868342489746310ULL,
+    435775399724718655ULL, 2490785927208575278ULL, 7463989424454085779ULL,
+    8269246913054548890ULL, 8870131398921086449ULL, 8315520002089048926ULL,
+    5569158785426111965ULL, 553783194909862320ULL, 1505572679716026770ULL,
+    4693636691224472780ULL, 2624945864206473076ULL, 179812485697252429ULL,
+    5620751816577443028ULL, 577905063229959991ULL, 8304866436531917275ULL,
+    3896729427142385545ULL, 4295054677456870461ULL, 3755628215663824590ULL,
+    8197425913764747629ULL, 1043695806070794594ULL, 104234953090769874ULL,
+    6595467220724209208ULL, 4085478403995129061ULL, 6427288473557571098ULL,
+    1696225102384992085ULL, 6949410771095981994ULL, 7273565779158752721ULL,
+    7474134166909805470ULL, 1798564915672385916ULL, 8146048488077998812ULL,
+    698016730518331738ULL, 5313865612404524162ULL, 4722630267518767018ULL,
+    1583032484011094721ULL, 925777447655643129ULL, 6089492255875734299ULL,
+    1436665997933736083ULL, 177967103605510428ULL, 421176175957516726ULL,
+    2728320079467622763ULL, 5906898742475061457ULL, 5588392156783954967ULL,
+    2318372323001099579ULL, 2428589664202812527ULL, 7068372439816708703ULL,
+    3565177173669225527ULL, 7164252701080538187ULL, 6690747318595147047ULL,
+    5942250833250150461ULL, 10611537920393169ULL, 4917788196751850687ULL,
+    6596414516547821938ULL, 930624575945549251ULL, 3202192164596600499ULL,
+    3251669881821327646ULL, 925709209075483734ULL, 6331999955134903609ULL,
+    1490413758979620417ULL, 3368239144746375596ULL, 14379003708465864ULL,
+    902942954402005286ULL, 8535115354902325389ULL, 398378598271076489ULL,
+    416939553983566198ULL, 6814702838785464765ULL, 1020470760404182216ULL,
+    3814047378586308254ULL, 3469503031844682819ULL, 394731768268612049ULL,
+    1544680659261131832ULL, 2025700708624053161ULL, 4036506368176285839ULL,
+    9117167360165263164ULL, 6016586830618870622ULL, 7457263238007666193ULL,
+    1538072011456915268ULL, 558026909275807588ULL, 6694887180427724650ULL,
+    1858069356323949288ULL, 751329236595408800ULL, 3977915136995898423ULL,
+    3617170866588134673ULL, 558699243444932988ULL, 8769699102397015828ULL,
+    4430087837309990349ULL, 2195552195235222039ULL, 4707582131244366687ULL,
+    8225721010493313584ULL, 1523543973359433456ULL, 8721782652188684631ULL,
+    6497393875733711412ULL, 419828866534627094ULL, 1013241644312171349ULL,
+    9006289775485338999ULL, 4704716180258121784ULL, 720525613527236713ULL,
+    3126783844832535539ULL, 4136070117708209225ULL, 3068629308845933172ULL,
+    4485567091947321593ULL, 1048411950293742828ULL, 7113500349910175273ULL,
+    4827702672225113814ULL,
+}};
+
+inline constexpr unsigned long long EMPTY_BOARD_HIGH = 7783798474596228566ULL;
+
+}
+}
+
+#endif
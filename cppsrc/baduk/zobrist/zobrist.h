@@ -1,47 +1,128 @@
 #ifndef incl_BADUK_ZOBRIST_ZOBRIST_H__
 #define incl_BADUK_ZOBRIST_ZOBRIST_H__
 
-#include <vector>
+#include <cstdint>
 
 #include "../point.h"
+#include "codes.h"
 
 namespace baduk {
 namespace zobrist {
 
+#ifdef BADUK_WIDE_HASH
+
+// 128-bit hash codes, for pooling positions from enough games that
+// 64-bit collisions become likely. Build everything with
+// -DBADUK_WIDE_HASH to use them. The low word of each code is the
+// 64-bit code, so a wide hash always agrees with the narrow one in its
+// low bits.
+struct hashcode {
+    std::uint64_t low;
+    std::uint64_t high;
+
+    // A 64-bit value widens with zero high bits.
+    constexpr hashcode(
+            std::uint64_t low_bits = 0, std::uint64_t high_bits = 0) :
+        low(low_bits), high(high_bits) {}
+
+    constexpr hashcode& operator^=(hashcode b) {
+        low ^= b.low;
+        high ^= b.high;
+        return *this;
+    }
+};
+
+constexpr hashcode operator^(hashcode a, hashcode b) {
+    return a ^= b;
+}
+
+constexpr bool operator==(hashcode a, hashcode b) {
+    return a.low == b.low && a.high == b.high;
+}
+
+constexpr bool operator!=(hashcode a, hashcode b) {
+    return !(a == b);
+}
+
+const unsigned int HASH_BITS = 128;
+
+constexpr std::uint64_t lowBits(hashcode hash) { return hash.low; }
+
+// The 64 bits of hash starting at bit shift.
+constexpr std::uint64_t bitsFrom(hashcode hash, unsigned int shift) {
+    if (shift == 0) {
+        return hash.low;
+    }
+    if (shift < 64) {
+        return (hash.low >> shift) | (hash.high << (64 - shift));
+    }
+    return hash.high >> (shift - 64);
+}
+
+const hashcode BLACK_TO_PLAY(3497503632401365394ULL, 2868931830600892438ULL);
+const hashcode WHITE_TO_PLAY(8648928564975707047ULL, 3693949309296624004ULL);
+
+#else
+
 using hashcode = unsigned long long;
 
+const unsigned int HASH_BITS = 64;
+
+constexpr std::uint64_t lowBits(hashcode hash) { return hash; }
+
+// The bits of hash starting at bit shift.
+constexpr std::uint64_t bitsFrom(hashcode hash, unsigned int shift) {
+    return hash >> shift;
+}
+
 const hashcode BLACK_TO_PLAY = 3497503632401365394LL;
 const hashcode WHITE_TO_PLAY = 8648928564975707047LL;
 
+#endif
+
 const unsigned int MAX_BOARD_SIZE = 25;
 
-class ZobristCodes {
-public:
-    static ZobristCodes& get() {
-        static ZobristCodes instance;
-        return instance;
-    }
+static_assert(
+    EMPTY_CODES.size() == MAX_BOARD_SIZE * MAX_BOARD_SIZE,
+    "codes.h was generated for a different board size");
 
-    hashcode getStone(::baduk::Stone, ::baduk::Point const&) const;
-    hashcode getEmpty(::baduk::Point const&) const;
+// The codes are compiled in, so looking one up is a single load with
+// nothing to initialise first.
+constexpr unsigned int codeIndex(::baduk::Point p) {
+    return MAX_BOARD_SIZE * p.row() + p.col();
+}
 
-    hashcode emptyBoard() const { return empty_board_; }
+#ifdef BADUK_WIDE_HASH
 
-private:
-    ZobristCodes();
+constexpr hashcode stoneCode(::baduk::Stone stone, ::baduk::Point p) {
+    const auto s = static_cast<int>(stone);
+    return hashcode(
+        STONE_CODES[s][codeIndex(p)], STONE_CODES_HIGH[s][codeIndex(p)]);
+}
 
-    unsigned int index(::baduk::Point const& p) const {
-        return MAX_BOARD_SIZE * p.row() + p.col();
-    }
+constexpr hashcode emptyCode(::baduk::Point p) {
+    return hashcode(EMPTY_CODES[codeIndex(p)], EMPTY_CODES_HIGH[codeIndex(p)]);
+}
 
-    void initialize();
+constexpr hashcode emptyBoard() {
+    return hashcode(EMPTY_BOARD, EMPTY_BOARD_HIGH);
+}
 
-    std::vector<hashcode> black_codes_;
-    std::vector<hashcode> white_codes_;
-    std::vector<hashcode> empty_codes_;
+#else
 
-    hashcode empty_board_;
-};
+constexpr hashcode stoneCode(::baduk::Stone stone, ::baduk::Point p) {
+    return STONE_CODES[static_cast<int>(stone)][codeIndex(p)];
+}
+
+constexpr hashcode emptyCode(::baduk::Point p) {
+    return EMPTY_CODES[codeIndex(p)];
+}
+
+constexpr hashcode emptyBoard() {
+    return EMPTY_BOARD;
+}
+
+#endif
 
 }
 }
@@ -0,0 +1,64 @@
+#include <cxxtest/TestSuite.h>
+
+#include "../baduk/agent.h"
+#include "../baduk/board.h"
+#include "../baduk/game.h"
+
+class AgentTestSuite : public CxxTest::TestSuite {
+public:
+    void testPatternBotFollowsWeights() {
+        // Black can capture at the marked point, and the weights favor
+        // it far above the dozen or so other moves.
+        // . . * . .
+        // . x o x .
+        // . . x . .
+        // . . . . .
+        baduk::Board board(4, 5);
+        board.place(baduk::Point(2, 2), baduk::Stone::black);
+        board.place(baduk::Point(1, 1), baduk::Stone::black);
+        board.place(baduk::Point(1, 3), baduk::Stone::black);
+        board.place(baduk::Point(1, 2), baduk::Stone::white);
+        const baduk::Point capture(0, 2);
+        const auto game = baduk::gameFromBoard(board, baduk::Stone::black, 7.5);
+
+        baduk::PatternWeights heavy;
+        heavy.set(
+            baduk::forPlayer(board.pattern(capture), baduk::Stone::black),
+            255);
+        const baduk::PatternWeights uniform;
+        const auto count_captures = [&](baduk::PatternWeights const& weights) {
+            baduk::PatternBot bot(baduk::Rng(1), weights);
+            int captures = 0;
+            for (int i = 0; i < 100; ++i) {
+                const auto move = bot.selectMove(*game);
+                TS_ASSERT(game->isMoveLegal(move));
+                captures += !baduk::isPass(move) &&
+                    baduk::getPoint(move) == capture;
+            }
+            return captures;
+        };
+        TS_ASSERT_LESS_THAN(70, count_captures(heavy));
+        TS_ASSERT_LESS_THAN(count_captures(uniform), 20);
+    }
+
+    void testPatternBotPasses() {
+        // Neither player has a move left: black would only fill its own
+        // eyes, and white's moves would all be suicide.
+        // x x x x x
+        // x . x . x
+        // x x x x x
+        baduk::Board board(3, 5);
+        for (unsigned int c = 0; c < 5; ++c) {
+            board.place(baduk::Point(0, c), baduk::Stone::black);
+            board.place(baduk::Point(2, c), baduk::Stone::black);
+        }
+        board.place(baduk::Point(1, 0), baduk::Stone::black);
+        board.place(baduk::Point(1, 2), baduk::Stone::black);
+        board.place(baduk::Point(1, 4), baduk::Stone::black);
+        baduk::PatternBot bot(baduk::Rng(3));
+        for (auto player : {baduk::Stone::black, baduk::Stone::white}) {
+            const auto game = baduk::gameFromBoard(board, player, 7.5);
+            TS_ASSERT(baduk::isPass(bot.selectMove(*game)));
+        }
+    }
+};
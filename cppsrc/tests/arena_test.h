@@ -0,0 +1,41 @@
+#include <cxxtest/TestSuite.h>
+
+#include "../baduk/arena.h"
+#include "../baduk/game.h"
+
+class ArenaTestSuite : public CxxTest::TestSuite {
+public:
+    void testPlayInArena() {
+        // A tiny arena, so the game spills over into the heap too.
+        baduk::GameArena arena(1024);
+        for (int round = 0; round < 3; ++round) {
+            {
+                auto game = baduk::newGame(5, 0.5, baduk::Rules(), &arena);
+                game = game->applyMove(baduk::Play(baduk::Point(2, 2)));
+                game = game->applyMove(baduk::Play(baduk::Point(2, 3)));
+                game = game->applyMove(baduk::Pass());
+                TS_ASSERT_EQUALS(
+                    baduk::Stone::black, game->board().at(baduk::Point(2, 2)));
+                TS_ASSERT(!game->isOver());
+                TS_ASSERT(
+                    !game->doesMoveViolateKo(baduk::Play(baduk::Point(0, 0))));
+            }
+            arena.reset();
+        }
+    }
+
+    void testFromBoardInArena() {
+        baduk::GameArena arena;
+        {
+            baduk::Board board(5, 5);
+            board.place(baduk::Point(1, 1), baduk::Stone::white);
+            auto game = baduk::gameFromBoard(
+                board, baduk::Stone::black, 0.5, baduk::Rules(), &arena);
+            game = game->applyMove(baduk::Play(baduk::Point(2, 2)));
+            TS_ASSERT_EQUALS(
+                baduk::Stone::white, game->board().at(baduk::Point(1, 1)));
+            TS_ASSERT_EQUALS(1, game->numMoves());
+        }
+        arena.reset();
+    }
+};
@@ -0,0 +1,97 @@
+#include <random>
+
+#include <cxxtest/TestSuite.h>
+
+#include "../baduk/bitboard.h"
+#include "../baduk/board.h"
+
+class BitboardTestSuite : public CxxTest::TestSuite {
+public:
+    void testDilateStopsAtEdges() {
+        const auto on_board = baduk::Bitboard::full(19, 19);
+        baduk::Bitboard b;
+        b.set("T10");
+        const auto grown = b.dilate(on_board);
+        TS_ASSERT_EQUALS(4, grown.count());
+        TS_ASSERT(grown.get("S10"));
+        TS_ASSERT(grown.get("T9"));
+        TS_ASSERT(grown.get("T11"));
+        // Must not wrap around onto the next row.
+        TS_ASSERT(!grown.get("A11"));
+
+        baduk::Bitboard corner;
+        corner.set("A1");
+        TS_ASSERT_EQUALS(3, corner.dilate(on_board).count());
+    }
+
+    void testDilateMatchesTheLongWay() {
+        // Covers whichever version of dilate was compiled in; build with
+        // AVX2=1 to check the vector one.
+        std::mt19937 rng(11);
+        for (unsigned int size : {5, 9, 13, 19}) {
+            const auto on_board = baduk::Bitboard::full(size, size - 1);
+            for (int i = 0; i < 50; ++i) {
+                baduk::Bitboard b;
+                for (unsigned int r = 0; r < size; ++r) {
+                    for (unsigned int c = 0; c < size - 1; ++c) {
+                        if (rng() % 4 == 0) {
+                            b.set(baduk::Point(r, c));
+                        }
+                    }
+                }
+                baduk::Bitboard expected;
+                on_board.forEach([&](baduk::Point p) {
+                    bool grown = b.get(p);
+                    if (p.row() > 0) {
+                        grown |= b.get(baduk::Point(p.row() - 1, p.col()));
+                    }
+                    if (p.col() > 0) {
+                        grown |= b.get(baduk::Point(p.row(), p.col() - 1));
+                    }
+                    grown |= b.get(baduk::Point(p.row() + 1, p.col()));
+                    grown |= b.get(baduk::Point(p.row(), p.col() + 1));
+                    if (grown) {
+                        expected.set(p);
+                    }
+                });
+                TS_ASSERT_EQUALS(expected, b.dilate(on_board));
+            }
+        }
+    }
+
+    void testStringAndLiberties() {
+        // .....
+        // .xx..
+        // .ox..
+        // .xx..
+        // .....
+        baduk::Board board(5, 5);
+        board.place("B2", baduk::Stone::black);
+        board.place("C2", baduk::Stone::black);
+        board.place("C3", baduk::Stone::black);
+        board.place("B4", baduk::Stone::black);
+        board.place("C4", baduk::Stone::black);
+        board.place("B3", baduk::Stone::white);
+
+        baduk::Bitboard seed;
+        seed.set("B2");
+        const auto string = seed.floodFill(board.stones(baduk::Stone::black));
+        TS_ASSERT_EQUALS(5, string.count());
+        const auto libs = baduk::liberties(string, board.emptyPoints());
+        TS_ASSERT_EQUALS(board.stringAt("B2").numLiberties(), libs.count());
+        TS_ASSERT_EQUALS(9, libs.count());
+        TS_ASSERT(!libs.get("B3"));
+    }
+
+    void testForEach() {
+        baduk::Bitboard b;
+        b.set("C19");
+        b.set("A1");
+        b.set("B1");
+        std::vector<baduk::Point> points;
+        b.forEach([&points](baduk::Point p) { points.push_back(p); });
+        const std::vector<baduk::Point> expected{"A1", "B1", "C19"};
+        TS_ASSERT_EQUALS(expected, points);
+        TS_ASSERT_EQUALS(baduk::Point("A1"), b.first());
+    }
+};
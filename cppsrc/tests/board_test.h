@@ -1,7 +1,93 @@
+#include <random>
+#include <type_traits>
+#include <vector>
+
 #include <cxxtest/TestSuite.h>
 
 #include "../baduk/board.h"
 
+// One of points, picked at random. points must not be empty.
+baduk::Point randomPoint(baduk::Bitboard const& points, std::mt19937& rng) {
+    auto n = rng() % points.count();
+    baduk::Point chosen;
+    points.forEach([&](baduk::Point p) {
+        if (n-- == 0) {
+            chosen = p;
+        }
+    });
+    return chosen;
+}
+
+// Assert that board's incremental bookkeeping is consistent.
+void validate(baduk::Board const& board) {
+    board.visit([](auto const& fixed) { fixed.validate(); });
+}
+
+// Eye test written out the long way, to check Board::isEye against.
+bool isEyeTheLongWay(
+        baduk::Board const& board, baduk::Point p, baduk::Stone stone) {
+    if (!board.isEmpty(p)) {
+        return false;
+    }
+    for (auto neighbor : board.neighbors(p)) {
+        if (board.isEmpty(neighbor) || board.at(neighbor) != stone) {
+            return false;
+        }
+    }
+    const int rows = board.numRows();
+    const int cols = board.numCols();
+    int friendly = 0;
+    int off_board = 0;
+    for (int dr : {-1, 1}) {
+        for (int dc : {-1, 1}) {
+            const int r = p.row() + dr;
+            const int c = p.col() + dc;
+            if (r < 0 || r >= rows || c < 0 || c >= cols) {
+                ++off_board;
+                continue;
+            }
+            const baduk::Point corner(r, c);
+            if (!board.isEmpty(corner) && board.at(corner) == stone) {
+                ++friendly;
+            }
+        }
+    }
+    if (off_board > 0) {
+        return off_board + friendly == 4;
+    }
+    return friendly >= 3;
+}
+
+// Pattern code worked out point by point, to check Board::pattern
+// against.
+baduk::PatternCode patternTheLongWay(
+        baduk::Board const& board, baduk::Point p) {
+    const int rows = board.numRows();
+    const int cols = board.numCols();
+    const std::vector<std::vector<int>> offsets{
+        {-1, 0}, {0, -1}, {0, 1}, {1, 0},
+        {-1, -1}, {-1, 1}, {1, -1}, {1, 1}};
+    baduk::PatternCode code = 0;
+    for (unsigned int k = 0; k < offsets.size(); ++k) {
+        const int r = p.row() + offsets[k][0];
+        const int c = p.col() + offsets[k][1];
+        baduk::PatternCode color = 3;
+        if (r >= 0 && r < rows && c >= 0 && c < cols) {
+            const baduk::Point q(r, c);
+            if (board.isEmpty(q)) {
+                color = 0;
+            } else {
+                color = board.at(q) == baduk::Stone::black ? 1 : 2;
+                if (k < 4 && board.stringAt(q).numLiberties() == 1) {
+                    code |= baduk::PatternCode(1) << (16 + k);
+                }
+            }
+        }
+        code |= color << (2 * k);
+    }
+    return code;
+}
+
 class BoardTestSuite : public CxxTest::TestSuite {
 public:
     void testEqual() {
@@ -35,6 +121,19 @@ public:
         TS_ASSERT_EQUALS(3, string2.numLiberties());
     }
 
+    void testAssignAcrossSizes() {
+        baduk::Board small(9, 9);
+        small.place("C3", baduk::Stone::black);
+        baduk::Board board(19, 19);
+        board.place("Q16", baduk::Stone::white);
+        board = small;
+        TS_ASSERT_EQUALS(9, board.numRows());
+        TS_ASSERT_EQUALS(small, board);
+        board = baduk::Board(13, 13);
+        TS_ASSERT_EQUALS(13, board.numCols());
+        TS_ASSERT(board.isEmpty("C3"));
+    }
+
     void testCaptureIsNotSuicide() {
         baduk::Board board(19, 19);
         board.place("A1", baduk::Stone::black);
@@ -61,6 +160,25 @@ public:
         TS_ASSERT_EQUALS(1, string.numLiberties());
     }
 
+    void testCaptureOnRectangularBoard() {
+        // .xo
+        // xo.
+        // o..
+        // ...
+        // ...
+        baduk::Board board(5, 3);
+        board.place("A3", baduk::Stone::white);
+        board.place("A4", baduk::Stone::black);
+        board.place("B4", baduk::Stone::white);
+        board.place("B5", baduk::Stone::black);
+        board.place("C5", baduk::Stone::white);
+        TS_ASSERT(board.willCapture("A5", baduk::Stone::white));
+        board.place("A5", baduk::Stone::white);
+        TS_ASSERT(board.isEmpty("A4"));
+        TS_ASSERT(board.isEmpty("B5"));
+        TS_ASSERT_EQUALS(2, board.stringAt("A5").numLiberties());
+    }
+
     void testWillCapture() {
         baduk::Board board(19, 19);
         board.place("A1", baduk::Stone::black);
@@ -70,6 +188,115 @@ public:
         TS_ASSERT(board.willCapture("B1", baduk::Stone::white));
     }
 
+    void testAnalyzeMove() {
+        // .....
+        // xx...
+        // o*...
+        // xx...
+        baduk::Board board(4, 5);
+        board.place("A1", baduk::Stone::black);
+        board.place("B1", baduk::Stone::black);
+        board.place("A3", baduk::Stone::black);
+        board.place("B3", baduk::Stone::black);
+        board.place("A2", baduk::Stone::white);
+
+        // Captures A2 and joins both black strings.
+        const auto move = board.analyzeMove("B2", baduk::Stone::black);
+        TS_ASSERT(move.isLegal());
+        TS_ASSERT(move.isCapture());
+        TS_ASSERT_EQUALS(1, move.num_captures);
+        TS_ASSERT_EQUALS(2, move.num_merges);
+        auto expected = board;
+        expected.place("B2", baduk::Stone::black);
+        TS_ASSERT_EQUALS(expected.hash(), move.hash);
+
+        board.place(move);
+        TS_ASSERT_EQUALS(expected, board);
+        TS_ASSERT_EQUALS(expected.hash(), board.hash());
+        TS_ASSERT(board.isEmpty("A2"));
+        TS_ASSERT_EQUALS(5, board.stringAt("B2").stones().size());
+
+        TS_ASSERT(!board.analyzeMove("B2", baduk::Stone::white).isLegal());
+        const auto suicide = board.analyzeMove("A2", baduk::Stone::white);
+        TS_ASSERT(suicide.isSuicide());
+        TS_ASSERT(!suicide.isLegal());
+    }
+
+    void testCandidates() {
+        // Play random non-suicide moves, checking the incremental
+        // candidate sets against analyzeMove, then take them all back.
+        std::mt19937 rng(11);
+        baduk::Board board(7, 7);
+        std::vector<baduk::PlaceUndo> undos;
+        const auto check = [&board]() {
+            for (unsigned int r = 0; r < 7; ++r) {
+                for (unsigned int c = 0; c < 7; ++c) {
+                    const baduk::Point p(r, c);
+                    TS_ASSERT_EQUALS(board.isEmpty(p),
+                        board.emptyPoints().get(p));
+                    for (auto stone :
+                            {baduk::Stone::black, baduk::Stone::white}) {
+                        TS_ASSERT_EQUALS(
+                            board.analyzeMove(p, stone).isLegal(),
+                            board.candidates(stone).get(p));
+                    }
+                }
+            }
+        };
+        auto player = baduk::Stone::black;
+        for (int i = 0; i < 150; ++i) {
+            if (!board.candidates(player).any()) {
+                break;
+            }
+            const auto move = randomPoint(board.candidates(player), rng);
+            undos.emplace_back();
+            board.place(move, player, undos.back());
+            check();
+            validate(board);
+            player = baduk::other(player);
+        }
+        while (!undos.empty()) {
+            board.undo(undos.back());
+            undos.pop_back();
+            check();
+            validate(board);
+        }
+        TS_ASSERT_EQUALS(baduk::Board(7, 7), board);
+    }
+
+    void testSuicideUndo() {
+        // Play anywhere, suicide included, and check each move undoes
+        // back to the board before it.
+        std::mt19937 rng(5);
+        baduk::Board board(5, 5);
+        std::vector<baduk::Board> before;
+        std::vector<baduk::PlaceUndo> undos;
+        auto player = baduk::Stone::black;
+        int num_suicides = 0;
+        for (int i = 0; i < 200; ++i) {
+            const auto point = randomPoint(board.emptyPoints(), rng);
+            const auto move = board.analyzeMove(point, player);
+            if (move.isSuicide()) {
+                ++num_suicides;
+            }
+            before.push_back(board);
+            undos.emplace_back();
+            board.place(move, undos.back());
+            TS_ASSERT_EQUALS(move.hash, board.hash());
+            validate(board);
+            player = baduk::other(player);
+        }
+        TS_ASSERT(num_suicides > 0);
+        while (!undos.empty()) {
+            board.undo(undos.back());
+            undos.pop_back();
+            validate(board);
+            TS_ASSERT_EQUALS(before.back(), board);
+            TS_ASSERT_EQUALS(before.back().hash(), board.hash());
+            before.pop_back();
+        }
+    }
+
     void testWillHaveNoLiberties() {
         // ooo.
         // x*xo
@@ -139,6 +366,23 @@ public:
         verifyHash(board, "D3", baduk::Stone::black);
     }
 
+    void testHashAfter_captureTouchingTwice() {
+        // .....    .....
+        // .....    .....
+        // xx...    xx...
+        // oox.. -> ..x..
+        // .ox..    x.x..
+        baduk::Board board(5, 5);
+        board.place("A3", baduk::Stone::black);
+        board.place("B3", baduk::Stone::black);
+        board.place("C2", baduk::Stone::black);
+        board.place("C1", baduk::Stone::black);
+        board.place("A2", baduk::Stone::white);
+        board.place("B2", baduk::Stone::white);
+        board.place("B1", baduk::Stone::white);
+        verifyHash(board, "A1", baduk::Stone::black);
+    }
+
     void testStringIteration() {
         baduk::Board board(5, 5);
         // .o...
@@ -166,4 +410,148 @@ public:
         TS_ASSERT_EQUALS(black_strings, 1);
         TS_ASSERT_EQUALS(white_strings, 2);
     }
+
+    void testEyes() {
+        // 3 . x o . o
+        // 2 x x o o o
+        // 1 . x x . o
+        // 0 x . x o .
+        //   0 1 2 3 4
+        const std::vector<std::vector<int>> black{
+            {3, 1}, {2, 0}, {2, 1}, {1, 1}, {1, 2}, {0, 0}, {0, 2}};
+        const std::vector<std::vector<int>> white{
+            {3, 2}, {3, 4}, {2, 2}, {2, 3}, {2, 4}, {1, 4}, {0, 3}};
+        baduk::Board board(4, 5);
+        for (auto const& p : black) {
+            board.place(baduk::Point(p[0], p[1]), baduk::Stone::black);
+        }
+        for (auto const& p : white) {
+            board.place(baduk::Point(p[0], p[1]), baduk::Stone::white);
+        }
+        // Corner and edge eyes need every on-board diagonal.
+        TS_ASSERT(board.isEye(baduk::Point(3, 0), baduk::Stone::black));
+        TS_ASSERT(board.isEye(baduk::Point(3, 3), baduk::Stone::white));
+        TS_ASSERT(!board.isEye(baduk::Point(1, 0), baduk::Stone::black));
+        TS_ASSERT(!board.isEye(baduk::Point(0, 1), baduk::Stone::black));
+        TS_ASSERT(!board.isEye(baduk::Point(0, 4), baduk::Stone::white));
+        // Not surrounded by one color, or not empty.
+        TS_ASSERT(!board.isEye(baduk::Point(1, 3), baduk::Stone::black));
+        TS_ASSERT(!board.isEye(baduk::Point(1, 3), baduk::Stone::white));
+        TS_ASSERT(!board.isEye(baduk::Point(3, 0), baduk::Stone::white));
+        TS_ASSERT(!board.isEye(baduk::Point(1, 1), baduk::Stone::black));
+    }
+
+    void testNeighborhoodsMatchTheLongWay() {
+        // Random positions on boards smaller than the FixedBoard that
+        // holds them, with captures and undos mixed in.
+        std::mt19937 rng(13);
+        for (unsigned int cols : {5, 8, 12, 19}) {
+            baduk::Board board(7, cols);
+            std::vector<baduk::PlaceUndo> undos;
+            auto player = baduk::Stone::black;
+            for (int i = 0; i < 120; ++i) {
+                if (!undos.empty() && rng() % 8 == 0) {
+                    board.undo(undos.back());
+                    undos.pop_back();
+                } else {
+                    if (!board.candidates(player).any()) {
+                        break;
+                    }
+                    const auto move =
+                        randomPoint(board.candidates(player), rng);
+                    undos.emplace_back();
+                    board.place(move, player, undos.back());
+                    player = baduk::other(player);
+                }
+                for (unsigned int r = 0; r < 7; ++r) {
+                    for (unsigned int c = 0; c < cols; ++c) {
+                        const baduk::Point p(r, c);
+                        for (auto stone :
+                                {baduk::Stone::black, baduk::Stone::white}) {
+                            TS_ASSERT_EQUALS(
+                                isEyeTheLongWay(board, p, stone),
+                                board.isEye(p, stone));
+                        }
+                        TS_ASSERT_EQUALS(
+                            patternTheLongWay(board, p), board.pattern(p));
+                    }
+                }
+            }
+        }
+    }
+
+    void testPatterns() {
+        // 2 . . .
+        // 1 x o x
+        // 0 . x .
+        //   0 1 2
+        baduk::Board board(3, 3);
+        board.place(baduk::Point(1, 0), baduk::Stone::black);
+        board.place(baduk::Point(0, 1), baduk::Stone::black);
+        board.place(baduk::Point(1, 2), baduk::Stone::black);
+        board.place(baduk::Point(1, 1), baduk::Stone::white);
+        // Off the board below and to the left, black stones on two
+        // sides, and the white stone in the corner.
+        TS_ASSERT_EQUALS(
+            baduk::PatternCode(0xbf5f), board.pattern(baduk::Point(0, 0)));
+        // The white stone is in atari, on the side above.
+        const auto code = board.pattern(baduk::Point(2, 1));
+        TS_ASSERT_EQUALS(2u, baduk::patternColor(code, 0));
+        TS_ASSERT(baduk::patternAtari(code, 0));
+        TS_ASSERT(!baduk::patternAtari(code, 1));
+        TS_ASSERT_EQUALS(1u, baduk::patternColor(code, 4));
+        TS_ASSERT_EQUALS(3u, baduk::patternColor(code, 7));
+        // Seen by white, the colors swap and the rest stays.
+        const auto flipped = baduk::forPlayer(code, baduk::Stone::white);
+        TS_ASSERT_EQUALS(1u, baduk::patternColor(flipped, 0));
+        TS_ASSERT_EQUALS(2u, baduk::patternColor(flipped, 4));
+        TS_ASSERT_EQUALS(3u, baduk::patternColor(flipped, 7));
+        TS_ASSERT(baduk::patternAtari(flipped, 0));
+    }
+
+    void testHashCodes() {
+        // Flipping a point toggles its empty code and its stone code.
+        for (unsigned int size : {9, 13, 19}) {
+            baduk::Board board(size, size);
+            TS_ASSERT_EQUALS(baduk::zobrist::emptyBoard(), board.hash());
+            const baduk::Point p(2, 5);
+            board.place(p, baduk::Stone::white);
+            TS_ASSERT_EQUALS(
+                baduk::zobrist::emptyBoard() ^
+                    baduk::zobrist::emptyCode(p) ^
+                    baduk::zobrist::stoneCode(baduk::Stone::white, p),
+                board.hash());
+        }
+        static_assert(
+            baduk::zobrist::lowBits(baduk::zobrist::stoneCode(
+                baduk::Stone::black, baduk::Point(0, 0))) ==
+                baduk::zobrist::STONE_CODES[0][0],
+            "codes are available at compile time");
+    }
+
+    void testSizeDispatch() {
+        baduk::Board board(13, 13);
+        board.place("N13", baduk::Stone::black);
+        board.place("M13", baduk::Stone::white);
+        board.place("N12", baduk::Stone::white);
+        TS_ASSERT(board.isEmpty("N13"));
+        TS_ASSERT(board.visit([](auto const& fixed) {
+            return std::is_same_v<
+                std::decay_t<decltype(fixed)>, baduk::FixedBoard<13>>;
+        }));
+    }
+
+    void testBoardTooLarge() {
+        TS_ASSERT_THROWS(baduk::Board(20, 20), baduk::BoardTooLarge);
+    }
+
+    void testFixedBoard() {
+        baduk::FixedBoard<9> board(9, 9);
+        board.place("A1", baduk::Stone::black);
+        board.place("A2", baduk::Stone::white);
+        board.place("B1", baduk::Stone::white);
+        TS_ASSERT(board.isEmpty("A1"));
+        TS_ASSERT_EQUALS(3, board.stringAt("A2").numLiberties());
+        TS_ASSERT_EQUALS(2, board.numStrings());
+    }
 };
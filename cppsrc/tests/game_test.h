@@ -1,3 +1,6 @@
+#include <random>
+#include <vector>
+
 #include <cxxtest/TestSuite.h>
 
 #include "../baduk/game.h"
@@ -37,6 +40,118 @@ public:
         TS_ASSERT(game->isMoveLegal(baduk::Play("P16")));
     }
 
+    void testSimpleKo() {
+        baduk::Rules rules;
+        rules.ko = baduk::KoRule::simple;
+        auto game = baduk::newGame(19, 7.5, rules);
+        game = game->applyMove(baduk::Play("Q16"));
+        game = game->applyMove(baduk::Play("P16"));
+        game = game->applyMove(baduk::Play("P17"));
+        game = game->applyMove(baduk::Play("O17"));
+        game = game->applyMove(baduk::Play("P15"));
+        game = game->applyMove(baduk::Play("O15"));
+        game = game->applyMove(baduk::Play("A1"));
+        game = game->applyMove(baduk::Play("N16"));
+        // Take the ko
+        game = game->applyMove(baduk::Play("O16"));
+
+        TS_ASSERT(!game->isMoveLegal(baduk::Play("P16")));
+        TS_ASSERT(game->doesMoveViolateKo(baduk::Play("P16")));
+
+        game = game->applyMove(baduk::Play("T1"));
+        game = game->applyMove(baduk::Play("T2"));
+
+        TS_ASSERT(game->isMoveLegal(baduk::Play("P16")));
+        TS_ASSERT(!game->doesMoveViolateKo(baduk::Play("P16")));
+    }
+
+    void testSuicide() {
+        // A lone black stone at A1 would have no liberties.
+        baduk::Board board(19, 19);
+        board.place("A2", baduk::Stone::white);
+        board.place("B1", baduk::Stone::white);
+
+        auto game = baduk::gameFromBoard(board, baduk::Stone::black, 7.5);
+        TS_ASSERT(!game->isMoveLegal(baduk::Play("A1")));
+
+        baduk::Rules rules;
+        rules.allow_suicide = true;
+        game = baduk::gameFromBoard(board, baduk::Stone::black, 7.5, rules);
+        TS_ASSERT(game->isMoveLegal(baduk::Play("A1")));
+        const auto next = game->applyMove(baduk::Play("A1"));
+        TS_ASSERT(next->board().isEmpty("A1"));
+        TS_ASSERT_EQUALS(board.hash(), next->board().hash());
+
+        // The board is unchanged, which only positional superko
+        // forbids.
+        rules.ko = baduk::KoRule::positional;
+        game = baduk::gameFromBoard(board, baduk::Stone::black, 7.5, rules);
+        TS_ASSERT(!game->isMoveLegal(baduk::Play("A1")));
+        TS_ASSERT(game->doesMoveViolateKo(baduk::Play("A1")));
+    }
+
+    void testMultiStoneSuicide() {
+        baduk::Board board(19, 19);
+        board.place("A1", baduk::Stone::black);
+        board.place("B1", baduk::Stone::white);
+        board.place("B2", baduk::Stone::white);
+        board.place("A3", baduk::Stone::white);
+
+        baduk::Rules rules;
+        rules.ko = baduk::KoRule::positional;
+        rules.allow_suicide = true;
+        auto game = baduk::gameFromBoard(
+            board, baduk::Stone::black, 7.5, rules);
+        TS_ASSERT(game->isMoveLegal(baduk::Play("A2")));
+        game = game->applyMove(baduk::Play("A2"));
+        TS_ASSERT(game->board().isEmpty("A1"));
+        TS_ASSERT(game->board().isEmpty("A2"));
+
+        baduk::Board expected(19, 19);
+        expected.place("B1", baduk::Stone::white);
+        expected.place("B2", baduk::Stone::white);
+        expected.place("A3", baduk::Stone::white);
+        TS_ASSERT_EQUALS(expected, game->board());
+        TS_ASSERT_EQUALS(expected.hash(), game->board().hash());
+        // White can use the liberties the black stones left behind.
+        TS_ASSERT_EQUALS(5, game->board().stringAt("B1").numLiberties());
+    }
+
+    void testLegalMoves() {
+        // Play random games on a small board, where captures and ko come
+        // up often, and check legalMoves against isMoveLegal.
+        std::mt19937 rng(3);
+        for (auto ko : {baduk::KoRule::simple, baduk::KoRule::positional,
+                baduk::KoRule::situational}) {
+            for (bool allow_suicide : {false, true}) {
+                baduk::Rules rules;
+                rules.ko = ko;
+                rules.allow_suicide = allow_suicide;
+                auto game = baduk::newGame(5, 0.5, rules);
+                while (!game->isOver() && game->numMoves() < 200) {
+                    const auto legal = game->legalMoves();
+                    std::vector<baduk::Point> plays;
+                    for (unsigned int r = 0; r < 5; ++r) {
+                        for (unsigned int c = 0; c < 5; ++c) {
+                            const baduk::Point p(r, c);
+                            TS_ASSERT_EQUALS(
+                                game->isMoveLegal(baduk::Play(p)),
+                                legal.get(p));
+                            if (legal.get(p)) {
+                                plays.push_back(p);
+                            }
+                        }
+                    }
+                    baduk::Move move = baduk::Pass();
+                    if (!plays.empty() && rng() % 10 != 0) {
+                        move = baduk::Play(plays[rng() % plays.size()]);
+                    }
+                    game = game->applyMove(move);
+                }
+            }
+        }
+    }
+
     void testNumMoves() {
         auto game = baduk::newGame(19, 7.5);
         TS_ASSERT_EQUALS(0, game->numMoves());
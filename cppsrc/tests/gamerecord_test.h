@@ -0,0 +1,76 @@
+#include <random>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include "../baduk/gamerecord.h"
+
+class GameRecordTestSuite : public CxxTest::TestSuite {
+public:
+    void testEncodeMove() {
+        for (auto move : {baduk::Move(baduk::Play(baduk::Point(0, 0))),
+                baduk::Move(baduk::Play(baduk::Point(18, 18))),
+                baduk::Move(baduk::Play(baduk::Point(3, 15))),
+                baduk::Move(baduk::Pass()),
+                baduk::Move(baduk::Resign())}) {
+            const auto decoded = baduk::decodeMove(baduk::encodeMove(move));
+            TS_ASSERT_EQUALS(baduk::isPass(move), baduk::isPass(decoded));
+            TS_ASSERT_EQUALS(baduk::isResign(move), baduk::isResign(decoded));
+            if (std::holds_alternative<baduk::Play>(move)) {
+                TS_ASSERT_EQUALS(
+                    baduk::getPoint(move), baduk::getPoint(decoded));
+            }
+        }
+    }
+
+    void testReplay() {
+        std::mt19937 rng(13);
+        baduk::Rules rules;
+        rules.ko = baduk::KoRule::simple;
+        auto state = baduk::newGame(9, 6.5, rules);
+        std::vector<std::shared_ptr<const baduk::GameState>> states{state};
+        while (!state->isOver() && state->numMoves() < 300) {
+            std::vector<baduk::Point> plays;
+            state->legalMoves().forEach(
+                [&](baduk::Point p) { plays.push_back(p); });
+            baduk::Move move = baduk::Pass();
+            if (!plays.empty() && rng() % 20 != 0) {
+                move = baduk::Play(plays[rng() % plays.size()]);
+            }
+            state = state->applyMove(move);
+            states.push_back(state);
+        }
+
+        const baduk::GameRecord record(*state);
+        TS_ASSERT_EQUALS(states.size() - 1, record.numMoves());
+        TS_ASSERT_EQUALS(6.5, record.komi());
+        TS_ASSERT(record.rules().ko == baduk::KoRule::simple);
+        for (std::size_t i = 0; i < states.size(); i += 7) {
+            const auto position = record.replay(i);
+            TS_ASSERT(position == baduk::Position(*states[i]));
+            TS_ASSERT_EQUALS(states[i]->hash(), position.hash());
+            TS_ASSERT_EQUALS(states[i]->legalMoves(), position.legalMoves());
+        }
+        const auto final_position = record.replay();
+        TS_ASSERT_EQUALS(state->hash(), final_position.hash());
+        TS_ASSERT_EQUALS(state->isOver(), final_position.isOver());
+    }
+
+    void testSetupStones() {
+        baduk::Board board(13, 13);
+        board.place(baduk::Point(3, 3), baduk::Stone::black);
+        board.place(baduk::Point(9, 9), baduk::Stone::black);
+        board.place(baduk::Point(3, 9), baduk::Stone::white);
+        auto state = baduk::gameFromBoard(board, baduk::Stone::white, 0.5);
+        state = state->applyMove(baduk::Play(baduk::Point(6, 6)));
+        state = state->applyMove(baduk::Pass());
+
+        const baduk::GameRecord record(*state);
+        TS_ASSERT_EQUALS(2, record.numMoves());
+        TS_ASSERT_EQUALS(13, record.numRows());
+        const auto start = record.replay(0);
+        TS_ASSERT(start.board() == board);
+        TS_ASSERT_EQUALS(baduk::Stone::white, start.nextPlayer());
+        TS_ASSERT(record.replay() == baduk::Position(*state));
+    }
+};
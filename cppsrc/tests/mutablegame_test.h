@@ -0,0 +1,128 @@
+#include <random>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include "../baduk/game.h"
+#include "../baduk/mutablegame.h"
+
+class MutableGameTestSuite : public CxxTest::TestSuite {
+public:
+    void testPlayAndUndo() {
+        baduk::MutableGame game(baduk::Board(5, 5), baduk::Stone::black, 7.5);
+        const auto empty_board = game.board();
+        const auto empty_hash = game.hash();
+
+        game.play(baduk::Play("C2"));
+        game.play(baduk::Play("C3"));
+        game.play(baduk::Play("B3"));
+        game.play(baduk::Pass());
+        game.play(baduk::Play("C4"));
+        game.play(baduk::Pass());
+        const auto before_capture = game.board();
+        // Capture C3.
+        game.play(baduk::Play("D3"));
+        TS_ASSERT(game.board().isEmpty("C3"));
+        TS_ASSERT_EQUALS(7, game.numMoves());
+
+        game.undo();
+        TS_ASSERT_EQUALS(before_capture, game.board());
+        TS_ASSERT_EQUALS(baduk::Stone::white, game.board().at("C3"));
+        TS_ASSERT_EQUALS(1, game.board().stringAt("C3").numLiberties());
+        TS_ASSERT_EQUALS(baduk::Stone::black, game.nextPlayer());
+
+        for (int i = 0; i < 6; ++i) {
+            game.undo();
+        }
+        TS_ASSERT_EQUALS(empty_board, game.board());
+        TS_ASSERT_EQUALS(empty_hash, game.hash());
+        TS_ASSERT_EQUALS(0, game.numMoves());
+        TS_ASSERT(!game.hasLastMove());
+    }
+
+    void testUndoToken() {
+        baduk::MutableGame game(baduk::Board(9, 9), baduk::Stone::black, 7.5);
+        game.play(baduk::Play("E5"));
+        const auto board = game.board();
+        const auto token = game.play(baduk::Play("D5"));
+        game.play(baduk::Play("F5"));
+        game.play(baduk::Play("D4"));
+        game.undo(token);
+        TS_ASSERT_EQUALS(board, game.board());
+        TS_ASSERT_EQUALS(1, game.numMoves());
+        TS_ASSERT_EQUALS(baduk::Stone::white, game.nextPlayer());
+    }
+
+    void testKo() {
+        baduk::MutableGame game(baduk::Board(19, 19), baduk::Stone::black, 7.5);
+        game.play(baduk::Play("Q16"));
+        game.play(baduk::Play("P16"));
+        game.play(baduk::Play("P17"));
+        game.play(baduk::Play("O17"));
+        game.play(baduk::Play("P15"));
+        game.play(baduk::Play("O15"));
+        game.play(baduk::Play("A1"));
+        game.play(baduk::Play("N16"));
+        // Take the ko
+        game.play(baduk::Play("O16"));
+
+        // White can't retake it
+        TS_ASSERT(!game.isMoveLegal(baduk::Play("P16")));
+        TS_ASSERT(game.doesMoveViolateKo(baduk::Play("P16")));
+
+        // Once the ko capture is taken back, the history forgets it.
+        game.undo();
+        game.play(baduk::Play("T1"));
+        TS_ASSERT(game.isMoveLegal(baduk::Play("O16")));
+    }
+
+    void testIsOver() {
+        baduk::MutableGame game(baduk::Board(9, 9), baduk::Stone::black, 7.5);
+        game.play(baduk::Pass());
+        TS_ASSERT(!game.isOver());
+        game.play(baduk::Pass());
+        TS_ASSERT(game.isOver());
+        game.undo();
+        TS_ASSERT(!game.isOver());
+    }
+
+    void testMatchesGameState() {
+        // Play random games through both interfaces, then unwind the
+        // mutable game and check it revisits every position.
+        std::mt19937 rng(7);
+        auto state = baduk::newGame(9, 7.5);
+        baduk::MutableGame game(*state);
+        std::vector<std::shared_ptr<const baduk::GameState>> states{state};
+        while (!state->isOver() && state->numMoves() < 300) {
+            std::vector<baduk::Point> legal;
+            for (unsigned int r = 0; r < 9; ++r) {
+                for (unsigned int c = 0; c < 9; ++c) {
+                    const baduk::Point p(r, c);
+                    const auto legal_state = state->isMoveLegal(baduk::Play(p));
+                    TS_ASSERT_EQUALS(
+                        legal_state, game.isMoveLegal(baduk::Play(p)));
+                    if (legal_state) {
+                        legal.push_back(p);
+                    }
+                }
+            }
+            baduk::Move move = baduk::Pass();
+            if (!legal.empty() && rng() % 20 != 0) {
+                move = baduk::Play(legal[rng() % legal.size()]);
+            }
+            state = state->applyMove(move);
+            game.play(move);
+            states.push_back(state);
+            TS_ASSERT_EQUALS(state->hash(), game.hash());
+            TS_ASSERT_EQUALS(state->board(), game.board());
+        }
+        TS_ASSERT_EQUALS(state->isOver(), game.isOver());
+
+        while (states.size() > 1) {
+            states.pop_back();
+            game.undo();
+            TS_ASSERT_EQUALS(states.back()->hash(), game.hash());
+            TS_ASSERT_EQUALS(states.back()->board(), game.board());
+        }
+    }
+};
@@ -1,4 +1,6 @@
+#include <thread>
 #include <unordered_set>
+#include <vector>
 
 #include <cxxtest/TestSuite.h>
 
@@ -31,4 +33,22 @@ public:
         const auto table9 = baduk::getNeighborTable(9, 9);
         assertPointsEqual(table9->get("J5"), {"J4", "J6", "H5"});
     }
+
+    void testGetFromThreads() {
+        std::vector<baduk::NeighborTable const*> found(8);
+        std::vector<std::thread> threads;
+        for (unsigned int t = 0; t < found.size(); ++t) {
+            threads.emplace_back([&found, t]() {
+                for (unsigned int size = 1; size <= 19; ++size) {
+                    found[t] = baduk::getNeighborTable(size, 19 - t);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (unsigned int t = 0; t < found.size(); ++t) {
+            TS_ASSERT_EQUALS(baduk::getNeighborTable(19, 19 - t), found[t]);
+        }
+    }
 };
@@ -0,0 +1,40 @@
+#include <cxxtest/TestSuite.h>
+
+#include "../baduk/pattern.h"
+
+class PatternTestSuite : public CxxTest::TestSuite {
+public:
+    void testUniform() {
+        baduk::PatternWeights weights;
+        TS_ASSERT_EQUALS(1u, weights.maxWeight());
+        TS_ASSERT_EQUALS(1u, weights.weight(0));
+        TS_ASSERT_EQUALS(1u, weights.weight(baduk::NUM_PATTERNS - 1));
+    }
+
+    void testSet() {
+        baduk::PatternWeights weights;
+        weights.set(12345, 40);
+        TS_ASSERT_EQUALS(40u, weights.weight(12345));
+        TS_ASSERT_EQUALS(40u, weights.maxWeight());
+        TS_ASSERT_THROWS(weights.set(1, 0), baduk::BadPatternWeight);
+        TS_ASSERT_THROWS(weights.set(1, 256), baduk::BadPatternWeight);
+        TS_ASSERT_THROWS(
+            weights.set(baduk::NUM_PATTERNS, 40), baduk::BadPatternCode);
+        TS_ASSERT_EQUALS(40u, weights.maxWeight());
+    }
+
+    void testDefaults() {
+        auto const& weights = baduk::PatternWeights::defaults();
+        // Nothing around, a stone in contact, saving a string in atari
+        // on side 0, and capturing one.
+        const baduk::PatternCode open = 0;
+        const baduk::PatternCode contact = 2 << 8;
+        const baduk::PatternCode save = 1 | (1 << 16);
+        const baduk::PatternCode capture = 2 | (1 << 16);
+        TS_ASSERT_LESS_THAN(weights.weight(open), weights.weight(contact));
+        TS_ASSERT_LESS_THAN(weights.weight(contact), weights.weight(save));
+        TS_ASSERT_LESS_THAN(weights.weight(save), weights.weight(capture));
+        TS_ASSERT_EQUALS(weights.weight(capture), weights.maxWeight());
+        TS_ASSERT_EQUALS(&weights, &baduk::PatternWeights::defaults());
+    }
+};
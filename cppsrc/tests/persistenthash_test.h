@@ -0,0 +1,73 @@
+#include <random>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include "../baduk/persistenthash.h"
+
+class PersistentHashSetTestSuite : public CxxTest::TestSuite {
+public:
+    void testInsert() {
+        const baduk::PersistentHashSet empty;
+        const auto one = empty.insert(12345);
+        const auto two = one.insert(999);
+        TS_ASSERT(!empty.contains(12345));
+        TS_ASSERT(one.contains(12345));
+        TS_ASSERT(!one.contains(999));
+        TS_ASSERT(two.contains(12345));
+        TS_ASSERT(two.contains(999));
+        TS_ASSERT_EQUALS(2, two.size());
+        TS_ASSERT_EQUALS(2, two.insert(999).size());
+    }
+
+    void testSharedLowBits() {
+        // Equal in the low 60 bits, so they only split at the last
+        // level.
+        const baduk::PersistentHashSet empty;
+        const auto a = 0x0123456789abcdefULL;
+        const auto b = a ^ (1ULL << 63);
+        const auto set = empty.insert(a).insert(b);
+        TS_ASSERT(set.contains(a));
+        TS_ASSERT(set.contains(b));
+        TS_ASSERT(!set.contains(a ^ 1));
+    }
+
+    void testManyVersions() {
+        // Far more entries than the old fixed-size table could hold,
+        // keeping every intermediate version.
+        std::mt19937_64 rng(3);
+        std::vector<baduk::zobrist::hashcode> hashes;
+        std::vector<baduk::PersistentHashSet> versions{
+            baduk::PersistentHashSet()};
+        for (int i = 0; i < 5000; ++i) {
+            hashes.push_back(rng());
+            versions.push_back(versions.back().insert(hashes.back()));
+        }
+        TS_ASSERT_EQUALS(5000, versions.back().size());
+        for (int i = 0; i < 5000; i += 97) {
+            TS_ASSERT(versions.back().contains(hashes[i]));
+            TS_ASSERT(versions[i + 1].contains(hashes[i]));
+            TS_ASSERT(!versions[i].contains(hashes[i]));
+        }
+        TS_ASSERT(!versions.back().contains(rng()));
+    }
+
+    void testOutlivesItsParents() {
+        // Only the last set of a long chain is kept; the rest of the
+        // chain must stay alive through it, and be freed after it
+        // without deep recursion.
+        std::mt19937_64 rng(5);
+        std::vector<baduk::zobrist::hashcode> hashes;
+        baduk::PersistentHashSet set;
+        for (int i = 0; i < 100000; ++i) {
+            hashes.push_back(rng());
+            set = set.insert(hashes.back());
+        }
+        auto copy = set;
+        set = baduk::PersistentHashSet();
+        TS_ASSERT_EQUALS(100000, copy.size());
+        for (int i = 0; i < 100000; i += 997) {
+            TS_ASSERT(copy.contains(hashes[i]));
+        }
+    }
+};
@@ -0,0 +1,120 @@
+#include <cxxtest/TestSuite.h>
+
+#include "../baduk/board.h"
+#include "../baduk/playout.h"
+
+class PlayoutTestSuite : public CxxTest::TestSuite {
+public:
+    void testPlaysToTheEnd() {
+        for (unsigned int size : {9, 13, 19}) {
+            baduk::Playout playout;
+            baduk::Rng rng(7);
+            baduk::Board board(size, size);
+            const auto num_moves =
+                playout.run(board, baduk::Stone::black, rng);
+            TS_ASSERT(num_moves > size * size / 2);
+            TS_ASSERT(num_moves < 3 * size * size);
+            // Both players passed, so every empty point is an eye or
+            // illegal for both.
+            board.emptyPoints().forEach([&](baduk::Point p) {
+                for (auto stone : {baduk::Stone::black, baduk::Stone::white}) {
+                    TS_ASSERT(!board.candidates(stone).get(p) ||
+                        board.isEye(p, stone));
+                }
+            });
+        }
+    }
+
+    void testSeeded() {
+        baduk::Playout playout;
+        baduk::Rng rng1(3);
+        baduk::Rng rng2(3);
+        baduk::Board board1(9, 9);
+        baduk::Board board2(9, 9);
+        playout.run(board1, baduk::Stone::black, rng1);
+        playout.run(board2, baduk::Stone::black, rng2);
+        TS_ASSERT_EQUALS(board1, board2);
+    }
+
+    void testLeavesEyesAlone() {
+        // x x x x x
+        // x . x . x
+        // x x x x x
+        baduk::Board board(3, 5);
+        for (unsigned int c = 0; c < 5; ++c) {
+            board.place(baduk::Point(0, c), baduk::Stone::black);
+            board.place(baduk::Point(2, c), baduk::Stone::black);
+        }
+        board.place(baduk::Point(1, 0), baduk::Stone::black);
+        board.place(baduk::Point(1, 2), baduk::Stone::black);
+        board.place(baduk::Point(1, 4), baduk::Stone::black);
+        const auto before = board;
+
+        baduk::Playout playout;
+        baduk::Rng rng(1);
+        TS_ASSERT_EQUALS(2, playout.run(board, baduk::Stone::white, rng));
+        TS_ASSERT_EQUALS(before, board);
+        TS_ASSERT_EQUALS(15.0 - 7.5, baduk::playoutScore(board, 7.5));
+    }
+
+    void testHeavyPlaysToTheEnd() {
+        auto const& weights = baduk::PatternWeights::defaults();
+        for (unsigned int size : {9, 19}) {
+            baduk::Playout playout;
+            baduk::Rng rng(5);
+            baduk::Board board(size, size);
+            playout.run(board, baduk::Stone::black, rng, weights);
+            board.emptyPoints().forEach([&](baduk::Point p) {
+                for (auto stone : {baduk::Stone::black, baduk::Stone::white}) {
+                    TS_ASSERT(!board.candidates(stone).get(p) ||
+                        board.isEye(p, stone));
+                }
+            });
+        }
+    }
+
+    void testHeavyCaptures() {
+        // White's lone stone is in atari, and can connect to a group
+        // with two eyes if black doesn't capture it first. Weighting
+        // the capture heavily should save it far less often than
+        // drawing moves uniformly.
+        // . o . o . . . . .
+        // o o o o . . . . .
+        // . . . * . . . . .
+        // . . x o x . . . .
+        // . . . x . . . . .
+        baduk::Board board(9, 9);
+        for (auto p : {baduk::Point(0, 1), baduk::Point(0, 3),
+                baduk::Point(1, 0), baduk::Point(1, 1), baduk::Point(1, 2),
+                baduk::Point(1, 3), baduk::Point(3, 3)}) {
+            board.place(p, baduk::Stone::white);
+        }
+        for (auto p : {baduk::Point(3, 2), baduk::Point(3, 4),
+                baduk::Point(4, 3)}) {
+            board.place(p, baduk::Stone::black);
+        }
+        const baduk::Point capture(2, 3);
+        TS_ASSERT(board.willCapture(capture, baduk::Stone::black));
+        baduk::PatternWeights heavy;
+        heavy.set(
+            baduk::forPlayer(board.pattern(capture), baduk::Stone::black),
+            255);
+        const baduk::PatternWeights uniform;
+
+        baduk::Playout playout;
+        const auto count_saved = [&](baduk::PatternWeights const& weights) {
+            int saved = 0;
+            for (std::uint64_t seed = 0; seed < 40; ++seed) {
+                auto played = board;
+                baduk::Rng rng(seed);
+                playout.run(played, baduk::Stone::black, rng, weights);
+                saved += !played.isEmpty(baduk::Point(3, 3)) &&
+                    played.at(baduk::Point(3, 3)) == baduk::Stone::white;
+            }
+            return saved;
+        };
+        const auto heavy_saved = count_saved(heavy);
+        const auto uniform_saved = count_saved(uniform);
+        TS_ASSERT_LESS_THAN(2 * heavy_saved, uniform_saved);
+    }
+};
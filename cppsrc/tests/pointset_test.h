@@ -0,0 +1,49 @@
+#include <cxxtest/TestSuite.h>
+
+#include "../baduk/pointset.h"
+
+class PointSetTestSuite : public CxxTest::TestSuite {
+public:
+    void testIterateInOrder() {
+        baduk::PointSet points;
+        points.add("T19");
+        points.add("A1");
+        points.add("C4");
+        // Bit 63 is the last bit of the first word.
+        points.add(baduk::Point(3, 6));
+        points.add(baduk::Point(3, 7));
+        const std::vector<baduk::Point> expected{
+            "A1", "C4", baduk::Point(3, 6), baduk::Point(3, 7), "T19"};
+        TS_ASSERT_EQUALS(expected, points.asPoints());
+        TS_ASSERT_EQUALS(5, points.size());
+    }
+
+    void testEmpty() {
+        baduk::PointSet points;
+        TS_ASSERT(points.empty());
+        TS_ASSERT(!(points.begin() != points.end()));
+        points.add("E5");
+        points.remove("E5");
+        TS_ASSERT(points.empty());
+        TS_ASSERT(!(points.begin() != points.end()));
+    }
+
+    void testSetOperations() {
+        baduk::PointSet a;
+        a.add("A1");
+        a.add("B2");
+        baduk::PointSet b;
+        b.add("B2");
+        b.add("T19");
+        const auto both = a.unionWith(b);
+        TS_ASSERT_EQUALS(3, both.size());
+        TS_ASSERT(both.contains("T19"));
+
+        auto only_a = both;
+        only_a.remove(b);
+        TS_ASSERT_EQUALS(1, only_a.size());
+        TS_ASSERT(only_a.contains("A1"));
+        TS_ASSERT(!only_a.contains("B2"));
+        TS_ASSERT_EQUALS(only_a, a.without("B2"));
+    }
+};
@@ -0,0 +1,111 @@
+#include <random>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include "../baduk/game.h"
+#include "../baduk/mutablegame.h"
+#include "../baduk/position.h"
+
+class PositionTestSuite : public CxxTest::TestSuite {
+public:
+    void testCopyIsIndependent() {
+        baduk::Position position(baduk::Board(9, 9), baduk::Stone::black, 7.5);
+        position.play(baduk::Play("E5"));
+        auto copy = position;
+        copy.play(baduk::Play("D5"));
+        copy.play(baduk::Pass());
+
+        TS_ASSERT_EQUALS(1, position.numMoves());
+        TS_ASSERT(position.board().isEmpty("D5"));
+        TS_ASSERT_EQUALS(baduk::Stone::white, position.nextPlayer());
+        TS_ASSERT_EQUALS(3, copy.numMoves());
+        TS_ASSERT(!copy.board().isEmpty("D5"));
+        TS_ASSERT(!(copy == position));
+    }
+
+    void testIsOver() {
+        baduk::Position position(baduk::Board(9, 9), baduk::Stone::black, 7.5);
+        position.play(baduk::Pass());
+        TS_ASSERT(!position.isOver());
+        position.play(baduk::Play("E5"));
+        position.play(baduk::Pass());
+        TS_ASSERT(!position.isOver());
+        position.play(baduk::Pass());
+        TS_ASSERT(position.isOver());
+    }
+
+    void testMatchesGameState() {
+        std::mt19937 rng(5);
+        auto state = baduk::newGame(9, 7.5);
+        baduk::Position position(*state);
+        while (!state->isOver() && state->numMoves() < 300) {
+            TS_ASSERT_EQUALS(state->legalMoves(), position.legalMoves());
+            std::vector<baduk::Point> legal;
+            for (unsigned int r = 0; r < 9; ++r) {
+                for (unsigned int c = 0; c < 9; ++c) {
+                    const baduk::Play play(baduk::Point(r, c));
+                    TS_ASSERT_EQUALS(
+                        state->isMoveLegal(play), position.isMoveLegal(play));
+                    TS_ASSERT_EQUALS(
+                        state->doesMoveViolateKo(play),
+                        position.doesMoveViolateKo(play));
+                    if (state->isMoveLegal(play)) {
+                        legal.push_back(play.point());
+                    }
+                }
+            }
+            baduk::Move move = baduk::Pass();
+            if (!legal.empty() && rng() % 20 != 0) {
+                move = baduk::Play(legal[rng() % legal.size()]);
+            }
+            state = state->applyMove(move);
+            position.play(move);
+            TS_ASSERT_EQUALS(state->hash(), position.hash());
+            TS_ASSERT_EQUALS(state->isOver(), position.isOver());
+        }
+
+        // Picking up part way through a game keeps the history.
+        const baduk::Position resumed(*state);
+        TS_ASSERT(resumed == position);
+        TS_ASSERT_EQUALS(position.numMoves(), resumed.numMoves());
+        TS_ASSERT_EQUALS(position.isOver(), resumed.isOver());
+    }
+
+    void testRulesMatchGameState() {
+        std::mt19937 rng(9);
+        for (auto ko : {baduk::KoRule::simple, baduk::KoRule::positional,
+                baduk::KoRule::situational}) {
+            for (bool allow_suicide : {false, true}) {
+                baduk::Rules rules;
+                rules.ko = ko;
+                rules.allow_suicide = allow_suicide;
+                auto state = baduk::newGame(5, 0.5, rules);
+                baduk::Position position(*state);
+                baduk::MutableGame game(position);
+                while (!state->isOver() && state->numMoves() < 200) {
+                    const auto legal = state->legalMoves();
+                    TS_ASSERT_EQUALS(legal, position.legalMoves());
+                    TS_ASSERT_EQUALS(legal, game.legalMoves());
+                    // Resuming rebuilds the ko state too.
+                    TS_ASSERT_EQUALS(
+                        legal, baduk::Position(*state).legalMoves());
+                    std::vector<baduk::Point> plays;
+                    legal.forEach([&](baduk::Point p) { plays.push_back(p); });
+                    baduk::Move move = baduk::Pass();
+                    if (!plays.empty() && rng() % 10 != 0) {
+                        move = baduk::Play(plays[rng() % plays.size()]);
+                    }
+                    state = state->applyMove(move);
+                    position.play(move);
+                    // Undoing puts the ko state back.
+                    game.play(move);
+                    game.undo();
+                    TS_ASSERT_EQUALS(legal, game.legalMoves());
+                    game.play(move);
+                    TS_ASSERT_EQUALS(state->hash(), position.hash());
+                }
+            }
+        }
+    }
+};
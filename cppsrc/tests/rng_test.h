@@ -0,0 +1,55 @@
+#include <array>
+#include <random>
+
+#include <cxxtest/TestSuite.h>
+
+#include "../baduk/rng.h"
+
+class RngTestSuite : public CxxTest::TestSuite {
+public:
+    void testRepeatable() {
+        baduk::Rng rng1(42);
+        baduk::Rng rng2(42);
+        for (int i = 0; i < 100; ++i) {
+            TS_ASSERT_EQUALS(rng1(), rng2());
+        }
+    }
+
+    void testStreamsDiffer() {
+        baduk::Rng rng1(42, 0);
+        baduk::Rng rng2(42, 1);
+        baduk::Rng rng3(43, 0);
+        const auto a = rng1();
+        TS_ASSERT_DIFFERS(a, rng2());
+        TS_ASSERT_DIFFERS(a, rng3());
+    }
+
+    void testSeedAndStreamDontCommute() {
+        for (std::uint64_t x : {0, 1, 42}) {
+            baduk::Rng rng1(x, x + 1);
+            baduk::Rng rng2(x + 1, x);
+            TS_ASSERT_DIFFERS(rng1(), rng2());
+        }
+    }
+
+    void testBelow() {
+        baduk::Rng rng(7);
+        TS_ASSERT_EQUALS(0u, rng.below(1));
+        std::array<unsigned int, 5> counts{};
+        for (int i = 0; i < 50000; ++i) {
+            const auto x = rng.below(5);
+            TS_ASSERT(x < 5);
+            ++counts[x];
+        }
+        for (auto count : counts) {
+            TS_ASSERT(count > 9500 && count < 10500);
+        }
+    }
+
+    void testWorksWithDistributions() {
+        baduk::Rng rng(3);
+        std::uniform_real_distribution<double> dist(0.0, 1.0);
+        const auto x = dist(rng);
+        TS_ASSERT(x >= 0.0 && x < 1.0);
+    }
+};
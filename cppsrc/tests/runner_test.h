@@ -0,0 +1,65 @@
+#include <cxxtest/TestSuite.h>
+
+#include "../baduk/game.h"
+#include "../baduk/runner.h"
+
+class RunnerTestSuite : public CxxTest::TestSuite {
+public:
+    void testSplitsAllPlayouts() {
+        const auto game = baduk::newGame(9, 7.5);
+        for (unsigned int threads : {1, 3, 8}) {
+            const auto stats = baduk::runPlayouts(*game, 20, threads, 5);
+            TS_ASSERT_EQUALS(20, stats.numPlayouts());
+            for (unsigned int r = 0; r < 9; ++r) {
+                for (unsigned int c = 0; c < 9; ++c) {
+                    const baduk::Point p(r, c);
+                    TS_ASSERT(stats.blackOwned().get(p) +
+                        stats.whiteOwned().get(p) <= 20);
+                }
+            }
+        }
+    }
+
+    void testSeeded() {
+        // The same on any number of threads.
+        const auto game = baduk::newGame(9, 7.5);
+        const auto stats1 = baduk::runPlayouts(*game, 30, 1, 9);
+        const auto stats2 = baduk::runPlayouts(*game, 30, 4, 9);
+        TS_ASSERT_EQUALS(stats1.meanScore(), stats2.meanScore());
+        TS_ASSERT_EQUALS(stats1.blackWinRate(), stats2.blackWinRate());
+        for (unsigned int r = 0; r < 9; ++r) {
+            for (unsigned int c = 0; c < 9; ++c) {
+                const baduk::Point p(r, c);
+                TS_ASSERT_EQUALS(
+                    stats1.blackOwned().get(p), stats2.blackOwned().get(p));
+                TS_ASSERT_EQUALS(
+                    stats1.whiteOwned().get(p), stats2.whiteOwned().get(p));
+            }
+        }
+        const auto stats3 = baduk::runPlayouts(*game, 30, 1, 10);
+        TS_ASSERT_DIFFERS(stats1.meanScore(), stats3.meanScore());
+    }
+
+    void testSettledBoard() {
+        // x x x x x
+        // x . x . x
+        // x x x x x
+        baduk::Board board(3, 5);
+        for (unsigned int c = 0; c < 5; ++c) {
+            board.place(baduk::Point(0, c), baduk::Stone::black);
+            board.place(baduk::Point(2, c), baduk::Stone::black);
+        }
+        board.place(baduk::Point(1, 0), baduk::Stone::black);
+        board.place(baduk::Point(1, 2), baduk::Stone::black);
+        board.place(baduk::Point(1, 4), baduk::Stone::black);
+        const auto game =
+            baduk::gameFromBoard(board, baduk::Stone::white, 7.5);
+
+        const auto stats = baduk::runPlayouts(*game, 10, 2, 1);
+        TS_ASSERT_EQUALS(10, stats.numPlayouts());
+        TS_ASSERT_EQUALS(15.0 - 7.5, stats.meanScore());
+        TS_ASSERT_EQUALS(1.0, stats.blackWinRate());
+        TS_ASSERT_EQUALS(10, stats.blackOwned().get(baduk::Point(1, 1)));
+        TS_ASSERT_EQUALS(0, stats.whiteOwned().get(baduk::Point(1, 1)));
+    }
+};
@@ -0,0 +1,83 @@
+#include <thread>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include "../baduk/game.h"
+#include "../baduk/transposition.h"
+
+namespace {
+
+struct SearchResult {
+    int depth;
+    float value;
+};
+
+}
+
+class TranspositionTestSuite : public CxxTest::TestSuite {
+public:
+    void testLookup() {
+        baduk::TranspositionTable<float> table(1000);
+        TS_ASSERT(table.capacity() >= 1000);
+
+        auto game = baduk::newGame(9, 7.5);
+        const auto after = game->applyMove(baduk::Play(baduk::Point(4, 4)));
+        table.store(game->hash(), 0.5);
+        TS_ASSERT_EQUALS(0.5, table.lookup(game->hash()).value());
+        TS_ASSERT(!table.lookup(after->hash()));
+
+        table.store(game->hash(), 0.25);
+        TS_ASSERT_EQUALS(0.25, table.lookup(game->hash()).value());
+
+        const auto stats = table.stats();
+        TS_ASSERT_EQUALS(2, stats.hits);
+        TS_ASSERT_EQUALS(1, stats.misses);
+        TS_ASSERT_EQUALS(2, stats.stores);
+
+        table.clear();
+        TS_ASSERT(!table.lookup(game->hash()));
+        TS_ASSERT_EQUALS(0, table.stats().hits);
+    }
+
+    void testReplaceIfDeeper() {
+        // A single bucket, so every key collides.
+        baduk::TranspositionTable<SearchResult, baduk::ReplaceIfDeeper>
+            table(1);
+        const auto ways = table.capacity();
+        for (unsigned int i = 0; i < ways; ++i) {
+            table.store(i, SearchResult{5, 0.0});
+        }
+        table.store(1000, SearchResult{3, 1.0});
+        TS_ASSERT(!table.lookup(1000));
+        TS_ASSERT_EQUALS(1, table.stats().rejections);
+
+        table.store(1001, SearchResult{7, 1.0});
+        TS_ASSERT_EQUALS(7, table.lookup(1001)->depth);
+        TS_ASSERT_EQUALS(1, table.stats().replacements);
+    }
+
+    void testThreads() {
+        baduk::TranspositionTable<unsigned long long> table(1 << 12);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&table]() {
+                for (unsigned long long key = 1; key < 20000; ++key) {
+                    const auto hash = key * 0x9e3779b97f4a7c15ULL;
+                    table.store(hash, key);
+                    const auto found = table.lookup(hash);
+                    // Another thread may have evicted it, but never
+                    // replaced it with someone else's payload.
+                    if (found) {
+                        TS_ASSERT_EQUALS(key, *found);
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        const auto stats = table.stats();
+        TS_ASSERT_EQUALS(4 * 19999, stats.hits + stats.misses);
+    }
+};
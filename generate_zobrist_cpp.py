@@ -8,11 +8,12 @@ black = 1
 white = 2
 
 MAX63 = 0x7fffffffffffffff
+SIZE = 25
 
 table = {}
 empty_board = 0
-for row in range(25):
-    for col in range(25):
+for row in range(SIZE):
+    for col in range(SIZE):
         for state in (None, black, white):
             code = random.randint(0, MAX63)
             table[Point(row, col), state] = code
@@ -21,32 +22,57 @@ for row in range(25):
 black_to_play = random.randint(0, MAX63)
 white_to_play = random.randint(0, MAX63)
 
-print('#include "zobrist.h"')
+# High words of the 128-bit codes used when building with
+# BADUK_WIDE_HASH. The low words are the 64-bit codes above.
+high_table = {}
+empty_board_high = 0
+for row in range(SIZE):
+    for col in range(SIZE):
+        for state in (None, black, white):
+            code = random.randint(0, MAX63)
+            high_table[Point(row, col), state] = code
+            if state is None:
+                empty_board_high ^= code
+
+
+def print_codes(table, state, indent):
+    codes = [table[Point(row, col), state]
+             for row in range(SIZE) for col in range(SIZE)]
+    for i in range(0, len(codes), 3):
+        print(indent + ' '.join('%dULL,' % code for code in codes[i:i + 3]))
+
+
+print('// Generated by generate_zobrist_cpp.py; do not edit.')
+print('#ifndef incl_BADUK_ZOBRIST_CODES_H__')
+print('#define incl_BADUK_ZOBRIST_CODES_H__')
+print('')
+print('#include <array>')
 print('')
 print('namespace baduk {')
 print('namespace zobrist {')
 print('')
-print('void ZobristCodes::initialize() {')
-print('    empty_codes_.resize(25 * 25);')
-for (pt, state), hash_code in table.items():
-    if state is not None:
-        continue
-    print('    empty_codes_[index(::baduk::Point(%d, %d))] = %dLL;' % (
-        pt.row, pt.col, hash_code))
-print('    black_codes_.resize(25 * 25);')
-for (pt, state), hash_code in table.items():
-    if state != black:
-        continue
-    print('    black_codes_[index(::baduk::Point(%d, %d))] = %dLL;' % (
-        pt.row, pt.col, hash_code))
-print('    white_codes_.resize(25 * 25);')
-for (pt, state), hash_code in table.items():
-    if state != white:
-        continue
-    print('    white_codes_[index(::baduk::Point(%d, %d))] = %dLL;' % (
-        pt.row, pt.col, hash_code))
-print('    empty_board_ = %dLL;' % (empty_board,));
-print('}')
+print('// One code per point, indexed by %d * row + col.' % SIZE)
+print('using CodeTable = std::array<unsigned long long, %d>;' % (SIZE * SIZE))
 print('')
+for suffix, codes, empty in (('', table, empty_board),
+                             ('_HIGH', high_table, empty_board_high)):
+    print('// Indexed by [stone][point].')
+    print('inline constexpr std::array<CodeTable, 2> STONE_CODES%s = {{' % (
+        suffix,))
+    for state in (black, white):
+        print('    {{')
+        print_codes(codes, state, '        ')
+        print('    }},')
+    print('}};')
+    print('')
+    print('inline constexpr CodeTable EMPTY_CODES%s = {{' % (suffix,))
+    print_codes(codes, None, '    ')
+    print('}};')
+    print('')
+    print('inline constexpr unsigned long long EMPTY_BOARD%s = %dULL;' % (
+        suffix, empty))
+    print('')
 print('}')
 print('}')
+print('')
+print('#endif')
@@ -1,4 +1,5 @@
 import numpy as np
+import os
 import platform
 from setuptools import setup, Extension
 from Cython.Build import cythonize
@@ -11,6 +12,12 @@ if platform.system() == 'Darwin':
     # full C++17 library (specifically, std::variant)
     extra_compile_args.append('-mmacosx-version-min=10.14')
     extra_link_args.append('-mmacosx-version-min=10.14')
+if os.environ.get('BADUK_WIDE_HASH'):
+    # 128-bit position hashes; see cppsrc/baduk/zobrist/zobrist.h.
+    extra_compile_args.append('-DBADUK_WIDE_HASH')
+if os.environ.get('BADUK_AVX2'):
+    # The AVX2 version of Bitboard::dilate.
+    extra_compile_args.append('-mavx2')
 for inc_dir in include_dirs:
     extra_compile_args.append('-I' + inc_dir)
 
@@ -23,16 +30,25 @@ setup(
         sources=[
             "baduk/*.pyx",
             "cppsrc/baduk/agent.cpp",
+            "cppsrc/baduk/arena.cpp",
+            "cppsrc/baduk/bitboard.cpp",
             "cppsrc/baduk/board.cpp",
             "cppsrc/baduk/counter.cpp",
+            "cppsrc/baduk/fixedboard.cpp",
             "cppsrc/baduk/game.cpp",
-            "cppsrc/baduk/gostring.cpp",
+            "cppsrc/baduk/gamerecord.cpp",
+            "cppsrc/baduk/hashhistory.cpp",
+            "cppsrc/baduk/mutablegame.cpp",
             "cppsrc/baduk/neighbor.cpp",
+            "cppsrc/baduk/pattern.cpp",
+            "cppsrc/baduk/persistenthash.cpp",
+            "cppsrc/baduk/playout.cpp",
             "cppsrc/baduk/point.cpp",
             "cppsrc/baduk/pointset.cpp",
+            "cppsrc/baduk/position.cpp",
+            "cppsrc/baduk/referee.cpp",
+            "cppsrc/baduk/runner.cpp",
             "cppsrc/baduk/scoring.cpp",
-            "cppsrc/baduk/zobrist/codes.cpp",
-            "cppsrc/baduk/zobrist/zobrist.cpp",
         ],
         language="c++",
         extra_compile_args=['-O3', '-std=c++17'] + extra_compile_args,